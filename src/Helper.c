@@ -16,7 +16,14 @@
 #include <ncarg/hlu/CoordArrays.h>
 #include <ncarg/hlu/StreamlinePlot.h>
 #include <ncarg/hlu/VectorPlot.h>
+#include <stdio.h>
 #include <stdlib.h>
+#include <math.h>
+#include <string.h>
+#include <strings.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <ncarg/c.h>
 #include <ncarg/hlu/hlu.h>
 #include <ncarg/hlu/NresDB.h>
@@ -36,8 +43,15 @@ extern double NGCALLF(dsatlftskewt,DSATLFTSKEWT)(double *,double *);
 extern double NGCALLF(dshowalskewt,DSHOWALSKEWT)(double *,double *,
                                                  double *,int *);
 extern double NGCALLF(dpwskewt,DPWSKEWT)(double *,double *,int*);
-extern void NGCALLF(gaqdncl,GAQDNCL)(int *, double *, double *, double *, int *, int *);
 extern void c_nngetc(char *, char *);
+extern int *c_csstri(int, float [], float [], int *, int *);
+extern int c_ftcurv(int, float [], float [], int, float [], float []);
+extern int c_ftcurvd(int, float [], float [], int, float [], float []);
+extern int c_ftcurvi(float, float, int, float [], float [], float *);
+extern int c_ftcurvp(int, float [], float [], float, int, float [], float []);
+extern int c_ftcurvpi(float, float, float, int, float [], float [], float *);
+extern void c_ftsetr(char *, float);
+extern void c_ftgetr(char *, float *);
 
 char *c_nngetcp(char *);
 
@@ -157,6 +171,168 @@ void *pvoid()
 double c_dgcdist(double lat1, double lon1, double lat2, double lon2, int iu) {
   return   (double) NGCALLF(dgcdist,DGCDIST)(&lat1, &lon1, &lat2, &lon2, &iu);
 }
+/*
+ *  Array versions of the great circle routines. Latitudes, longitudes
+ *  and azimuths are in degrees; distances are in the units selected
+ *  by iu, as for DGCDIST (1 = radians, 2 = degrees, 3 = meters,
+ *  4 = kilometers). The spherical law of cosines used by DGCDIST
+ *  loses precision for nearby points, so the atan2 form is used here.
+ */
+#define NGL_GC_D2R  0.017453292519943295
+#define NGL_GC_REKM 6371.22
+
+static double gc_unit_scale(int iu) {
+  switch(iu) {
+  case 1:
+    return(1.);
+  case 3:
+    return(1000.*NGL_GC_REKM);
+  case 4:
+    return(NGL_GC_REKM);
+  default:
+    return(1./NGL_GC_D2R);
+  }
+}
+
+void c_dgcdist_n(double *lat1, double *lon1, double *lat2, double *lon2,
+                 int n, int iu, double *dist) {
+  int i;
+  double scale, slat1, clat1, slat2, clat2, sdlon, cdlon, a, b;
+
+  scale = gc_unit_scale(iu);
+#ifdef _OPENMP
+#pragma omp parallel for private(slat1,clat1,slat2,clat2,sdlon,cdlon,a,b) \
+                         schedule(static)
+#endif
+  for (i = 0; i < n; i++) {
+    slat1 = sin(NGL_GC_D2R*lat1[i]);
+    clat1 = cos(NGL_GC_D2R*lat1[i]);
+    slat2 = sin(NGL_GC_D2R*lat2[i]);
+    clat2 = cos(NGL_GC_D2R*lat2[i]);
+    sdlon = sin(NGL_GC_D2R*(lon2[i]-lon1[i]));
+    cdlon = cos(NGL_GC_D2R*(lon2[i]-lon1[i]));
+    a = clat2*sdlon;
+    b = clat1*slat2 - slat1*clat2*cdlon;
+    dist[i] = scale*atan2(sqrt(a*a + b*b), slat1*slat2 + clat1*clat2*cdlon);
+  }
+}
+
+/*
+ *  Initial azimuth, in degrees clockwise from north in [0,360), of
+ *  the great circle from point 1 to point 2.
+ */
+void c_dgcazim_n(double *lat1, double *lon1, double *lat2, double *lon2,
+                 int n, double *azim) {
+  int i;
+  double slat1, clat1, slat2, clat2, dlon, az;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(slat1,clat1,slat2,clat2,dlon,az) \
+                         schedule(static)
+#endif
+  for (i = 0; i < n; i++) {
+    slat1 = sin(NGL_GC_D2R*lat1[i]);
+    clat1 = cos(NGL_GC_D2R*lat1[i]);
+    slat2 = sin(NGL_GC_D2R*lat2[i]);
+    clat2 = cos(NGL_GC_D2R*lat2[i]);
+    dlon  = NGL_GC_D2R*(lon2[i]-lon1[i]);
+    az    = atan2(sin(dlon)*clat2, clat1*slat2 - slat1*clat2*cos(dlon));
+    az    = az/NGL_GC_D2R;
+    azim[i] = az < 0. ? az + 360. : az;
+  }
+}
+
+/*
+ *  The point reached by going dist (in the units selected by iu) along
+ *  the great circle leaving (lat,lon) at the given azimuth. Returned
+ *  longitudes are in [-180,180).
+ */
+void c_dgcdest_n(double *lat, double *lon, double *dist, double *azim,
+                 int n, int iu, double *lat2, double *lon2) {
+  int i;
+  double scale, slat, clat, sd, cd, saz, caz, s2, dlon, rlon;
+
+  scale = gc_unit_scale(iu);
+#ifdef _OPENMP
+#pragma omp parallel for private(slat,clat,sd,cd,saz,caz,s2,dlon,rlon) \
+                         schedule(static)
+#endif
+  for (i = 0; i < n; i++) {
+    slat = sin(NGL_GC_D2R*lat[i]);
+    clat = cos(NGL_GC_D2R*lat[i]);
+    sd   = sin(dist[i]/scale);
+    cd   = cos(dist[i]/scale);
+    saz  = sin(NGL_GC_D2R*azim[i]);
+    caz  = cos(NGL_GC_D2R*azim[i]);
+    s2   = slat*cd + clat*sd*caz;
+    if (s2 > 1.)  s2 = 1.;
+    if (s2 < -1.) s2 = -1.;
+    dlon = atan2(saz*sd*clat, cd - slat*s2);
+    lat2[i] = asin(s2)/NGL_GC_D2R;
+    rlon    = lon[i] + dlon/NGL_GC_D2R;
+    lon2[i] = rlon - 360.*floor((rlon + 180.)/360.);
+  }
+}
+
+/*
+ *  Distances from each of the n points (lat1,lon1) to each of the m
+ *  points (lat2,lon2), returned in the n x m array dist. The sines and
+ *  cosines are computed once per point, and the output is filled in
+ *  by tiles of rows and columns so that both parts of them stay in
+ *  cache. With OpenMP, the tiles of rows are shared out among the
+ *  threads.
+ */
+#define NGL_GC_BLOCK 512
+#define NGL_GC_ROWS  64
+
+void c_dgcdist_pairs(double *lat1, double *lon1, int n, double *lat2,
+                     double *lon2, int m, int iu, double *dist) {
+  int i, i0, i1, j, j0, j1;
+  double scale, *trig1, *trig2, *t1, *t2, cdlon, sdlon, a, b;
+
+  scale = gc_unit_scale(iu);
+  trig1 = (double *) malloc(4*(n > 0 ? n : 1)*sizeof(double));
+  trig2 = (double *) malloc(4*(m > 0 ? m : 1)*sizeof(double));
+  for (i = 0; i < n; i++) {
+    trig1[4*i]   = sin(NGL_GC_D2R*lat1[i]);
+    trig1[4*i+1] = cos(NGL_GC_D2R*lat1[i]);
+    trig1[4*i+2] = sin(NGL_GC_D2R*lon1[i]);
+    trig1[4*i+3] = cos(NGL_GC_D2R*lon1[i]);
+  }
+  for (j = 0; j < m; j++) {
+    trig2[4*j]   = sin(NGL_GC_D2R*lat2[j]);
+    trig2[4*j+1] = cos(NGL_GC_D2R*lat2[j]);
+    trig2[4*j+2] = sin(NGL_GC_D2R*lon2[j]);
+    trig2[4*j+3] = cos(NGL_GC_D2R*lon2[j]);
+  }
+#ifdef _OPENMP
+#pragma omp parallel for private(i,i1,j,j0,j1,t1,t2,cdlon,sdlon,a,b) \
+                         schedule(dynamic)
+#endif
+  for (i0 = 0; i0 < n; i0 += NGL_GC_ROWS) {
+    i1 = i0 + NGL_GC_ROWS < n ? i0 + NGL_GC_ROWS : n;
+    for (j0 = 0; j0 < m; j0 += NGL_GC_BLOCK) {
+      j1 = j0 + NGL_GC_BLOCK < m ? j0 + NGL_GC_BLOCK : m;
+      for (i = i0; i < i1; i++) {
+        t1 = &trig1[4*i];
+        for (j = j0; j < j1; j++) {
+          t2 = &trig2[4*j];
+/*
+ *  cos and sin of lon2-lon1 from the angle difference identities.
+ */
+          cdlon = t2[3]*t1[3] + t2[2]*t1[2];
+          sdlon = t2[2]*t1[3] - t2[3]*t1[2];
+          a = t2[1]*sdlon;
+          b = t1[1]*t2[0] - t1[0]*t2[1]*cdlon;
+          dist[(size_t)i*m+j] = scale*atan2(sqrt(a*a + b*b),
+                                            t1[0]*t2[0] + t1[1]*t2[1]*cdlon);
+        }
+      }
+    }
+  }
+  free(trig1);
+  free(trig2);
+}
 double c_dcapethermo(double *penv, double *tenv, int nlvl, double lclmb, 
   int iprnt, double **tparcel, double tmsg, int *jlcl, int *jlfc, int *jcross) {
 
@@ -164,6 +340,84 @@ double c_dcapethermo(double *penv, double *tenv, int nlvl, double lclmb,
   return (double) NGCALLF(dcapethermo,DCAPETHERMO)(penv, tenv, &nlvl,
                   &lclmb, &iprnt, *tparcel, &tmsg, jlcl, jlfc, jcross);
 }
+/*
+ *  CAPE and related parcel quantities for ncol soundings at once.
+ *
+ *  t and td (deg C) are nlvl x ncol arrays, level by level. p (hPa)
+ *  is also nlvl x ncol, or just nlvl values used for every column if
+ *  p_is_1d is set. The parcel is lifted from the first level, as in
+ *  skewt_plt; levels may go either up or down.
+ *
+ *  For each column this returns CAPE (from DCAPETHERMO), CIN, both in
+ *  J/kg, and the pressures of the lifting condensation level, level
+ *  of free convection and equilibrium level. CIN is Rd times the
+ *  integral of (Tparcel - Tenv) dln(p) over the layers below the LFC
+ *  where the parcel is the colder one. Columns with a
+ *  missing value (tmsg) anywhere, or no LFC, get tmsg for the values
+ *  that can't be found.
+ *
+ *  The columns are done one after another: DCAPETHERMO and DPTLCLSKEWT
+ *  are Fortran routines that aren't known to be safe to call from
+ *  more than one thread at a time.
+ */
+void c_dcapethermo_cols(double *p, int p_is_1d, double *t, double *td,
+                        int nlvl, int ncol, double tmsg, double *cape,
+                        double *cin, double *plcl, double *plfc,
+                        double *pel)
+{
+  int c, k, kk, jlcl, jlfc, jcross, iprnt = 0, ok, reverse;
+  double rd = 287.04;
+  double *pc, *tc, *tparcel, pl, tl, area, da;
+
+  for(c = 0; c < ncol; c++) {
+    cape[c] = cin[c] = plcl[c] = plfc[c] = pel[c] = tmsg;
+  }
+  if(nlvl < 2) return;
+
+  pc = (double *) malloc(3*nlvl*sizeof(double));
+  if(pc == NULL) {
+    NhlPError(NhlFATAL,NhlEUNKNOWN,
+              "c_dcapethermo_cols: unable to allocate memory");
+    return;
+  }
+  tc      = &pc[nlvl];
+  tparcel = &pc[2*nlvl];
+
+  for(c = 0; c < ncol; c++) {
+/*
+ *  Copy the column, lowest level (highest pressure) first.
+ */
+    reverse = p_is_1d ? (p[0] < p[nlvl-1]) : (p[c] < p[(nlvl-1)*ncol+c]);
+    ok = 1;
+    for(k = 0; k < nlvl; k++) {
+      kk    = reverse ? nlvl-1-k : k;
+      pc[k] = p_is_1d ? p[kk] : p[kk*ncol+c];
+      tc[k] = t[kk*ncol+c];
+      if(pc[k] == tmsg || tc[k] == tmsg) ok = 0;
+    }
+    if(!ok || td[(reverse ? nlvl-1 : 0)*ncol+c] == tmsg) continue;
+
+    NGCALLF(dptlclskewt,DPTLCLSKEWT)(&pc[0], &tc[0],
+                           &td[(reverse ? nlvl-1 : 0)*ncol+c], &pl, &tl);
+    cape[c] = NGCALLF(dcapethermo,DCAPETHERMO)(pc, tc, &nlvl, &pl, &iprnt,
+                           tparcel, &tmsg, &jlcl, &jlfc, &jcross);
+    plcl[c] = pl;
+    if(cape[c] <= 0. || jlfc < 0 || jlfc >= nlvl) continue;
+    plfc[c] = pc[jlfc];
+    if(jcross >= jlfc && jcross < nlvl) pel[c] = pc[jcross];
+
+    area = 0.;
+    for(k = 0; k < jlfc; k++) {
+      if(tparcel[k] == tmsg || tparcel[k+1] == tmsg) continue;
+      da = 0.5*((tparcel[k] - tc[k]) + (tparcel[k+1] - tc[k+1]))
+              *log(pc[k]/pc[k+1]);
+      if(da < 0.) area += da;
+    }
+    cin[c] = rd*area;
+  }
+  free(pc);
+}
+
 void c_dptlclskewt(double p, double t, double td, double *pc, double *tc) {
   NGCALLF(dptlclskewt,DPTLCLSKEWT)(&p, &t, &td, pc, tc);
 }
@@ -176,6 +430,32 @@ double c_dtdaskewt(double w, double p) {
 double c_dsatlftskewt(double thw, double p) {
   return  (double) NGCALLF(dsatlftskewt,DSATLFTSKEWT)(&thw, &p);
 }
+/*
+ *  The skew-T helpers above for n points at once, for drawing the
+ *  background lines of a skew-T chart: which = 0 for DTMRSKEWT (the
+ *  temperature of mixing ratio a), 1 for DTDASKEWT (dry adiabat a)
+ *  and 2 for DSATLFTSKEWT (moist adiabat a), each at pressure p.
+ *
+ *  This is still one Fortran call per point; what it saves is a
+ *  Python call and argument conversion per point.
+ */
+void c_dskewt_n(int which, double *a, double *p, int n, double *t) {
+  int i;
+
+  for (i = 0; i < n; i++) {
+    switch(which) {
+    case 0:
+      t[i] = NGCALLF(dtmrskewt,DTMRSKEWT)(&a[i], &p[i]);
+      break;
+    case 1:
+      t[i] = NGCALLF(dtdaskewt,DTDASKEWT)(&a[i], &p[i]);
+      break;
+    default:
+      t[i] = NGCALLF(dsatlftskewt,DSATLFTSKEWT)(&a[i], &p[i]);
+      break;
+    }
+  }
+}
 double c_dshowalskewt(double *p, double *t, double *td, int nlvls) {
   return  (double) NGCALLF(dshowalskewt,DSHOWALSKEWT)(p, t, td, &nlvls);
 }
@@ -183,26 +463,101 @@ double c_dpwskewt(double *td, double *p, int n) {
   return  (double) NGCALLF(dpwskewt,DPWSKEWT)(td, p, &n);
 }
 
+/*
+ *  Gaussian latitudes and weights, as nl = 2*nlat (latitude, weight)
+ *  pairs going from south to north. The weights sum to 2.
+ *
+ *  The latitudes are the zeros of the Legendre polynomial P_nl, found
+ *  by Newton iteration on the colatitude starting from the asymptotic
+ *  estimate of each zero, so only O(nlat) memory is needed. (GAQDNCL
+ *  needs a work array of 4*nl*(nl+1) doubles, which gets very large
+ *  for high resolution grids.) Only half of the zeros are computed;
+ *  the others are their mirror images.
+ *
+ *  The results for the last few values of nlat are kept, so asking
+ *  for the same grid again is just a copy.
+ */
+#define NGL_GAUS_CACHE 8
+
+static struct {
+  int    nlat;
+  double *values;
+} gaus_cache[NGL_GAUS_CACHE];
+static int gaus_next = 0;
+
+static void gaus_newton(int nl, double *values)
+{
+  int j, k, iter;
+  double pi = 3.14159265358979323846, rtod = 180./pi;
+  double theta, x, sint, p0, p1, p2, dpdt, dtheta;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(j,iter,theta,x,sint,p0,p1,p2,dpdt,dtheta) \
+                         schedule(dynamic,16)
+#endif
+  for(k = 0; k < nl/2; k++) {
+/*
+ *  Asymptotic estimate of the k-th zero's colatitude.
+ */
+    theta = pi*(4.*k+3.)/(4.*nl+2.);
+    theta = theta + (1./(8.*nl*nl))*(1./tan(theta))*(1. - 1./nl);
+    dpdt  = 1.;
+    for(iter = 0; iter < 100; iter++) {
+      x    = cos(theta);
+      sint = sin(theta);
+/*
+ *  P_nl(x) and P_nl-1(x) by the three-term recurrence, and the
+ *  derivative of P_nl with respect to the colatitude.
+ */
+      p0 = 1.;
+      p1 = x;
+      for(j = 2; j <= nl; j++) {
+        p2 = ((2.*j-1.)*x*p1 - (j-1.)*p0)/j;
+        p0 = p1;
+        p1 = p2;
+      }
+      dpdt   = nl*(x*p1 - p0)/sint;
+      dtheta = p1/dpdt;
+      theta  = theta - dtheta;
+      if(fabs(dtheta) <= 1.e-15) break;
+    }
+/*
+ *  With the derivative taken along the colatitude, the weight is
+ *  2/(dP/dtheta)**2.
+ */
+    values[2*k]   = rtod*theta - 90.;
+    values[2*k+1] = 2./(dpdt*dpdt);
+    values[2*(nl-1-k)]   = 90. - rtod*theta;
+    values[2*(nl-1-k)+1] = values[2*k+1];
+  }
+}
+
 NhlErrorTypes NglGaus (int nlat, double **output)
 {
-  int nl,lwork = 0,i,ierror;
-  double *theta,*wts,*work = NULL;
-  double rtod = (double)180.0/(double)3.14159265358979323846;
-
-  nl    = 2 * nlat;
-  theta = (double*)malloc(sizeof(double)*nl);
-  wts   = (double*)malloc(sizeof(double)*nl);
-  lwork = 4 * nl*(nl+1)+2;
-  work  = (double*)malloc(sizeof(double)*lwork);
-  NGCALLF(gaqdncl,GAQDNCL)(&nl,theta,wts,work,&lwork,&ierror);
-  free(work);
-  *output = (double*)malloc(sizeof(double)*nl*2);
-  for(i = 0; i < nl; i++) {
-    (*output)[2*i]    = rtod*theta[i] - 90.0;
-    (*output)[2*i+1]  = wts[i];
+  int i, nl;
+  double *values = NULL;
+
+  nl = 2 * nlat;
+  if(nlat < 1) {
+    *output = (double*)malloc(sizeof(double)*2);
+    return NhlFATAL;
   }
-  free(wts);
-  free(theta);
+  for(i = 0; i < NGL_GAUS_CACHE; i++) {
+    if(gaus_cache[i].nlat == nlat && gaus_cache[i].values != NULL) {
+      values = gaus_cache[i].values;
+      break;
+    }
+  }
+  if(values == NULL) {
+    values = (double*)malloc(sizeof(double)*nl*2);
+    gaus_newton(nl,values);
+    free(gaus_cache[gaus_next].values);
+    gaus_cache[gaus_next].nlat   = nlat;
+    gaus_cache[gaus_next].values = values;
+    gaus_next = (gaus_next + 1) % NGL_GAUS_CACHE;
+  }
+  *output = (double*)malloc(sizeof(double)*nl*2);
+  memcpy(*output,values,sizeof(double)*nl*2);
 
   return NhlNOERROR;
 }
@@ -213,3 +568,1558 @@ char *c_nngetcp(char *pnam) {
   c_nngetc(pnam,xc);
   return &xc[0];
 }
+
+/*
+ *  Natural neighbor weights, so that values at the same scattered
+ *  points can be gridded for any number of fields.
+ *
+ *  The points are triangulated once (Bowyer-Watson, with "ghost"
+ *  triangles joining each hull edge to a vertex at infinity), and for
+ *  each output point the Sibson weights are found from the triangles
+ *  whose circumcircles contain it: each neighbor's weight is the area
+ *  the output point's Voronoi cell would take from that neighbor's.
+ *  Applying the weights gives the linear natural neighbor
+ *  interpolation natgrid does by default (igr = 0). Output points
+ *  outside the convex hull of the input points get no weights.
+ */
+typedef struct {
+  int v[3];     /* vertices, counterclockwise; npts stands for infinity */
+  int nb[3];    /* nb[i] is the triangle across from v[i] */
+} nn_tri;
+
+typedef struct {
+  int    npts;
+  double *x, *y;
+  nn_tri *tri;
+  int    ntri, maxtri, last;
+  int    *freetri, nfree;
+} nn_mesh;
+
+#define NN_ORIENT(ax,ay,bx,by,cx,cy) (((bx)-(ax))*((cy)-(ay)) - \
+                                      ((by)-(ay))*((cx)-(ax)))
+
+static int nn_ghost(nn_mesh *m, int t) {
+  int k;
+
+  for (k = 0; k < 3; k++) {
+    if (m->tri[t].v[k] == m->npts) return(k);
+  }
+  return(-1);
+}
+
+/*
+ *  Whether (px,py) is inside the circumcircle of triangle t. For a
+ *  ghost triangle that means beyond its hull edge; on_edge says
+ *  whether a point on the hull edge itself counts.
+ */
+static int nn_conflict(nn_mesh *m, int t, double px, double py, int on_edge) {
+  int k, *v = m->tri[t].v;
+  double ax, ay, bx, by, o, adx, ady, bdx, bdy, cdx, cdy;
+
+  k = nn_ghost(m,t);
+  if (k >= 0) {
+    ax = m->x[v[(k+1)%3]];
+    ay = m->y[v[(k+1)%3]];
+    bx = m->x[v[(k+2)%3]];
+    by = m->y[v[(k+2)%3]];
+    o  = NN_ORIENT(ax,ay,bx,by,px,py);
+    if (o > 0.) return(1);
+    if (o < 0. || !on_edge) return(0);
+    return((px-ax)*(px-bx) + (py-ay)*(py-by) < 0.);
+  }
+  adx = m->x[v[0]] - px;
+  ady = m->y[v[0]] - py;
+  bdx = m->x[v[1]] - px;
+  bdy = m->y[v[1]] - py;
+  cdx = m->x[v[2]] - px;
+  cdy = m->y[v[2]] - py;
+  return((adx*adx + ady*ady)*(bdx*cdy - cdx*bdy) +
+         (bdx*bdx + bdy*bdy)*(cdx*ady - adx*cdy) +
+         (cdx*cdx + cdy*cdy)*(adx*bdy - bdx*ady) > 0.);
+}
+
+/*
+ *  Walks from triangle t to the triangle containing (px,py), or to a
+ *  ghost triangle whose hull edge the point is beyond.
+ */
+static int nn_locate(nn_mesh *m, int t, double px, double py) {
+  int i, k, a, b, step, moved;
+
+  for (step = 0; step < 4*m->ntri + 16; step++) {
+    k = nn_ghost(m,t);
+    if (k >= 0) {
+      if (nn_conflict(m,t,px,py,0)) return(t);
+      t = m->tri[t].nb[k];
+      continue;
+    }
+    moved = 0;
+    for (i = 0; i < 3; i++) {
+      a = m->tri[t].v[(i+step+1)%3];
+      b = m->tri[t].v[(i+step+2)%3];
+      if (NN_ORIENT(m->x[a],m->y[a],m->x[b],m->y[b],px,py) < 0.) {
+        t = m->tri[t].nb[(i+step)%3];
+        moved = 1;
+        break;
+      }
+    }
+    if (!moved) return(t);
+  }
+/*
+ *  Rounding kept the walk from getting anywhere; look at every
+ *  triangle instead.
+ */
+  for (t = 0; t < m->ntri; t++) {
+    if (m->tri[t].v[0] >= 0 && nn_conflict(m,t,px,py,0)) return(t);
+  }
+  return(-1);
+}
+
+static int nn_new_tri(nn_mesh *m) {
+  if (m->nfree > 0) return(m->freetri[--m->nfree]);
+  if (m->ntri == m->maxtri) {
+    m->maxtri  = 2*m->maxtri;
+    m->tri     = (nn_tri *) realloc(m->tri,m->maxtri*sizeof(nn_tri));
+    m->freetri = (int *) realloc(m->freetri,m->maxtri*sizeof(int));
+  }
+  return(m->ntri++);
+}
+
+/*
+ *  Adds point ip to the triangulation. The triangles in conflict with
+ *  it (the "cavity") are replaced by triangles joining it to each
+ *  edge of the cavity's boundary. Returns 0 if the point is the same
+ *  as one already added. first and second are work arrays indexed by
+ *  vertex.
+ */
+static int nn_insert(nn_mesh *m, int ip, int **stack, int *maxstack,
+                     int *first, int *second) {
+  int i, j, k, t, n, nt, a, a0, b, ncav, *cav;
+  double px = m->x[ip], py = m->y[ip];
+
+  t = nn_locate(m,m->last,px,py);
+  if (t < 0) return(0);
+  if (nn_ghost(m,t) < 0) {
+    for (k = 0; k < 3; k++) {
+      if (m->x[m->tri[t].v[k]] == px && m->y[m->tri[t].v[k]] == py) {
+        return(0);
+      }
+    }
+  }
+/*
+ *  Find the cavity, marking its triangles by setting v[0] to
+ *  -2-v[0] while they're being looked at.
+ */
+  cav  = *stack;
+  ncav = 0;
+  cav[ncav++] = t;
+  m->tri[t].v[0] = -2 - m->tri[t].v[0];
+  for (i = 0; i < ncav; i++) {
+    for (j = 0; j < 3; j++) {
+      n = m->tri[cav[i]].nb[j];
+      if (m->tri[n].v[0] < 0) continue;
+      if (!nn_conflict(m,n,px,py,1)) continue;
+      if (ncav == *maxstack) {
+        *maxstack = 2*(*maxstack);
+        *stack = cav = (int *) realloc(cav,(*maxstack)*sizeof(int));
+      }
+      cav[ncav++] = n;
+      m->tri[n].v[0] = -2 - m->tri[n].v[0];
+    }
+  }
+/*
+ *  Record the boundary edges: first[a] is the triangle outside the
+ *  edge (a,second[a]).
+ */
+  nt = 0;
+  a0 = -1;
+  for (i = 0; i < ncav; i++) {
+    t = cav[i];
+    for (j = 0; j < 3; j++) {
+      n = m->tri[t].nb[j];
+      if (m->tri[n].v[0] < 0) continue;
+      a = m->tri[t].v[(j+1)%3];
+      b = m->tri[t].v[(j+2)%3];
+      if (a < 0) a = -2 - a;
+      if (b < 0) b = -2 - b;
+      first[a]  = n;
+      second[a] = b;
+      a0 = a;
+      nt++;
+    }
+  }
+  for (i = 0; i < ncav; i++) {
+    m->tri[cav[i]].v[0] = -1;
+    m->freetri[m->nfree++] = cav[i];
+  }
+/*
+ *  Go around the boundary, joining the point to each edge; first[a]
+ *  then becomes the new triangle on edge (a,second[a]).
+ */
+  a = a0;
+  for (i = 0; i < nt; i++) {
+    b = second[a];
+    n = first[a];
+    t = nn_new_tri(m);
+    m->tri[t].v[0]  = a;
+    m->tri[t].v[1]  = b;
+    m->tri[t].v[2]  = ip;
+    m->tri[t].nb[2] = n;
+    for (k = 0; k < 3; k++) {
+      if (m->tri[n].v[(k+1)%3] == b && m->tri[n].v[(k+2)%3] == a) {
+        m->tri[n].nb[k] = t;
+      }
+    }
+    first[a] = t;
+    a = b;
+  }
+/*
+ *  The new triangle on edge (a,b) has the one on edge (b,c) across
+ *  from a, and is across from c in that one.
+ */
+  for (i = 0; i < nt; i++) {
+    b = second[a];
+    t = first[a];
+    m->tri[t].nb[0] = first[b];
+    m->tri[first[b]].nb[1] = t;
+    a = b;
+  }
+  m->last = first[a0];
+  return(1);
+}
+
+static void nn_free_mesh(nn_mesh *m) {
+  free(m->x);
+  free(m->tri);
+  free(m->freetri);
+}
+
+/*
+ *  Triangulates the n points, scaled to about a unit square so that
+ *  the tests above don't depend on the units of x and y. Returns 1 if
+ *  there are fewer than three points, or 2 if they're all on a line.
+ */
+static int nn_triangulate(nn_mesh *m, int n, double *x, double *y,
+                          double *xc, double *yc, double *scale) {
+  int i, i0, i1, i2, k, g0, g1, g2, maxstack, *stack, *first, *second;
+  double xmin, xmax, ymin, ymax;
+
+  memset(m,0,sizeof(nn_mesh));
+  if (n < 3) return(1);
+  xmin = xmax = x[0];
+  ymin = ymax = y[0];
+  for (i = 1; i < n; i++) {
+    if (x[i] < xmin) xmin = x[i];
+    if (x[i] > xmax) xmax = x[i];
+    if (y[i] < ymin) ymin = y[i];
+    if (y[i] > ymax) ymax = y[i];
+  }
+  *xc    = 0.5*(xmin + xmax);
+  *yc    = 0.5*(ymin + ymax);
+  *scale = xmax - xmin > ymax - ymin ? xmax - xmin : ymax - ymin;
+  if (*scale <= 0.) return(2);
+
+  m->npts = n;
+  m->x    = (double *) malloc(2*n*sizeof(double));
+  m->y    = &m->x[n];
+  for (i = 0; i < n; i++) {
+    m->x[i] = (x[i] - *xc)/(*scale);
+    m->y[i] = (y[i] - *yc)/(*scale);
+  }
+/*
+ *  Start with the first three points that aren't on a line, and the
+ *  ghost triangles on their edges.
+ */
+  i0 = 0;
+  for (i1 = 1; i1 < n; i1++) {
+    if (m->x[i1] != m->x[i0] || m->y[i1] != m->y[i0]) break;
+  }
+  for (i2 = i1+1; i2 < n; i2++) {
+    if (NN_ORIENT(m->x[i0],m->y[i0],m->x[i1],m->y[i1],
+                  m->x[i2],m->y[i2]) != 0.) break;
+  }
+  if (i2 >= n) {
+    free(m->x);
+    return(2);
+  }
+  if (NN_ORIENT(m->x[i0],m->y[i0],m->x[i1],m->y[i1],
+                m->x[i2],m->y[i2]) < 0.) {
+    k  = i1;
+    i1 = i2;
+    i2 = k;
+  }
+  m->maxtri  = 2*n + 8;
+  m->tri     = (nn_tri *) malloc(m->maxtri*sizeof(nn_tri));
+  m->freetri = (int *) malloc(m->maxtri*sizeof(int));
+  m->ntri    = 4;
+  g0 = 1;
+  g1 = 2;
+  g2 = 3;
+  m->tri[0].v[0] = i0;  m->tri[0].v[1] = i1;  m->tri[0].v[2] = i2;
+  m->tri[0].nb[0] = g0; m->tri[0].nb[1] = g1; m->tri[0].nb[2] = g2;
+  m->tri[g0].v[0] = i2; m->tri[g0].v[1] = i1; m->tri[g0].v[2] = n;
+  m->tri[g0].nb[0] = g2; m->tri[g0].nb[1] = g1; m->tri[g0].nb[2] = 0;
+  m->tri[g1].v[0] = i0; m->tri[g1].v[1] = i2; m->tri[g1].v[2] = n;
+  m->tri[g1].nb[0] = g0; m->tri[g1].nb[1] = g2; m->tri[g1].nb[2] = 0;
+  m->tri[g2].v[0] = i1; m->tri[g2].v[1] = i0; m->tri[g2].v[2] = n;
+  m->tri[g2].nb[0] = g1; m->tri[g2].nb[1] = g0; m->tri[g2].nb[2] = 0;
+
+  maxstack = 64;
+  stack    = (int *) malloc(maxstack*sizeof(int));
+  first    = (int *) malloc(2*(n+1)*sizeof(int));
+  second   = &first[n+1];
+  for (i = 0; i < n; i++) {
+    if (i != i0 && i != i1 && i != i2) {
+      nn_insert(m,i,&stack,&maxstack,first,second);
+    }
+  }
+  free(stack);
+  free(first);
+  return(0);
+}
+
+/*
+ *  The center of the circle through three points.
+ */
+static int nn_circumcenter(double ax, double ay, double bx, double by,
+                           double cx, double cy, double *ux, double *uy) {
+  double d, b2, c2;
+
+  bx -= ax;
+  by -= ay;
+  cx -= ax;
+  cy -= ay;
+  d = 2.*(bx*cy - by*cx);
+  b2 = bx*bx + by*by;
+  c2 = cx*cx + cy*cy;
+  if (fabs(d) <= 1.e-12*(b2 > c2 ? b2 : c2)) return(0);
+  *ux = ax + (cy*b2 - by*c2)/d;
+  *uy = ay + (bx*c2 - cx*b2)/d;
+  return(1);
+}
+
+/*
+ *  Work space for nn_sibson, one per thread.
+ */
+typedef struct {
+  int    maxcav, maxnbr;
+  int    *cav, *nbr;
+  double *cen, *wts;
+} nn_work;
+
+/*
+ *  The natural neighbors of (px,py), and their Sibson weights, in
+ *  work->nbr and work->wts, given a triangle to start looking from
+ *  (*hint, which is updated). Returns the number of neighbors, 0 if
+ *  the point is outside the convex hull, or -1 if it's too close to
+ *  the hull for the weights to be found.
+ */
+static int nn_sibson(nn_mesh *m, int *hint, double px, double py,
+                     nn_work *work)
+{
+  int i, j, k, t, n, ncav, nnbr, e, v, u, *tv;
+  double cx, cy, ax, ay, mx, my, area, sum;
+
+  t = nn_locate(m,*hint,px,py);
+  if (t < 0) return(0);
+  k = nn_ghost(m,t);
+  if (k >= 0) {
+    u  = m->tri[t].v[(k+1)%3];
+    v  = m->tri[t].v[(k+2)%3];
+    ax = m->x[v] - m->x[u];
+    ay = m->y[v] - m->y[u];
+    if (NN_ORIENT(m->x[u],m->y[u],m->x[v],m->y[v],px,py) <=
+        1.e-10*(ax*ax + ay*ay)) return(-1);
+    return(0);
+  }
+  *hint = t;
+  tv = m->tri[t].v;
+  for (k = 0; k < 3; k++) {
+    if (m->x[tv[k]] == px && m->y[tv[k]] == py) {
+      work->nbr[0] = tv[k];
+      work->wts[0] = 1.;
+      return(1);
+    }
+  }
+/*
+ *  The cavity, as for nn_insert, with the circumcenters of its
+ *  triangles taken relative to the point. Points on the hull don't
+ *  conflict with the ghost triangles here.
+ */
+  ncav = 0;
+  work->cav[ncav++] = t;
+  for (i = 0; i < ncav; i++) {
+    for (j = 0; j < 3; j++) {
+      n = m->tri[work->cav[i]].nb[j];
+      for (k = 0; k < ncav; k++) {
+        if (work->cav[k] == n) break;
+      }
+      if (k < ncav || !nn_conflict(m,n,px,py,0)) continue;
+      if (nn_ghost(m,n) >= 0) return(-1);
+      if (ncav == work->maxcav) {
+        work->maxcav = 2*work->maxcav;
+        work->cav = (int *) realloc(work->cav,work->maxcav*sizeof(int));
+        work->cen = (double *) realloc(work->cen,
+                                       2*work->maxcav*sizeof(double));
+      }
+      work->cav[ncav++] = n;
+    }
+  }
+  for (i = 0; i < ncav; i++) {
+    tv = m->tri[work->cav[i]].v;
+    if (!nn_circumcenter(m->x[tv[0]]-px,m->y[tv[0]]-py,
+                         m->x[tv[1]]-px,m->y[tv[1]]-py,
+                         m->x[tv[2]]-px,m->y[tv[2]]-py,
+                         &work->cen[2*i],&work->cen[2*i+1])) return(-1);
+  }
+/*
+ *  The area the point's Voronoi cell takes from neighbor v is the
+ *  polygon from the center of the circle through the point, v and
+ *  the neighbor before v on the cavity boundary, through the old
+ *  Voronoi vertices of v (the circumcenters of the cavity triangles
+ *  around v), to the center of the circle through the point, v and
+ *  the neighbor after v, and back along the line between the point
+ *  and v, which goes through their midpoint (mx,my). With the point
+ *  at the origin, its area is a sum of terms from each cavity
+ *  triangle around v.
+ */
+  nnbr = 0;
+  sum  = 0.;
+  for (i = 0; i < ncav; i++) {
+    t  = work->cav[i];
+    tv = m->tri[t].v;
+    cx = work->cen[2*i];
+    cy = work->cen[2*i+1];
+    for (k = 0; k < 3; k++) {
+      v    = tv[k];
+      mx   = 0.5*(m->x[v] - px);
+      my   = 0.5*(m->y[v] - py);
+      area = 0.;
+/*
+ *  Edge (v,u), across from the third vertex: the start of v's polygon
+ *  if it's on the cavity boundary.
+ */
+      u = tv[(k+1)%3];
+      n = m->tri[t].nb[(k+2)%3];
+      for (e = 0; e < ncav; e++) {
+        if (work->cav[e] == n) break;
+      }
+      if (e == ncav) {
+        if (!nn_circumcenter(0.,0.,m->x[v]-px,m->y[v]-py,
+                             m->x[u]-px,m->y[u]-py,&ax,&ay)) return(-1);
+        area += mx*ay - my*ax + ax*cy - ay*cx;
+      }
+/*
+ *  Edge (w,v), across from u: on to the next cavity triangle around
+ *  v, or the end of v's polygon.
+ */
+      u = tv[(k+2)%3];
+      n = m->tri[t].nb[(k+1)%3];
+      for (e = 0; e < ncav; e++) {
+        if (work->cav[e] == n) break;
+      }
+      if (e < ncav) {
+        area += cx*work->cen[2*e+1] - cy*work->cen[2*e];
+      }
+      else {
+        if (!nn_circumcenter(0.,0.,m->x[v]-px,m->y[v]-py,
+                             m->x[u]-px,m->y[u]-py,&ax,&ay)) return(-1);
+        area += cx*ay - cy*ax + ax*my - ay*mx;
+      }
+      for (j = 0; j < nnbr; j++) {
+        if (work->nbr[j] == v) break;
+      }
+      if (j == nnbr) {
+        if (nnbr == work->maxnbr) {
+          work->maxnbr = 2*work->maxnbr;
+          work->nbr = (int *) realloc(work->nbr,work->maxnbr*sizeof(int));
+          work->wts = (double *) realloc(work->wts,
+                                         work->maxnbr*sizeof(double));
+        }
+        work->nbr[nnbr]   = v;
+        work->wts[nnbr++] = 0.;
+      }
+      work->wts[j] += area;
+      sum += area;
+    }
+  }
+  if (!(sum != 0.) || sum != sum) return(-1);
+  for (j = 0; j < nnbr; j++) work->wts[j] /= sum;
+  return(nnbr);
+}
+
+/*
+ *  The weights found by one thread in c_nnweights, for all of its
+ *  output points one after another.
+ */
+typedef struct {
+  int    n, max;
+  int    *idx;
+  double *wts;
+} nn_found;
+
+/*
+ *  Natural neighbor weights for interpolating from the n points
+ *  (x,y) to the grid xo (nxo values) by yo (nyo values). Output point
+ *  i*nyo+j, at (xo[i],yo[j]), is the sum of wts[k]*z[idx[k]] for k
+ *  from ptr[i*nyo+j] up to ptr[i*nyo+j+1]; points outside the convex
+ *  hull of the input have no weights. Points with the same x and y as
+ *  an earlier one are left out. ptr, idx and wts are allocated here.
+ *
+ *  Returns 0, or 1 if there are fewer than three points, 2 if the
+ *  points are all on one line, or 3 if memory runs out.
+ */
+int c_nnweights(int n, double *x, double *y, int nxo, int nyo,
+                double *xo, double *yo, int **ptr, int **idx, double **wts)
+{
+  int ier, i, k, nout, nthr, nomem, *cnt, *own, *start;
+  double xc, yc, scale;
+  nn_found *found;
+  nn_mesh m;
+
+  ier = nn_triangulate(&m,n,x,y,&xc,&yc,&scale);
+  if (ier != 0) return(ier);
+
+  nthr = 1;
+#ifdef _OPENMP
+  nthr = omp_get_max_threads();
+#endif
+  nout  = nxo*nyo;
+  nomem = 0;
+  cnt   = (int *) calloc(nout > 0 ? nout : 1,sizeof(int));
+  own   = (int *) malloc((nout > 0 ? nout : 1)*sizeof(int));
+  start = (int *) malloc((nout > 0 ? nout : 1)*sizeof(int));
+  found = (nn_found *) calloc(nthr,sizeof(nn_found));
+  if (cnt == NULL || own == NULL || start == NULL || found == NULL) {
+    free(cnt);
+    free(own);
+    free(start);
+    free(found);
+    nn_free_mesh(&m);
+    return(3);
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel private(k)
+#endif
+  {
+    int j, ip, hint, nnbr, tid = 0;
+    double px, py;
+    nn_work work;
+    nn_found *f;
+    static const double dx[4] = { 1., -1., -1.,  1.};
+    static const double dy[4] = { 1.,  1., -1., -1.};
+
+#ifdef _OPENMP
+    tid = omp_get_thread_num();
+#endif
+    f = &found[tid];
+    work.maxcav = work.maxnbr = 32;
+    work.cav = (int *) malloc(work.maxcav*sizeof(int));
+    work.cen = (double *) malloc(2*work.maxcav*sizeof(double));
+    work.nbr = (int *) malloc(work.maxnbr*sizeof(int));
+    work.wts = (double *) malloc(work.maxnbr*sizeof(double));
+    hint = m.last;
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,16)
+#endif
+    for (i = 0; i < nxo; i++) {
+      for (j = 0; j < nyo; j++) {
+        ip = i*nyo + j;
+        px = (xo[i] - xc)/scale;
+        py = (yo[j] - yc)/scale;
+        nnbr = nn_sibson(&m,&hint,px,py,&work);
+/*
+ *  A point on the hull has circles through it and the ends of the
+ *  hull edge that are infinitely large; move it off the edge a little,
+ *  in whichever direction is inside.
+ */
+        for (k = 0; k < 4 && nnbr < 0; k++) {
+          nnbr = nn_sibson(&m,&hint,px+1.e-8*dx[k],py+1.e-8*dy[k],&work);
+          if (nnbr == 0) nnbr = -1;
+        }
+        if (nnbr <= 0) continue;
+/*
+ *  The weights go on the end of this thread's list, which grows by
+ *  doubling.
+ */
+        if (f->n + nnbr > f->max) {
+          int    max  = 2*(f->n + nnbr) > 1024 ? 2*(f->n + nnbr) : 1024;
+          int    *fi  = (int *) realloc(f->idx,max*sizeof(int));
+          double *fw;
+
+          if (fi != NULL) f->idx = fi;
+          fw = (double *) realloc(f->wts,max*sizeof(double));
+          if (fw != NULL) f->wts = fw;
+          if (fi == NULL || fw == NULL) {
+            nomem = 1;
+            continue;
+          }
+          f->max = max;
+        }
+        cnt[ip]   = nnbr;
+        own[ip]   = tid;
+        start[ip] = f->n;
+        memcpy(&f->idx[f->n],work.nbr,nnbr*sizeof(int));
+        memcpy(&f->wts[f->n],work.wts,nnbr*sizeof(double));
+        f->n += nnbr;
+      }
+    }
+    free(work.cav);
+    free(work.cen);
+    free(work.nbr);
+    free(work.wts);
+  }
+  nn_free_mesh(&m);
+/*
+ *  Pack the weights in output point order.
+ */
+  *ptr = *idx = NULL;
+  *wts = NULL;
+  if (!nomem) {
+    *ptr = (int *) malloc((nout+1)*sizeof(int));
+  }
+  if (*ptr != NULL) {
+    (*ptr)[0] = 0;
+    for (i = 0; i < nout; i++) (*ptr)[i+1] = (*ptr)[i] + cnt[i];
+    *idx = (int *) malloc(((*ptr)[nout] > 0 ? (*ptr)[nout] : 1)*sizeof(int));
+    *wts = (double *) malloc(((*ptr)[nout] > 0 ? (*ptr)[nout] : 1)*
+                             sizeof(double));
+  }
+  if (*idx == NULL || *wts == NULL) {
+    free(*ptr);
+    free(*idx);
+    free(*wts);
+    *ptr = *idx = NULL;
+    *wts = NULL;
+    ier  = 3;
+  }
+  else {
+    for (i = 0; i < nout; i++) {
+      if (cnt[i] == 0) continue;
+      memcpy(&(*idx)[(*ptr)[i]],&found[own[i]].idx[start[i]],
+             cnt[i]*sizeof(int));
+      memcpy(&(*wts)[(*ptr)[i]],&found[own[i]].wts[start[i]],
+             cnt[i]*sizeof(double));
+    }
+  }
+  for (k = 0; k < nthr; k++) {
+    free(found[k].idx);
+    free(found[k].wts);
+  }
+  free(found);
+  free(cnt);
+  free(own);
+  free(start);
+  return(ier);
+}
+
+/*
+ *  Applies weights from c_nnweights to nfld fields of nin values
+ *  each (z is nfld x nin), giving nfld x nout values in zo. Output
+ *  points with no weights get fill.
+ */
+void c_nnapply(int nout, int *ptr, int *idx, double *wts, int nin,
+               int nfld, double *z, double fill, double *zo)
+{
+  int i, f, k;
+  double sum;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(f,k,sum) schedule(static)
+#endif
+  for (i = 0; i < nout; i++) {
+    for (f = 0; f < nfld; f++) {
+      if (ptr[i] == ptr[i+1]) {
+        zo[(size_t)f*nout+i] = fill;
+        continue;
+      }
+      sum = 0.;
+      for (k = ptr[i]; k < ptr[i+1]; k++) {
+        sum += wts[k]*z[(size_t)f*nin+idx[k]];
+      }
+      zo[(size_t)f*nout+i] = sum;
+    }
+  }
+}
+
+/*
+ *  A smooth surface through values at fixed points on the sphere, for
+ *  gridding any number of fields at the same points, or one field to
+ *  any number of output grids.
+ *
+ *  This is not cssgrid, and doesn't give cssgrid's values. The
+ *  surface is a C1 interpolant of Renka's kind on the Delaunay
+ *  triangulation of the points (from c_csstri), built from the values
+ *  and estimated gradients at the points: along each side of a
+ *  triangle it is the cubic Hermite interpolant of the values and
+ *  gradients at the ends, and inside it is a blend of Hermite cubics
+ *  from each vertex to the opposite side. There is no tension. The
+ *  gradient at each point is a weighted least squares fit of a
+ *  quadratic to the values at its nearest neighbors; since that is
+ *  linear in the values, the coefficients are found once, when the
+ *  surface is made. (cssgrid fits the gradients globally for each
+ *  field, with tension, which can't be set up once for all fields.)
+ *  Points outside the triangulation (when the input points don't
+ *  cover the sphere) are extrapolated linearly from the nearest point
+ *  on its boundary.
+ */
+#define NGL_CSS_NLS 10    /* points used for each gradient estimate */
+
+typedef struct {
+  int    n, ntri, nbdy;
+  double *xyz;            /* unit vectors to the points */
+  int    *tri, *nbr;      /* triangles, counterclockwise from outside,
+                             and the triangle across from each vertex */
+  int    *bdy;            /* boundary edges, if any */
+  int    *gcnt, *gidx;    /* points used for each gradient ... */
+  double *gwts;           /* ... and their coefficients (3-vectors) */
+} nglSphSurf;
+
+#define CSS_DOT(a,b)  ((a)[0]*(b)[0] + (a)[1]*(b)[1] + (a)[2]*(b)[2])
+#define CSS_DET(a,b,c) ((a)[0]*((b)[1]*(c)[2] - (b)[2]*(c)[1]) - \
+                        (a)[1]*((b)[0]*(c)[2] - (b)[2]*(c)[0]) + \
+                        (a)[2]*((b)[0]*(c)[1] - (b)[1]*(c)[0]))
+
+static void css_cross(double *a, double *b, double *c) {
+  c[0] = a[1]*b[2] - a[2]*b[1];
+  c[1] = a[2]*b[0] - a[0]*b[2];
+  c[2] = a[0]*b[1] - a[1]*b[0];
+}
+
+static double css_arc(double *a, double *b) {
+  double c[3];
+
+  css_cross(a,b,c);
+  return(atan2(sqrt(CSS_DOT(c,c)),CSS_DOT(a,b)));
+}
+
+static void css_unit(double *a) {
+  double r = sqrt(CSS_DOT(a,a));
+
+  if (r > 0.) {
+    a[0] /= r;
+    a[1] /= r;
+    a[2] /= r;
+  }
+}
+
+/*
+ *  The unit tangent at a of the great circle arc from a to b.
+ */
+static void css_tangent(double *a, double *b, double *t) {
+  double c = CSS_DOT(a,b);
+
+  t[0] = b[0] - c*a[0];
+  t[1] = b[1] - c*a[1];
+  t[2] = b[2] - c*a[2];
+  css_unit(t);
+}
+
+/*
+ *  The cubic Hermite interpolant, at distance s along an arc of
+ *  length len, of values fa and fb and derivatives da and db (along
+ *  the arc) at its ends. Returns the value, and the derivative in
+ *  *ds if ds isn't NULL.
+ */
+static double css_hermite(double fa, double da, double fb, double db,
+                          double len, double s, double *ds) {
+  double t = s/len, t2 = t*t, t3 = t2*t;
+
+  if (ds != NULL) {
+    *ds = ((6.*t2 - 6.*t)*(fa - fb))/len + (3.*t2 - 4.*t + 1.)*da +
+          (3.*t2 - 2.*t)*db;
+  }
+  return((2.*t3 - 3.*t2 + 1.)*fa + (t3 - 2.*t2 + t)*len*da +
+         (3.*t2 - 2.*t3)*fb + (t3 - t2)*len*db);
+}
+
+/*
+ *  The value of the surface at q on the side from point j to point k,
+ *  and its gradient there (a tangent vector at q) in gq: the Hermite
+ *  interpolant along the side, and a linear blend of the gradients at
+ *  the ends across it.
+ */
+static double css_side(nglSphSurf *s, double *f, double *g, int j, int k,
+                       double *q, double *gq) {
+  double *a = &s->xyz[3*j], *b = &s->xyz[3*k], ta[3], tb[3], te[3];
+  double nrm[3], len, sq, lam, fq, dt, dn;
+  int i;
+
+  len = css_arc(a,b);
+  sq  = css_arc(a,q);
+  css_tangent(a,b,ta);
+  css_tangent(b,a,tb);
+  fq  = css_hermite(f[j],CSS_DOT(&g[3*j],ta),f[k],-CSS_DOT(&g[3*k],tb),
+                    len,sq,&dt);
+  css_cross(a,b,nrm);
+  css_unit(nrm);
+  css_cross(nrm,q,te);
+  lam = sq/len;
+  dn  = 0.;
+  for (i = 0; i < 3; i++) {
+    dn += ((1.-lam)*g[3*j+i] + lam*g[3*k+i])*nrm[i];
+  }
+  for (i = 0; i < 3; i++) {
+    gq[i] = dt*te[i] + dn*nrm[i];
+  }
+  return(fq);
+}
+
+/*
+ *  The value of the surface at p, in triangle t.
+ */
+static double css_triangle(nglSphSurf *s, double *f, double *g, int t,
+                           double *p) {
+  int i, j, k, *v = &s->tri[3*t];
+  double *vi, b[3], w[3], q[3], ti[3], u[3], gq[3], fi, fq, lr, wsum, val;
+
+  vi   = &s->xyz[3*v[0]];
+  b[0] = CSS_DET(p,&s->xyz[3*v[1]],&s->xyz[3*v[2]]);
+  b[1] = CSS_DET(vi,p,&s->xyz[3*v[2]]);
+  b[2] = CSS_DET(vi,&s->xyz[3*v[1]],p);
+  for (i = 0; i < 3; i++) {
+    if (b[i] < 0.) b[i] = 0.;
+  }
+  w[0] = b[1]*b[1]*b[2]*b[2];
+  w[1] = b[0]*b[0]*b[2]*b[2];
+  w[2] = b[0]*b[0]*b[1]*b[1];
+  wsum = w[0] + w[1] + w[2];
+  if (wsum <= 0.) {
+/*
+ *  At (or rounded to) a vertex, or on a side.
+ */
+    i = b[0] >= b[1] ? (b[0] >= b[2] ? 0 : 2) : (b[1] >= b[2] ? 1 : 2);
+    j = (i+1)%3;
+    k = (i+2)%3;
+    if (b[j] <= 0. && b[k] <= 0.) return(f[v[i]]);
+    if (b[k] <= 0.) {
+      k = i;
+    }
+    else {
+      j = i;
+    }
+    return(css_side(s,f,g,v[j],v[k],p,gq));
+  }
+  val = 0.;
+  for (i = 0; i < 3; i++) {
+    if (w[i] <= 0.) continue;
+    j  = (i+1)%3;
+    k  = (i+2)%3;
+    vi = &s->xyz[3*v[i]];
+    q[0] = b[j]*s->xyz[3*v[j]]   + b[k]*s->xyz[3*v[k]];
+    q[1] = b[j]*s->xyz[3*v[j]+1] + b[k]*s->xyz[3*v[k]+1];
+    q[2] = b[j]*s->xyz[3*v[j]+2] + b[k]*s->xyz[3*v[k]+2];
+    css_unit(q);
+    fq = css_side(s,f,g,v[j],v[k],q,gq);
+/*
+ *  The Hermite interpolant from the vertex to q, through p.
+ */
+    lr = css_arc(vi,q);
+    css_tangent(vi,q,ti);
+    css_tangent(q,vi,u);
+    fi = css_hermite(f[v[i]],CSS_DOT(&g[3*v[i]],ti),fq,-CSS_DOT(gq,u),
+                     lr,css_arc(vi,p),NULL);
+    val += w[i]*fi;
+  }
+  return(val/wsum);
+}
+
+/*
+ *  The value of the surface at p outside the triangulation, from the
+ *  value and gradient at the nearest point of its boundary.
+ */
+static double css_outside(nglSphSurf *s, double *f, double *g, double *p) {
+  int e, a, b, ebest = -1, atend = -1, end;
+  double nrm[3], q[3], qbest[3], c[3], d, dbest = 4., pn, gq[3], u[3], fq;
+
+  for (e = 0; e < s->nbdy; e++) {
+    a = s->bdy[2*e];
+    b = s->bdy[2*e+1];
+    css_cross(&s->xyz[3*a],&s->xyz[3*b],nrm);
+    css_unit(nrm);
+    pn   = CSS_DOT(p,nrm);
+    q[0] = p[0] - pn*nrm[0];
+    q[1] = p[1] - pn*nrm[1];
+    q[2] = p[2] - pn*nrm[2];
+    css_unit(q);
+    css_cross(&s->xyz[3*a],q,c);
+    end = -1;
+    if (CSS_DOT(c,nrm) < 0.) end = a;
+    css_cross(q,&s->xyz[3*b],c);
+    if (CSS_DOT(c,nrm) < 0.) end = b;
+    if (end >= 0) memcpy(q,&s->xyz[3*end],3*sizeof(double));
+    d = css_arc(p,q);
+    if (d < dbest) {
+      dbest = d;
+      ebest = e;
+      atend = end;
+      memcpy(qbest,q,3*sizeof(double));
+    }
+  }
+  if (ebest < 0) return(0.);
+  if (atend >= 0) {
+    fq = f[atend];
+    memcpy(gq,&g[3*atend],3*sizeof(double));
+  }
+  else {
+    fq = css_side(s,f,g,s->bdy[2*ebest],s->bdy[2*ebest+1],qbest,gq);
+  }
+  css_tangent(qbest,p,u);
+  return(fq + dbest*CSS_DOT(gq,u));
+}
+
+/*
+ *  Walks from triangle t to the triangle containing p. Returns -1 if
+ *  p is outside the triangulation. Points within rounding of a side
+ *  (such as the points themselves) count as inside.
+ */
+#define CSS_EPS 1.e-14
+
+static int css_locate(nglSphSurf *s, int t, double *p) {
+  int e, step, moved, *v;
+
+  for (step = 0; step < 4*s->ntri + 16; step++) {
+    v = &s->tri[3*t];
+    moved = 0;
+    for (e = 0; e < 3; e++) {
+      if (CSS_DET(&s->xyz[3*v[(e+step+1)%3]],
+                  &s->xyz[3*v[(e+step+2)%3]],p) < -CSS_EPS) {
+        t = s->nbr[3*t+(e+step)%3];
+        if (t < 0) return(-1);
+        moved = 1;
+        break;
+      }
+    }
+    if (!moved) return(t);
+  }
+  for (t = 0; t < s->ntri; t++) {
+    v = &s->tri[3*t];
+    if (CSS_DET(&s->xyz[3*v[0]],&s->xyz[3*v[1]],p) >= -CSS_EPS &&
+        CSS_DET(&s->xyz[3*v[1]],&s->xyz[3*v[2]],p) >= -CSS_EPS &&
+        CSS_DET(&s->xyz[3*v[2]],&s->xyz[3*v[0]],p) >= -CSS_EPS) return(t);
+  }
+  return(-1);
+}
+
+typedef struct {
+  int a, b, t, e;
+} css_edge;
+
+static int css_edge_cmp(const void *p1, const void *p2) {
+  const css_edge *e1 = (const css_edge *) p1, *e2 = (const css_edge *) p2;
+
+  if (e1->a != e2->a) return(e1->a < e2->a ? -1 : 1);
+  if (e1->b != e2->b) return(e1->b < e2->b ? -1 : 1);
+  return(0);
+}
+
+/*
+ *  The coefficients of the gradient estimate at point k: the gradient
+ *  is the sum of wts[j]*(f[idx[j]] - f[k]) (3-vectors) over the
+ *  points used, whose number is returned. nb holds the candidate points (the neighbors of k and
+ *  theirs), of which the NGL_CSS_NLS nearest are used.
+ */
+static int css_grad_coefs(nglSphSurf *s, int k, int *nb, int nnb,
+                          int *idx, double *wts) {
+  int i, j, m, r, c, nuse, npar;
+  double *vk = &s->xyz[3*k], e1[3], e2[3], d[NGL_CSS_NLS], x, y, cs, rmax;
+  double row[NGL_CSS_NLS][5], sw, mat[5][5], rhs[5][NGL_CSS_NLS], piv;
+/*
+ *  The nearest candidates, by insertion.
+ */
+  nuse = 0;
+  for (i = 0; i < nnb; i++) {
+    x = css_arc(vk,&s->xyz[3*nb[i]]);
+    if (CSS_DOT(vk,&s->xyz[3*nb[i]]) <= 0.05) continue;
+    for (j = nuse; j > 0 && d[j-1] > x; j--) {
+      if (j < NGL_CSS_NLS) {
+        d[j]   = d[j-1];
+        idx[j] = idx[j-1];
+      }
+    }
+    if (j < NGL_CSS_NLS) {
+      d[j]   = x;
+      idx[j] = nb[i];
+      if (nuse < NGL_CSS_NLS) nuse++;
+    }
+  }
+  if (nuse < 2) return(0);
+/*
+ *  Gnomonic coordinates in the tangent plane at k.
+ */
+  i = fabs(vk[0]) <= fabs(vk[1]) ? (fabs(vk[0]) <= fabs(vk[2]) ? 0 : 2) :
+                                   (fabs(vk[1]) <= fabs(vk[2]) ? 1 : 2);
+  e1[0] = e1[1] = e1[2] = 0.;
+  e1[i] = 1.;
+  css_tangent(vk,e1,e1);
+  css_cross(vk,e1,e2);
+  rmax = 1.05*d[nuse-1];
+  for (j = 0; j < nuse; j++) {
+    cs = CSS_DOT(vk,&s->xyz[3*idx[j]]);
+    x  = CSS_DOT(e1,&s->xyz[3*idx[j]])/cs;
+    y  = CSS_DOT(e2,&s->xyz[3*idx[j]])/cs;
+    sw = (rmax - d[j])/(rmax*d[j]);
+    row[j][0] = sw*x;
+    row[j][1] = sw*y;
+    row[j][2] = sw*x*x;
+    row[j][3] = sw*x*y;
+    row[j][4] = sw*y*y;
+    d[j] = sw;
+  }
+/*
+ *  Solve the normal equations for a quadratic (or, with too few
+ *  points or if that fails, a plane) by Cholesky decomposition; the
+ *  right hand sides are the rows of the identity, so the first two
+ *  rows of the solution are the gradient coefficients.
+ */
+  for (npar = nuse >= 5 ? 5 : 2; npar >= 2; npar -= 3) {
+    for (r = 0; r < npar; r++) {
+      for (c = 0; c < npar; c++) {
+        mat[r][c] = 0.;
+        for (j = 0; j < nuse; j++) mat[r][c] += row[j][r]*row[j][c];
+      }
+      for (j = 0; j < nuse; j++) rhs[r][j] = row[j][r]*d[j];
+    }
+    piv = 1.e-12*(mat[0][0] + mat[1][1]);
+    for (c = 0; c < npar; c++) {
+      for (m = 0; m < c; m++) mat[c][c] -= mat[c][m]*mat[c][m];
+      if (mat[c][c] <= piv) break;
+      mat[c][c] = sqrt(mat[c][c]);
+      for (r = c+1; r < npar; r++) {
+        for (m = 0; m < c; m++) mat[r][c] -= mat[r][m]*mat[c][m];
+        mat[r][c] /= mat[c][c];
+      }
+    }
+    if (c < npar) continue;
+    for (j = 0; j < nuse; j++) {
+      for (r = 0; r < npar; r++) {
+        for (m = 0; m < r; m++) rhs[r][j] -= mat[r][m]*rhs[m][j];
+        rhs[r][j] /= mat[r][r];
+      }
+      for (r = npar-1; r >= 0; r--) {
+        for (m = r+1; m < npar; m++) rhs[r][j] -= mat[m][r]*rhs[m][j];
+        rhs[r][j] /= mat[r][r];
+      }
+      for (i = 0; i < 3; i++) {
+        wts[3*j+i] = rhs[0][j]*e1[i] + rhs[1][j]*e2[i];
+      }
+    }
+    return(nuse);
+  }
+  return(0);
+}
+
+/*
+ *  Makes the surface for the n points (rlat,rlon), in degrees.
+ *  Returns NULL, with the error from c_csstri in *ier, if they can't
+ *  be triangulated.
+ */
+void *c_cssfit(int n, double *rlat, double *rlon, int *ier) {
+  nglSphSurf *s;
+  float *flat, *flon;
+  int i, j, k, e, nedge, *tri, *ptr, *adj, *cnt;
+  double d2r = 0.017453292519943295;
+  css_edge *edges;
+
+  *ier = 0;
+  flat = (float *) malloc(2*(n > 0 ? n : 1)*sizeof(float));
+  flon = &flat[n];
+  for (i = 0; i < n; i++) {
+    flat[i] = (float) rlat[i];
+    flon[i] = (float) rlon[i];
+  }
+  s = (nglSphSurf *) calloc(1,sizeof(nglSphSurf));
+  tri = c_csstri(n,flat,flon,&s->ntri,ier);
+  free(flat);
+  if (*ier != 0 || tri == NULL || s->ntri <= 0) {
+    if (*ier == 0) *ier = -1;
+    free(tri);
+    free(s);
+    return(NULL);
+  }
+  s->n   = n;
+  s->tri = tri;
+  s->xyz = (double *) malloc(3*n*sizeof(double));
+  for (i = 0; i < n; i++) {
+    s->xyz[3*i]   = cos(d2r*rlat[i])*cos(d2r*rlon[i]);
+    s->xyz[3*i+1] = cos(d2r*rlat[i])*sin(d2r*rlon[i]);
+    s->xyz[3*i+2] = sin(d2r*rlat[i]);
+  }
+/*
+ *  Orient the triangles counterclockwise (seen from outside), and
+ *  find their neighbors by sorting their edges.
+ */
+  nedge = 3*s->ntri;
+  edges = (css_edge *) malloc(nedge*sizeof(css_edge));
+  for (i = 0; i < s->ntri; i++) {
+    if (CSS_DET(&s->xyz[3*tri[3*i]],&s->xyz[3*tri[3*i+1]],
+                &s->xyz[3*tri[3*i+2]]) < 0.) {
+      j = tri[3*i+1];
+      tri[3*i+1] = tri[3*i+2];
+      tri[3*i+2] = j;
+    }
+    for (e = 0; e < 3; e++) {
+      j = tri[3*i+(e+1)%3];
+      k = tri[3*i+(e+2)%3];
+      edges[3*i+e].a = j < k ? j : k;
+      edges[3*i+e].b = j < k ? k : j;
+      edges[3*i+e].t = i;
+      edges[3*i+e].e = e;
+    }
+  }
+  qsort(edges,nedge,sizeof(css_edge),css_edge_cmp);
+  s->nbr = (int *) malloc(nedge*sizeof(int));
+  s->bdy = (int *) malloc(2*nedge*sizeof(int));
+  for (i = 0; i < nedge; i++) s->nbr[i] = -1;
+  for (i = 0; i < nedge; i++) {
+    if (i+1 < nedge && edges[i+1].a == edges[i].a &&
+        edges[i+1].b == edges[i].b) {
+      s->nbr[3*edges[i].t+edges[i].e]     = edges[i+1].t;
+      s->nbr[3*edges[i+1].t+edges[i+1].e] = edges[i].t;
+      i++;
+    }
+    else {
+      j = edges[i].t;
+      e = edges[i].e;
+      s->bdy[2*s->nbdy]   = tri[3*j+(e+1)%3];
+      s->bdy[2*s->nbdy+1] = tri[3*j+(e+2)%3];
+      s->nbdy++;
+    }
+  }
+/*
+ *  The neighbors of each point, from the edges.
+ */
+  cnt = (int *) calloc(n+1,sizeof(int));
+  for (i = 0; i < nedge; i++) {
+    if (i+1 < nedge && edges[i+1].a == edges[i].a &&
+        edges[i+1].b == edges[i].b) continue;
+    cnt[edges[i].a+1]++;
+    cnt[edges[i].b+1]++;
+  }
+  for (i = 0; i < n; i++) cnt[i+1] += cnt[i];
+  ptr = (int *) malloc((n+1)*sizeof(int));
+  memcpy(ptr,cnt,(n+1)*sizeof(int));
+  adj = (int *) malloc((cnt[n] > 0 ? cnt[n] : 1)*sizeof(int));
+  for (i = 0; i < nedge; i++) {
+    if (i+1 < nedge && edges[i+1].a == edges[i].a &&
+        edges[i+1].b == edges[i].b) continue;
+    adj[cnt[edges[i].a]++] = edges[i].b;
+    adj[cnt[edges[i].b]++] = edges[i].a;
+  }
+  free(edges);
+  free(cnt);
+/*
+ *  The gradient coefficients, from each point's neighbors and theirs.
+ */
+  s->gcnt = (int *) malloc(n*sizeof(int));
+  s->gidx = (int *) malloc(n*NGL_CSS_NLS*sizeof(int));
+  s->gwts = (double *) malloc(3*n*NGL_CSS_NLS*sizeof(double));
+#ifdef _OPENMP
+#pragma omp parallel private(j,k)
+#endif
+  {
+    int nnb, maxnb = 64, *nb;
+
+    nb = (int *) malloc(maxnb*sizeof(int));
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,64)
+#endif
+    for (i = 0; i < n; i++) {
+      nnb = 0;
+      for (j = ptr[i]; j < ptr[i+1]; j++) {
+        if (nnb + 1 + ptr[adj[j]+1] - ptr[adj[j]] > maxnb) {
+          maxnb = 2*(nnb + 1 + ptr[adj[j]+1] - ptr[adj[j]]);
+          nb = (int *) realloc(nb,maxnb*sizeof(int));
+        }
+        nb[nnb++] = adj[j];
+        for (k = ptr[adj[j]]; k < ptr[adj[j]+1]; k++) {
+          if (adj[k] != i) nb[nnb++] = adj[k];
+        }
+      }
+/*
+ *  Drop repeats.
+ */
+      for (j = 0; j < nnb; j++) {
+        for (k = 0; k < j; k++) {
+          if (nb[k] == nb[j]) break;
+        }
+        if (k < j) {
+          nb[j--] = nb[--nnb];
+        }
+      }
+      s->gcnt[i] = css_grad_coefs(s,i,nb,nnb,&s->gidx[i*NGL_CSS_NLS],
+                                  &s->gwts[3*i*NGL_CSS_NLS]);
+    }
+    free(nb);
+  }
+  free(ptr);
+  free(adj);
+  return((void *) s);
+}
+
+void c_cssfree(void *surf) {
+  nglSphSurf *s = (nglSphSurf *) surf;
+
+  if (s == NULL) return;
+  free(s->xyz);
+  free(s->tri);
+  free(s->nbr);
+  free(s->bdy);
+  free(s->gcnt);
+  free(s->gidx);
+  free(s->gwts);
+  free(s);
+}
+
+/*
+ *  The estimated gradients (3-vectors) at the points for nfld fields
+ *  of values f (nfld x n), in g (nfld x n x 3).
+ */
+void c_cssgrads(void *surf, int nfld, double *f, double *g) {
+  nglSphSurf *s = (nglSphSurf *) surf;
+  int i;
+
+#ifdef _OPENMP
+#pragma omp parallel for schedule(static)
+#endif
+  for (i = 0; i < s->n; i++) {
+    int fld, j, c;
+    double *fv, *gv, df;
+
+    for (fld = 0; fld < nfld; fld++) {
+      fv = &f[(size_t)fld*s->n];
+      gv = &g[3*((size_t)fld*s->n+i)];
+      gv[0] = gv[1] = gv[2] = 0.;
+      for (j = 0; j < s->gcnt[i]; j++) {
+        df = fv[s->gidx[i*NGL_CSS_NLS+j]] - fv[i];
+        for (c = 0; c < 3; c++) {
+          gv[c] += df*s->gwts[3*(i*NGL_CSS_NLS+j)+c];
+        }
+      }
+    }
+  }
+}
+
+/*
+ *  The surface for each of nfld fields (values f and gradients g, as
+ *  from c_cssgrads) at the np points (plat,plon), in degrees, in fp
+ *  (nfld x np).
+ */
+void c_csseval(void *surf, int nfld, double *f, double *g, int np,
+               double *plat, double *plon, double *fp) {
+  nglSphSurf *s = (nglSphSurf *) surf;
+  int i;
+
+#ifdef _OPENMP
+#pragma omp parallel
+#endif
+  {
+    int fld, t, hint = 0;
+    double p[3], d2r = 0.017453292519943295;
+
+#ifdef _OPENMP
+#pragma omp for schedule(dynamic,256)
+#endif
+    for (i = 0; i < np; i++) {
+      p[0] = cos(d2r*plat[i])*cos(d2r*plon[i]);
+      p[1] = cos(d2r*plat[i])*sin(d2r*plon[i]);
+      p[2] = sin(d2r*plat[i]);
+      t = css_locate(s,hint,p);
+      if (t >= 0) hint = t;
+      for (fld = 0; fld < nfld; fld++) {
+        if (t >= 0) {
+          fp[(size_t)fld*np+i] = css_triangle(s,&f[(size_t)fld*s->n],
+                                              &g[3*(size_t)fld*s->n],t,p);
+        }
+        else {
+          fp[(size_t)fld*np+i] = css_outside(s,&f[(size_t)fld*s->n],
+                                             &g[3*(size_t)fld*s->n],p);
+        }
+      }
+    }
+  }
+}
+
+/*
+ *  Fits splines under tension (sigma) to nrow curves of n points
+ *  each, with abscissae x (the same for every curve if xinc is 0,
+ *  else n per curve) and values y, and evaluates them at the m points
+ *  xo. periodic curves have period p. The values go in yo, and if
+ *  they aren't NULL, the first derivatives in dyo (not for periodic
+ *  curves) and the integrals from xo[0] in iyo (all nrow x m).
+ *
+ *  Each curve is fitted by fitgrid itself, in single precision, with
+ *  the calls ftcurv, ftcurvp and ftcurvpi make for one curve, so the
+ *  results are exactly theirs. fitgrid keeps its parameters and work
+ *  space in common blocks, so the curves are done one at a time, and
+ *  "sig" is set to sigma only for the duration. Returns 0, the error
+ *  from fitgrid for the first curve that couldn't be fitted, or 3 if
+ *  memory couldn't be allocated.
+ */
+int c_ftcurv_n(int nrow, int n, int xinc, double *x, double *y, int m,
+               double *xo, int periodic, double p, double sigma,
+               double *yo, double *dyo, double *iyo) {
+  float *xf, *yf, *xof, *yof, sig, val;
+  size_t row;
+  int i, ier = 0;
+
+  xf = (float *) malloc((2*(size_t)n + 2*(size_t)m)*sizeof(float));
+  if (xf == NULL) {
+    NhlPError(NhlFATAL,NhlEUNKNOWN,"ftcurv_n: unable to allocate memory");
+    return(3);
+  }
+  yf  = &xf[n];
+  xof = &yf[n];
+  yof = &xof[m];
+  for (i = 0; i < m; i++) xof[i] = (float) xo[i];
+
+  c_ftgetr("sig",&sig);
+  c_ftsetr("sig",(float) sigma);
+  for (row = 0; row < (size_t) nrow; row++) {
+    if (row == 0 || xinc != 0) {
+      for (i = 0; i < n; i++) xf[i] = (float) x[row*xinc+i];
+    }
+    for (i = 0; i < n; i++) yf[i] = (float) y[row*n+i];
+
+    if (periodic) {
+      ier = c_ftcurvp(n,xf,yf,(float) p,m,xof,yof);
+    }
+    else {
+      ier = c_ftcurv(n,xf,yf,m,xof,yof);
+    }
+    if (ier != 0) break;
+    for (i = 0; i < m; i++) yo[row*m+i] = (double) yof[i];
+
+    if (dyo != NULL && !periodic) {
+      c_ftcurvd(n,xf,yf,m,xof,yof);
+      for (i = 0; i < m; i++) dyo[row*m+i] = (double) yof[i];
+    }
+    if (iyo != NULL) {
+      for (i = 0; i < m; i++) {
+        if (periodic) {
+          c_ftcurvpi(xof[0],xof[i],(float) p,n,xf,yf,&val);
+        }
+        else {
+          c_ftcurvi(xof[0],xof[i],n,xf,yf,&val);
+        }
+        iyo[row*m+i] = (double) val;
+      }
+    }
+  }
+  c_ftsetr("sig",sig);
+  free(xf);
+  return(ier);
+}
+
+/*
+ *  Reading numbers from the text of an ASCII file (held in memory),
+ *  for asciiread. The numbers are separated by white space or the
+ *  character sep; commas inside a number are ignored. Anything that
+ *  isn't a number of the requested type (0 = int, 1 = float, 2 =
+ *  double) is skipped, as are integers that don't fit in an int. The
+ *  text can be split into chunks that are counted and read in
+ *  parallel.
+ */
+#define ASC_IS_SEP(c,sep) ((c) == (sep) || (c) == ' ' || (c) == '\n' || \
+                           (c) == '\t' || (c) == '\r' || (c) == '\v' || \
+                           (c) == '\f')
+
+static const double asc_pow10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22
+};
+
+/*
+ *  Converts the token t (without commas, null terminated) to a
+ *  number. Returns 0 if it isn't one. Floats with at most 15 digits
+ *  and small exponents are done exactly here; the rest by strtod.
+ */
+static int asc_token(char *t, int type, double *value) {
+  char *p = t;
+  int neg = 0, ndig = 0, nsig = 0, exp10 = 0, eneg = 0, e = 0;
+  unsigned long long m = 0;
+
+  if (*p == '+' || *p == '-') neg = *p++ == '-';
+  if (type == 0) {
+    for (; *p >= '0' && *p <= '9'; p++) {
+      m = 10*m + (*p - '0');
+      if (m > 2147483648ULL) return(0);
+      ndig++;
+    }
+    if (ndig == 0 || *p != '\0' || (!neg && m > 2147483647ULL)) return(0);
+    *value = neg ? -(double)m : (double)m;
+    return(1);
+  }
+  if (*p == 'i' || *p == 'I' || *p == 'n' || *p == 'N') {
+    if (strcasecmp(p,"inf") == 0 || strcasecmp(p,"infinity") == 0) {
+      *value = neg ? -HUGE_VAL : HUGE_VAL;
+      return(1);
+    }
+    if (strcasecmp(p,"nan") == 0) {
+      *value = NAN;
+      return(1);
+    }
+    return(0);
+  }
+  for (; *p >= '0' && *p <= '9'; p++, ndig++) {
+    if (m == 0 && *p == '0') continue;
+    if (nsig < 19) {
+      m = 10*m + (*p - '0');
+      nsig++;
+    }
+    else {
+      exp10++;
+      nsig++;
+    }
+  }
+  if (*p == '.') {
+    for (p++; *p >= '0' && *p <= '9'; p++, ndig++) {
+      if (m == 0 && *p == '0') {
+        exp10--;
+        continue;
+      }
+      if (nsig < 19) {
+        m = 10*m + (*p - '0');
+        exp10--;
+      }
+      nsig++;
+    }
+  }
+  if (ndig == 0) return(0);
+  if (*p == 'e' || *p == 'E') {
+    p++;
+    if (*p == '+' || *p == '-') eneg = *p++ == '-';
+    if (*p < '0' || *p > '9') return(0);
+    for (; *p >= '0' && *p <= '9'; p++) {
+      if (e < 100000) e = 10*e + (*p - '0');
+    }
+    exp10 += eneg ? -e : e;
+  }
+  if (*p != '\0') return(0);
+  if (m == 0) {
+    *value = neg ? -0. : 0.;
+  }
+  else if (nsig <= 15 && exp10 >= -22 && exp10 <= 22) {
+    *value = exp10 < 0 ? (double)m/asc_pow10[-exp10] :
+                         (double)m*asc_pow10[exp10];
+    if (neg) *value = -*value;
+  }
+  else {
+    *value = strtod(t,NULL);
+  }
+  return(1);
+}
+
+/*
+ *  The start of chunk k of nchunk: the first token that begins at or
+ *  after k*len/nchunk.
+ */
+static size_t asc_chunk_start(char *buf, size_t len, char sep, int k,
+                              int nchunk) {
+  size_t i = (size_t)((double)len*k/nchunk);
+
+  if (k == 0) return(0);
+  if (k >= nchunk) return(len);
+  while (i < len && !ASC_IS_SEP(buf[i-1],sep)) i++;
+  return(i);
+}
+
+/*
+ *  Reads (if out isn't NULL) or counts the numbers in buf[start,end),
+ *  at most nmax of them if nmax >= 0. Returns how many there were.
+ */
+static long asc_read(char *buf, size_t start, size_t end, char sep,
+                     int type, long nmax, void *out) {
+  char small[64], *tok = small, *big = NULL;
+  size_t i = start, j, n, maxtok = sizeof(small);
+  long count = 0;
+  double value;
+
+  while (i < end && (nmax < 0 || count < nmax)) {
+    while (i < end && ASC_IS_SEP(buf[i],sep)) i++;
+    if (i >= end) break;
+    for (j = i; j < end && !ASC_IS_SEP(buf[j],sep); j++);
+    if (j - i >= maxtok) {
+      maxtok = j - i + 1;
+      big = (char *) realloc(big,maxtok);
+      tok = big;
+    }
+    for (n = 0; i < j; i++) {
+      if (buf[i] != ',') tok[n++] = buf[i];
+    }
+    tok[n] = '\0';
+    if (n > 0 && asc_token(tok,type,&value)) {
+      if (out != NULL) {
+        switch (type) {
+        case 0:
+          ((int *) out)[count] = (int) value;
+          break;
+        case 1:
+          ((float *) out)[count] = (float) value;
+          break;
+        default:
+          ((double *) out)[count] = value;
+        }
+      }
+      count++;
+    }
+  }
+  free(big);
+  return(count);
+}
+
+/*
+ *  Counts the numbers in each of nchunk chunks of buf, into counts,
+ *  and returns the total.
+ */
+long c_asciicount(char *buf, size_t len, char sep, int type, int nchunk,
+                  long *counts) {
+  long total = 0;
+  int k;
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nchunk) schedule(static,1)
+#endif
+  for (k = 0; k < nchunk; k++) {
+    counts[k] = asc_read(buf,asc_chunk_start(buf,len,sep,k,nchunk),
+                         asc_chunk_start(buf,len,sep,k+1,nchunk),
+                         sep,type,-1,NULL);
+  }
+  for (k = 0; k < nchunk; k++) total += counts[k];
+  return(total);
+}
+
+/*
+ *  Reads the first nmax numbers in buf into out (an int, float or
+ *  double array, depending on type) and returns how many there were.
+ *  If counts isn't NULL, it has the counts of each of nchunk chunks
+ *  from c_asciicount, and the chunks are read in parallel.
+ */
+long c_asciiparse(char *buf, size_t len, char sep, int type, int nchunk,
+                  long *counts, long nmax, void *out) {
+  long total = 0, *offset;
+  size_t size = type == 0 ? sizeof(int) :
+                (type == 1 ? sizeof(float) : sizeof(double));
+  int k;
+
+  if (counts == NULL || nchunk <= 1) {
+    return(asc_read(buf,0,len,sep,type,nmax,out));
+  }
+  offset = (long *) malloc(nchunk*sizeof(long));
+  for (k = 0; k < nchunk; k++) {
+    offset[k] = total;
+    total += counts[k];
+  }
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(nchunk) schedule(static,1)
+#endif
+  for (k = 0; k < nchunk; k++) {
+    if (offset[k] < nmax) {
+      asc_read(buf,asc_chunk_start(buf,len,sep,k,nchunk),
+               asc_chunk_start(buf,len,sep,k+1,nchunk),sep,type,
+               nmax - offset[k],(char *)out + offset[k]*size);
+    }
+  }
+  free(offset);
+  return(total < nmax ? total : nmax);
+}
@@ -2,7 +2,14 @@
 #include <stdlib.h>
 #include <math.h>
 #include <string.h>
+#include <ctype.h>
 #include <math.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+#include <ncarg/gks.h>
+#include <cairo/cairo.h>
+#include <time.h>
 #include "gsun.h"
 
 #define NINT(x) ( (ceil((x))-(x)) > ( (x)-floor((x)))) ? floor((x)) : ceil((x))
@@ -15,6 +22,52 @@ const char *polylinestr = "polyline";
 int global_wk_orientation = -1;
 int nhl_initialized = 0;
 
+/*
+ * Layout table from the most recent call to panel_wrap (vpXF, vpYF,
+ * vpWidthF, vpHeightF for each plot slot, plus one row for the
+ * labelbar). "panel_bb" is only set while the paneled plots are being
+ * drawn, so that compute_ps_device_coords can reuse the bounding boxes
+ * panel_wrap has already computed.
+ */
+static float *panel_layout = NULL;
+static int npanel_layout   = 0;
+static NhlBoundingBox *panel_bb = NULL;
+
+/*
+ * Table of meshes created by create_mesh, indexed by mesh handle.
+ * A slot with npts == 0 is free.
+ */
+static nglMesh *mesh_table = NULL;
+static int nmesh_table     = 0;
+
+/*
+ * Timing statistics for the plotting calls, kept only when turned on
+ * with set_stats: stats_level 1 keeps per-stage totals, and 2 also
+ * keeps every call as a trace event. Stage names are string literals.
+ */
+typedef struct {
+  const char *name;
+  long   count;
+  double seconds;
+  double bytes;
+} nglStat;
+
+typedef struct {
+  const char *name;
+  double start;
+  double duration;
+} nglTraceEvent;
+
+#define NGL_MAX_STATS  64
+#define NGL_MAX_TRACE  1000000
+
+static int stats_level = 0;
+static nglStat stats[NGL_MAX_STATS];
+static int nstats = 0;
+static nglTraceEvent *trace_events = NULL;
+static int ntrace_events = 0, max_trace_events = 0;
+static double stats_epoch = 0.;
+
 /*
  *  This function calculates the maximum value of a 1D int array.
  */
@@ -299,22 +352,31 @@ void compute_ps_device_coords(int wks, nglPlotId *plots, int nplots,
  * aspect ratio.
  */
   box = (NhlBoundingBox *)malloc(nplots*sizeof(NhlBoundingBox));
-  NhlGetBB(*(plots[0].base),&box[0]);
-  top = box[0].t;
-  bot = box[0].b;
-  lft = box[0].l;
-  rgt = box[0].r;
 
 /*
  * Get largest bounding box that encompasses all non-missing graphical
- * objects.
+ * objects. If we are being called from panel_wrap, the bounding boxes
+ * have already been computed, so don't retrieve them again.
  */
-  for( i = 1; i < nplots; i++ ) { 
-    NhlGetBB(*(plots[i].base),&box[i]);
-    top = max(top,box[i].t);
-    bot = min(bot,box[i].b);
-    lft = min(lft,box[i].l);
-    rgt = max(rgt,box[i].r);
+  for( i = 0; i < nplots; i++ ) { 
+    if(panel_bb != NULL) {
+      box[i] = panel_bb[i];
+    }
+    else {
+      NhlGetBB(*(plots[i].base),&box[i]);
+    }
+    if(i) {
+      top = max(top,box[i].t);
+      bot = min(bot,box[i].b);
+      lft = min(lft,box[i].l);
+      rgt = max(rgt,box[i].r);
+    }
+    else {
+      top = box[0].t;
+      bot = box[0].b;
+      lft = box[0].l;
+      rgt = box[0].r;
+    }
   }
   if(top_inv_pnl) {
     top = max(special_res->nglPanelInvsblTop,top);
@@ -1249,15 +1311,485 @@ void collapse_nomsg_xy(float *xf, float *yf, float **xfnew, float **yfnew,
         (*newlen)++;
       }
     }
-    *xfnew = (float*)malloc(*newlen*sizeof(float));
-    *yfnew = (float*)malloc(*newlen*sizeof(float));
-    memcpy((void *)(*xfnew),(const void *)&xtmp[0],*newlen*sizeof(float));
-    memcpy((void *)(*yfnew),(const void *)&ytmp[0],*newlen*sizeof(float));
-    free(xtmp);
-    free(ytmp);
+/*
+ * Hand back the compacted arrays rather than copying them again.
+ */
+    *xfnew = xtmp;
+    *yfnew = ytmp;
   }
 }
 
+/*
+ * This function finds the cells (or points, if nvert is 1) that may
+ * be visible in a map whose area is given by the lat/lon limits,
+ * widened on all sides by "halo" degrees. A cell is kept if any one
+ * of its nvert vertices falls inside. Longitudes are compared modulo
+ * 360. The indices of the cells kept are stored in "indices", and
+ * the number of them is returned.
+ */
+int region_cull(double *lat, double *lon, int ncells, int nvert,
+                double minlat, double maxlat, double minlon, 
+                double maxlon, double halo, int *indices)
+{
+  int i, j, k, nkeep, check_lon;
+  double lat0, lat1, dlon, lon_range;
+
+  lat0      = minlat - halo;
+  lat1      = maxlat + halo;
+  lon_range = (maxlon - minlon) + halo;
+  check_lon = (lon_range + halo) < 360.;
+
+  nkeep = 0;
+  for(i = 0; i < ncells; i++) {
+    for(j = 0; j < nvert; j++) {
+      k = i*nvert + j;
+      if(lat[k] < lat0 || lat[k] > lat1) continue;
+      if(check_lon) {
+        dlon = fmod(lon[k] - minlon, 360.);
+        if(dlon < 0.) dlon += 360.;
+        if(dlon > lon_range && dlon < 360. - halo) continue;
+      }
+      indices[nkeep++] = i;
+      break;
+    }
+  }
+  return(nkeep);
+}
+
+/*
+ * Flush one bucket of points for decimate_xy: output the first, the
+ * lowest, the highest, and the last point of the bucket, in their
+ * original order and without repeating any point.
+ */
+static void flush_xy_bucket(double *x, double *y, int ifirst, int imin,
+                            int imax, int ilast, double *xout, 
+                            double *yout, int *nout)
+{
+  int i, j, idx[4], tmp;
+
+  if(ifirst < 0) return;
+
+  idx[0] = ifirst;
+  idx[1] = imin;
+  idx[2] = imax;
+  idx[3] = ilast;
+  if(idx[1] > idx[2]) {
+    tmp    = idx[1];
+    idx[1] = idx[2];
+    idx[2] = tmp;
+  }
+  for(i = 0; i < 4; i++) {
+    for(j = 0; j < i; j++) {
+      if(idx[j] == idx[i]) break;
+    }
+    if(j < i) continue;
+    xout[*nout] = x[idx[i]];
+    yout[*nout] = y[idx[i]];
+    (*nout)++;
+  }
+}
+
+/*
+ * This function reduces an XY curve to at most four points (first,
+ * min, max, last) for each of the "ncols" columns that the X range
+ * [xmin,xmax] covers, so that a curve of millions of points is drawn
+ * with a few thousand without changing how it looks. Missing values
+ * in either array end the current run of points, and one missing
+ * value is output in their place so the curve still has a gap there.
+ * If xlog is set, the columns are spaced logarithmically.
+ *
+ * xout and yout must have room for n values; the number of values
+ * stored in them is returned.
+ */
+int decimate_xy(double *x, double *y, int n, double xmin, double xmax,
+                int ncols, int xlog, int is_missing_x, double xmsg,
+                int is_missing_y, double ymsg, double *xout,
+                double *yout)
+{
+  int i, col, bucket_col, ifirst, imin, imax, ilast, nout, last_missing;
+  double xx, x0, dx;
+
+  if(xlog) {
+    if(xmin <= 0. || xmax <= 0.) xlog = 0;
+    else {
+      xmin = log10(xmin);
+      xmax = log10(xmax);
+    }
+  }
+  if(ncols < 1 || xmax <= xmin) {
+    memcpy(xout,x,n*sizeof(double));
+    memcpy(yout,y,n*sizeof(double));
+    return(n);
+  }
+  x0 = xmin;
+  dx = (xmax - xmin)/ncols;
+
+  nout         = 0;
+  last_missing = 0;
+  ifirst       = imin = imax = ilast = -1;
+  bucket_col   = 0;
+  for(i = 0; i < n; i++) {
+    if((is_missing_x && x[i] == xmsg) || (is_missing_y && y[i] == ymsg)) {
+      flush_xy_bucket(x, y, ifirst, imin, imax, ilast, xout, yout, &nout);
+      ifirst = -1;
+      if(nout > 0 && !last_missing) {
+        xout[nout] = x[i];
+        yout[nout] = y[i];
+        nout++;
+        last_missing = 1;
+      }
+      continue;
+    }
+    if(xlog) {
+      xx = x[i] > 0. ? log10(x[i]) : xmin;
+    }
+    else {
+      xx = x[i];
+    }
+    col = (int)floor((xx - x0)/dx);
+    if(ifirst < 0 || col != bucket_col) {
+      flush_xy_bucket(x, y, ifirst, imin, imax, ilast, xout, yout, &nout);
+      ifirst = imin = imax = i;
+      bucket_col   = col;
+      last_missing = 0;
+    }
+    else {
+      if(y[i] < y[imin]) imin = i;
+      if(y[i] > y[imax]) imax = i;
+    }
+    ilast = i;
+  }
+  flush_xy_bucket(x, y, ifirst, imin, imax, ilast, xout, yout, &nout);
+  return(nout);
+}
+
+/*
+ * This function bins n (x,y) points into an ny x nx array of counts
+ * covering [xmin,xmax] x [ymin,ymax], for drawing very large scatter
+ * plots as a density field instead of one marker per point. Points
+ * that are missing or fall outside the range are skipped. If the
+ * code is compiled with OpenMP, each thread fills its own histogram,
+ * and these are summed at the end.
+ *
+ * The number of points that were binned is returned.
+ */
+int histogram2d(double *x, double *y, int n, int nx, int ny, double xmin,
+                double xmax, double ymin, double ymax, int is_missing_x,
+                double xmsg, int is_missing_y, double ymsg, double *counts)
+{
+  int i, ix, iy, nbinned, ncells;
+  double xscale, yscale;
+
+  ncells = nx * ny;
+  memset(counts,0,ncells*sizeof(double));
+  if(nx < 1 || ny < 1 || xmax <= xmin || ymax <= ymin) return(0);
+
+  xscale  = nx/(xmax - xmin);
+  yscale  = ny/(ymax - ymin);
+  nbinned = 0;
+
+#ifdef _OPENMP
+#pragma omp parallel private(i,ix,iy) reduction(+:nbinned)
+  {
+    int j;
+    double *tcounts = (double *)calloc(ncells,sizeof(double));
+#pragma omp for schedule(static)
+    for(i = 0; i < n; i++) {
+      if((is_missing_x && x[i] == xmsg) || (is_missing_y && y[i] == ymsg) ||
+         !(x[i] >= xmin && x[i] <= xmax && y[i] >= ymin && y[i] <= ymax)) {
+        continue;
+      }
+      ix = (int)((x[i] - xmin) * xscale);
+      iy = (int)((y[i] - ymin) * yscale);
+      if(ix == nx) ix--;
+      if(iy == ny) iy--;
+      tcounts[iy*nx+ix] += 1.;
+      nbinned++;
+    }
+#pragma omp critical
+    for(j = 0; j < ncells; j++) counts[j] += tcounts[j];
+    free(tcounts);
+  }
+#else
+  for(i = 0; i < n; i++) {
+    if((is_missing_x && x[i] == xmsg) || (is_missing_y && y[i] == ymsg) ||
+       !(x[i] >= xmin && x[i] <= xmax && y[i] >= ymin && y[i] <= ymax)) {
+      continue;
+    }
+    ix = (int)((x[i] - xmin) * xscale);
+    iy = (int)((y[i] - ymin) * yscale);
+    if(ix == nx) ix--;
+    if(iy == ny) iy--;
+    counts[iy*nx+ix] += 1.;
+    nbinned++;
+  }
+#endif
+  return(nbinned);
+}
+
+/*
+ * This function fills "cells" with the fill color index of each cell
+ * of an nxout x nyout raster that samples an nx x ny rectilinear
+ * grid, the way a raster-filled contour plot colors it: a value
+ * below levels[0] gets colors[0], a value at or above
+ * levels[nlevels-1] gets colors[nlevels], and any other value gets
+ * the color of the band between the two levels that surround it.
+ * Missing values get msg_color. Each raster cell takes the value of
+ * the grid point nearest its center. The rows are done in parallel
+ * if the code is compiled with OpenMP.
+ */
+void raster_fill_cells(double *data, int nx, int ny, int nxout, int nyout,
+                       double *levels, int nlevels, int *colors,
+                       int is_missing, double msg, int msg_color,
+                       int *cells)
+{
+  int i, j, lo, hi, mid, *ix;
+  double val;
+
+  ix = (int *)malloc(nxout*sizeof(int));
+  for(i = 0; i < nxout; i++) {
+    ix[i] = (int)((i + 0.5) * nx / nxout);
+  }
+
+#ifdef _OPENMP
+#pragma omp parallel for private(i,lo,hi,mid,val) schedule(static)
+#endif
+  for(j = 0; j < nyout; j++) {
+    double *row = &data[(long)((int)((j + 0.5) * ny / nyout)) * nx];
+    int *out    = &cells[(long)j * nxout];
+    for(i = 0; i < nxout; i++) {
+      val = row[ix[i]];
+      if((is_missing && val == msg) || val != val) {
+        out[i] = msg_color;
+        continue;
+      }
+/*
+ * Find the number of levels that are less than or equal to val.
+ */
+      lo = 0;
+      hi = nlevels;
+      while(lo < hi) {
+        mid = (lo + hi) / 2;
+        if(levels[mid] <= val) lo = mid + 1;
+        else                   hi = mid;
+      }
+      out[i] = colors[lo];
+    }
+  }
+  free(ix);
+}
+
+/*
+ * This function draws a rectilinear grid as a GKS cell array in the
+ * viewport of "plot", colored by raster_fill_cells. It is used in
+ * place of a raster-filled contour plot when the plot's data space
+ * maps linearly onto NDC space (linear axes, or a cylindrical
+ * equidistant map). xfirst/xlast and yfirst/ylast are the outer edges
+ * of the first and last grid cells in data space. "resolution" is the
+ * number of device pixels across NDC space; the raster is given about
+ * one cell per pixel, or one per grid point if the grid is coarser.
+ *
+ * The cell array is clipped to the viewport. Cells whose color index
+ * is negative (missing values when msg_color is -1, or bands filled
+ * with -1) are transparent: GKS cell arrays have no transparent
+ * color, so the raster is then drawn as one cell array per run of
+ * opaque cells in each row. Returns 0 on success, and 1 if the plot's
+ * data to NDC transformation can't be found.
+ */
+int raster_fill_wrap(int wks, int plot, double *data, int nx, int ny,
+                     double xfirst, double xlast, double yfirst, 
+                     double ylast, int resolution, double *levels,
+                     int nlevels, int *colors, int is_missing, double msg,
+                     int msg_color)
+{
+  int status, gkswid, grlist, nxout, nyout, *cells;
+  int i, j, i0, ntransparent;
+  long ncells;
+  float xndc[2], yndc[2], xdat[2], ydat[2], oor, dx, dy;
+  double xscale, yscale;
+  nglLayoutBox box;
+  Grect rect, run;
+  Gpat_rep colr;
+
+/*
+ * Find the linear mapping from data space to NDC space using two
+ * points well inside the viewport, since the grid's corners could
+ * be outside of the plot's data range.
+ */
+  get_layout_box(plot, &box);
+  xndc[0] = box.vpx + 0.25 * box.vpw;
+  xndc[1] = box.vpx + 0.75 * box.vpw;
+  yndc[0] = box.vpy - 0.75 * box.vph;
+  yndc[1] = box.vpy - 0.25 * box.vph;
+  status  = 0;
+  NhlNDCToData(plot, xndc, yndc, 2, xdat, ydat, NULL, NULL, &status, &oor);
+  if(status || xdat[0] == xdat[1] || ydat[0] == ydat[1]) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"raster_fill: unable to map the grid to the viewport of this plot");
+    return(1);
+  }
+  xscale = (xndc[1] - xndc[0])/(xdat[1] - xdat[0]);
+  yscale = (yndc[1] - yndc[0])/(ydat[1] - ydat[0]);
+
+  rect.p.x = xndc[0] + (xfirst - xdat[0]) * xscale;
+  rect.q.x = xndc[0] + (xlast  - xdat[0]) * xscale;
+  rect.p.y = yndc[0] + (yfirst - ydat[0]) * yscale;
+  rect.q.y = yndc[0] + (ylast  - ydat[0]) * yscale;
+
+  nxout = (int)ceil(fabs(rect.q.x - rect.p.x) * resolution);
+  nyout = (int)ceil(fabs(rect.q.y - rect.p.y) * resolution);
+  if(nxout < 1) nxout = 1;
+  if(nyout < 1) nyout = 1;
+  if(nxout > nx) nxout = nx;
+  if(nyout > ny) nyout = ny;
+
+  ncells = (long)nxout*nyout;
+  cells  = (int *)malloc(ncells*sizeof(int));
+  if(cells == NULL) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"raster_fill: unable to allocate memory for the raster");
+    return(1);
+  }
+  raster_fill_cells(data, nx, ny, nxout, nyout, levels, nlevels, colors,
+                    is_missing, msg, msg_color, cells);
+  ntransparent = 0;
+  for(i = 0; i < ncells; i++) {
+    if(cells[i] < 0) {
+      ntransparent = 1;
+      break;
+    }
+  }
+
+  grlist = NhlRLCreate(NhlGETRL);
+  NhlRLClear(grlist);
+  NhlRLGetInteger(grlist,"wkGksWorkId",&gkswid);
+  (void)NhlGetValues(wks, grlist);
+  NhlRLDestroy(grlist);
+
+/*
+ * Use NDC as the world coordinates, with the viewport of the plot as
+ * the clipping rectangle.
+ */
+  gactivate_ws(gkswid);
+  c_set(box.vpx, box.vpx + box.vpw, box.vpy - box.vph, box.vpy,
+        box.vpx, box.vpx + box.vpw, box.vpy - box.vph, box.vpy, 1);
+  if(!ntransparent) {
+    colr.dims.size_x = nxout;
+    colr.dims.size_y = nyout;
+    colr.colr_array  = cells;
+    gcell_array(&rect, &colr);
+  }
+  else {
+/*
+ * Draw each run of opaque cells in a row as a one-row cell array.
+ */
+    dx = (rect.q.x - rect.p.x) / nxout;
+    dy = (rect.q.y - rect.p.y) / nyout;
+    colr.dims.size_y = 1;
+    for(j = 0; j < nyout; j++) {
+      run.p.y = rect.p.y + j * dy;
+      run.q.y = run.p.y + dy;
+      i = 0;
+      while(i < nxout) {
+        if(cells[(long)j*nxout+i] < 0) {
+          i++;
+          continue;
+        }
+        i0 = i;
+        while(i < nxout && cells[(long)j*nxout+i] >= 0) i++;
+        run.p.x = rect.p.x + i0 * dx;
+        run.q.x = rect.p.x + i  * dx;
+        colr.dims.size_x = i - i0;
+        colr.colr_array  = &cells[(long)j*nxout+i0];
+        gcell_array(&run, &colr);
+      }
+    }
+  }
+  gdeactivate_ws(gkswid);
+
+  free(cells);
+  return(0);
+}
+
+/*
+ * Read function for cairo_image_surface_create_from_png_stream, which
+ * reads the PNG data from memory.
+ */
+typedef struct {
+  unsigned char *data;
+  int nbytes;
+  int pos;
+} png_buffer;
+
+static cairo_status_t read_png_buffer(void *closure, unsigned char *data,
+                                      unsigned int length)
+{
+  png_buffer *buf = (png_buffer *)closure;
+
+  if(buf->pos + (int)length > buf->nbytes) return(CAIRO_STATUS_READ_ERROR);
+  memcpy(data, buf->data + buf->pos, length);
+  buf->pos += length;
+  return(CAIRO_STATUS_SUCCESS);
+}
+
+/*
+ * This function decodes nbytes of PNG data held in memory, as written
+ * by a PNG workstation, into a height x width x 4 array of bytes in
+ * red, green, blue, alpha order. The array is allocated here and must
+ * be freed by the caller. NULL is returned if the data can't be
+ * decoded.
+ */
+unsigned char *png_to_rgba(unsigned char *png, int nbytes, int *width,
+                           int *height)
+{
+  int i, j, stride, opaque;
+  unsigned int pixel, a;
+  unsigned char *rgba, *out, *row;
+  png_buffer buf;
+  cairo_surface_t *surface;
+
+  buf.data   = png;
+  buf.nbytes = nbytes;
+  buf.pos    = 0;
+  surface = cairo_image_surface_create_from_png_stream(read_png_buffer,&buf);
+  if(cairo_surface_status(surface) != CAIRO_STATUS_SUCCESS ||
+     (cairo_image_surface_get_format(surface) != CAIRO_FORMAT_ARGB32 &&
+      cairo_image_surface_get_format(surface) != CAIRO_FORMAT_RGB24)) {
+    cairo_surface_destroy(surface);
+    return(NULL);
+  }
+/*
+ * Cairo stores each pixel as a native-endian 32-bit ARGB value, with
+ * the colors premultiplied by alpha. Images without an alpha channel
+ * come back as RGB24, whose alpha byte is unused.
+ */
+  opaque  = cairo_image_surface_get_format(surface) == CAIRO_FORMAT_RGB24;
+  cairo_surface_flush(surface);
+  *width  = cairo_image_surface_get_width(surface);
+  *height = cairo_image_surface_get_height(surface);
+  stride  = cairo_image_surface_get_stride(surface);
+  row     = cairo_image_surface_get_data(surface);
+  rgba    = (unsigned char *)malloc((long)(*width)*(*height)*4);
+
+  out = rgba;
+  for(j = 0; j < *height; j++) {
+    for(i = 0; i < *width; i++) {
+      pixel = ((unsigned int *)(row + (long)j*stride))[i];
+      a     = opaque ? 255 : pixel >> 24;
+      if(a == 0) {
+        out[0] = out[1] = out[2] = 0;
+      }
+      else {
+        out[0] = (((pixel >> 16) & 0xff) * 255 + a/2) / a;
+        out[1] = (((pixel >>  8) & 0xff) * 255 + a/2) / a;
+        out[2] = (( pixel        & 0xff) * 255 + a/2) / a;
+      }
+      out[3] = a;
+      out += 4;
+    }
+  }
+  cairo_surface_destroy(surface);
+  return(rgba);
+}
+
 /*
  * This procedure sets a resource, given its name, and type and size
  * of its data. 
@@ -1427,6 +1959,7 @@ void initialize_resources(nglRes *res, int list_type)
   res->nglPanelInvsblLeft         = -999.;
   res->nglPanelInvsblRight        = -999.;
   res->nglPanelInvsblBottom       = -999.;
+  res->nglPanelLayoutOnly         = 0;
 
 /*
  * Special resources for panel figure strings.
@@ -1479,6 +2012,128 @@ void initialize_resources(nglRes *res, int list_type)
   res->nglYRefLineColor      = 1;
 }
 
+/*
+ * Returns wall clock time in seconds.
+ */
+double stats_time()
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return((double)ts.tv_sec + 1.e-9*(double)ts.tv_nsec);
+}
+
+/*
+ * Turns timing statistics off (0), on (1), or on with trace events
+ * (2). Turning them on or off clears what has been collected.
+ */
+void set_stats(int level)
+{
+  stats_level = level;
+  nstats = ntrace_events = 0;
+  stats_epoch = stats_time();
+}
+
+int get_stats_level()
+{
+  return(stats_level);
+}
+
+/*
+ * Returns the start time of a stage, or 0 if statistics are off.
+ */
+double stats_begin()
+{
+  return(stats_level > 0 ? stats_time() : 0.);
+}
+
+/*
+ * Adds the time since t0, and any bytes converted, to the given stage.
+ */
+void stats_end(const char *name, double t0, double bytes)
+{
+  int i, new_max;
+  double t1;
+  nglTraceEvent *new_events;
+
+  if(stats_level <= 0 || t0 <= 0.) return;
+  t1 = stats_time();
+
+  for(i = 0; i < nstats; i++) {
+    if(stats[i].name == name || !strcmp(stats[i].name,name)) break;
+  }
+  if(i == nstats) {
+    if(nstats == NGL_MAX_STATS) return;
+    stats[i].name    = name;
+    stats[i].count   = 0;
+    stats[i].seconds = 0.;
+    stats[i].bytes   = 0.;
+    nstats++;
+  }
+  stats[i].count++;
+  stats[i].seconds += t1 - t0;
+  stats[i].bytes   += bytes;
+
+  if(stats_level > 1 && ntrace_events < NGL_MAX_TRACE) {
+    if(ntrace_events == max_trace_events) {
+/*
+ * If the trace can't grow, keep what we have and drop this event.
+ */
+      new_max    = max_trace_events ? 2*max_trace_events : 1024;
+      new_events = (nglTraceEvent *)realloc(trace_events,
+                                            new_max*sizeof(nglTraceEvent));
+      if(new_events == NULL) return;
+      trace_events     = new_events;
+      max_trace_events = new_max;
+    }
+    trace_events[ntrace_events].name     = name;
+    trace_events[ntrace_events].start    = t0 - stats_epoch;
+    trace_events[ntrace_events].duration = t1 - t0;
+    ntrace_events++;
+  }
+}
+
+/*
+ * Returns the size in bytes of an array of the given type and shape.
+ */
+double data_bytes(const char *type, int ndims, int *dsizes)
+{
+  int i;
+  double n;
+
+  n = strcmp(type,"double") ? 4. : 8.;
+  for(i = 0; i < ndims; i++) n *= (double)dsizes[i];
+  return(n);
+}
+
+/*
+ * Accessors for the collected statistics and trace events.
+ */
+int get_nstats()
+{
+  return(nstats);
+}
+
+const char *get_stat(int i, long *count, double *seconds, double *bytes)
+{
+  *count   = stats[i].count;
+  *seconds = stats[i].seconds;
+  *bytes   = stats[i].bytes;
+  return(stats[i].name);
+}
+
+int get_ntrace_events()
+{
+  return(ntrace_events);
+}
+
+const char *get_trace_event(int i, double *start, double *duration)
+{
+  *start    = trace_events[i].start;
+  *duration = trace_events[i].duration;
+  return(trace_events[i].name);
+}
+
 /*
  * This function maximizes and draws the plot, and advances the frame.
  */
@@ -1487,15 +2142,25 @@ void draw_and_frame(int wks, nglPlotId *plots, int nplots, int ispanel,
                     nglRes *special_res)
 {
   int i;
+  double t0;
 
-  if(special_res->nglMaximize) maximize_plots(wks, plots, nplots, 
-                                              ispanel, special_res);
+  if(special_res->nglMaximize) {
+    t0 = stats_begin();
+    maximize_plots(wks, plots, nplots, ispanel, special_res);
+    stats_end("maximize", t0, 0.);
+  }
   if(special_res->nglDraw)  {
+    t0 = stats_begin();
     for( i = 0; i < nplots; i++ ) {
       NhlDraw(*(plots[i].base));
     }
+    stats_end("draw", t0, 0.);
+  }
+  if(special_res->nglFrame) {
+    t0 = stats_begin();
+    NhlFrame(wks);
+    stats_end("frame", t0, 0.);
   }
-  if(special_res->nglFrame) NhlFrame(wks);
 }
 
 /*
@@ -1508,6 +2173,7 @@ int scalar_field(void *data, const char *type_data, int ylen, int xlen,
                  int is_xcoord, void *xcoord, const char *type_xcoord,
                  int is_missing_data, void *FillValue_data, int sf_rlist)
 {
+  double t0 = stats_begin();
   int app, field, rank, length[2];
 
 /*
@@ -1566,6 +2232,150 @@ int scalar_field(void *data, const char *type_data, int ylen, int xlen,
     NhlCreate(&field,"field",NhlmeshScalarFieldClass,app,sf_rlist);
   }
    
+  stats_end("data", t0, data_bytes(type_data, rank, length));
+  return(field);
+}
+
+/*
+ * This function creates a mesh that can be shared by any number of
+ * contour plots of 1D data, and returns a handle to it (or -1 on
+ * error). The coordinates and cell bounds are converted to float
+ * once, and if no element nodes are given and "triangulate" is set,
+ * the points (taken to be longitudes and latitudes) are triangulated
+ * here once, so the contour plots don't each have to do it.
+ */
+int create_mesh(double *x, double *y, int npts, double *xbounds,
+                double *ybounds, int nvert, int *nodes, int ntri,
+                int triangulate)
+{
+  int i, mesh, ier;
+  nglMesh *m;
+
+  if(npts <= 0) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"create_mesh: the mesh must have at least one point");
+    return(-1);
+  }
+/*
+ * Find a free slot in the mesh table, or make the table bigger.
+ */
+  for(mesh = 0; mesh < nmesh_table; mesh++) {
+    if(mesh_table[mesh].npts == 0) break;
+  }
+  if(mesh == nmesh_table) {
+    nmesh_table++;
+    mesh_table = (nglMesh *)realloc(mesh_table,nmesh_table*sizeof(nglMesh));
+  }
+  m = &mesh_table[mesh];
+
+  m->npts    = npts;
+  m->x       = (float *)malloc(npts*sizeof(float));
+  m->y       = (float *)malloc(npts*sizeof(float));
+  for(i = 0; i < npts; i++) {
+    m->x[i] = (float)x[i];
+    m->y[i] = (float)y[i];
+  }
+
+  m->nvert   = nvert;
+  m->xbounds = NULL;
+  m->ybounds = NULL;
+  if(nvert > 0) {
+    m->xbounds = (float *)malloc(npts*nvert*sizeof(float));
+    m->ybounds = (float *)malloc(npts*nvert*sizeof(float));
+    for(i = 0; i < npts*nvert; i++) {
+      m->xbounds[i] = (float)xbounds[i];
+      m->ybounds[i] = (float)ybounds[i];
+    }
+  }
+
+  m->ntri         = 0;
+  m->nodes        = NULL;
+  m->triangulated = 0;
+  if(ntri > 0) {
+    m->ntri  = ntri;
+    m->nodes = (int *)malloc(3*ntri*sizeof(int));
+    memcpy(m->nodes,nodes,3*ntri*sizeof(int));
+  }
+  else if(triangulate && npts >= 3) {
+    m->nodes = c_csstri(npts,m->y,m->x,&m->ntri,&ier);
+    if(ier != 0 || m->nodes == NULL) {
+      NhlPError(NhlWARNING,NhlEUNKNOWN,"create_mesh: c_csstri returned error %d; the mesh will be triangulated by each contour plot instead",ier);
+      m->ntri  = 0;
+      m->nodes = NULL;
+    }
+    else {
+      m->triangulated = 1;
+    }
+  }
+  return(mesh);
+}
+
+/*
+ * Free the memory used by a mesh created with create_mesh.
+ */
+void destroy_mesh(int mesh)
+{
+  nglMesh *m;
+
+  if(mesh < 0 || mesh >= nmesh_table || mesh_table[mesh].npts == 0) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"destroy_mesh: invalid mesh handle %d",mesh);
+    return;
+  }
+  m = &mesh_table[mesh];
+  free(m->x);
+  free(m->y);
+  if(m->xbounds != NULL) free(m->xbounds);
+  if(m->ybounds != NULL) free(m->ybounds);
+  if(m->nodes   != NULL) free(m->nodes);
+  m->npts = 0;
+}
+
+/*
+ * This function creates a mesh scalar field object from the given
+ * 1D data and an existing mesh. Only the data values are new; the
+ * coordinates, cell bounds, and triangles all come from the mesh.
+ */
+int mesh_scalar_field(int mesh, void *data, const char *type_data,
+                      int sf_rlist)
+{
+  int app, field, length[2];
+  nglMesh *m;
+
+  if(mesh < 0 || mesh >= nmesh_table || mesh_table[mesh].npts == 0) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"mesh_scalar_field: invalid mesh handle %d",mesh);
+    return(-1);
+  }
+  m = &mesh_table[mesh];
+
+/*
+ * Retrieve application id.
+ */
+  app = NhlAppGetDefaultParentId();
+
+  length[0] = m->npts;
+  set_resource("sfDataArray", sf_rlist, data, type_data, 1, length);
+  set_resource("sfXArray", sf_rlist, m->x, "float", 1, length);
+  set_resource("sfYArray", sf_rlist, m->y, "float", 1, length);
+
+  if(m->nvert > 0) {
+    length[1] = m->nvert;
+    set_resource("sfXCellBounds", sf_rlist, m->xbounds, "float", 2, length);
+    set_resource("sfYCellBounds", sf_rlist, m->ybounds, "float", 2, length);
+  }
+
+  if(m->ntri > 0) {
+    length[0] = m->ntri;
+    length[1] = 3;
+    set_resource("sfElementNodes", sf_rlist, m->nodes, "integer", 2, length);
+/*
+ * The triangles returned by c_csstri are zero-based.
+ */
+    if(m->triangulated) {
+      NhlRLSetInteger(sf_rlist,"sfFirstNodeIndex",0);
+    }
+  }
+
+  NhlCreate(&field,"field",NhlmeshScalarFieldClass,app,sf_rlist);
+   
   return(field);
 }
 
@@ -1580,6 +2390,7 @@ int coord_array(void *x, void *y, const char *type_x, const char *type_y,
                 int is_missing_x, int is_missing_y,
                 void *FillValue_x, void *FillValue_y, int ca_rlist)
 {
+  double t0 = stats_begin();
   int app, carray, length[2];
 
 /*
@@ -1611,6 +2422,8 @@ int coord_array(void *x, void *y, const char *type_x, const char *type_y,
 
   NhlCreate(&carray,"carray",NhlcoordArraysClass,app,ca_rlist);
 
+  stats_end("data", t0, data_bytes(type_y, ndims_y, dsizes_y) +
+                   (x != NULL ? data_bytes(type_x, ndims_x, dsizes_x) : 0.));
   return(carray);
 }
 
@@ -1627,6 +2440,7 @@ int vector_field(void *u, void *v, const char *type_u, const char *type_v,
                  int is_missing_u, int is_missing_v,
                  void *FillValue_u, void *FillValue_v, int vf_rlist)
 {
+  double t0 = stats_begin();
   int app, field, length[2];
 
 /*
@@ -1673,10 +2487,27 @@ int vector_field(void *u, void *v, const char *type_u, const char *type_v,
 
   NhlCreate(&field,"field",NhlvectorFieldClass,app,vf_rlist);
 
+  stats_end("data", t0, 2.*data_bytes(type_u, 0, NULL)*ylen*xlen);
   return(field);
 }
 
 
+/*
+ * Load the colormap files in the directories named by NCARG_COLORMAPS
+ * into the HLU palette, so their colormaps can be referenced by name.
+ * open_wks_wrap does this when it initializes the HLU library; this
+ * is for loading files that were added to those directories later.
+ * Returns 0 on success.
+ */
+int load_colormap_files()
+{
+  if(!nhl_initialized) return(0);
+  if(NhlPalLoadColormapFiles(NhlworkstationClass,True) < NhlWARNING) {
+    return(1);
+  }
+  return(0);
+}
+
 /*
  * This function uses the HLUs to create an Application object
  * and to open a workstation.
@@ -1685,6 +2516,7 @@ int vector_field(void *u, void *v, const char *type_u, const char *type_v,
 int open_wks_wrap(char *type, char *name, ResInfo *wk_res,
                   ResInfo *ap_res, nglRes *special_res)
 {
+  double t0 = stats_begin();
   int wks, len, tlen, wk_rlist, ap_rlist, grlist, check_orientation = 0;
   char *filename = (char *) NULL;
   int app;
@@ -1879,6 +2711,7 @@ int open_wks_wrap(char *type, char *name, ResInfo *wk_res,
 
   nhl_initialized = 1;
   if(filename != NULL) free(filename);
+  stats_end("open_wks", t0, 0.);
   return(wks);
 }
 
@@ -1888,6 +2721,7 @@ int open_wks_wrap(char *type, char *name, ResInfo *wk_res,
 
 nglPlotId blank_plot_wrap(int wks, ResInfo *blank_res, nglRes *special_res)
 {
+  double t0 = stats_begin();
   int loglin, blank_rlist;
   nglPlotId plot;
 
@@ -1943,6 +2777,7 @@ nglPlotId blank_plot_wrap(int wks, ResInfo *blank_res, nglRes *special_res)
 /*
  * Return.
  */
+  stats_end("blank_plot", t0, 0.);
   return(plot);
 }
   
@@ -1958,15 +2793,7 @@ nglPlotId contour_wrap(int wks, void *data, const char *type, int ylen,
                        ResInfo *cn_res, ResInfo *tm_res, 
                        nglRes *special_res)
 {
-  nglPlotId plot;
-  int field, contour;
-  int sf_rlist, cn_rlist;
-
-/*
- * Set resource ids.
- */
-  sf_rlist = sf_res->id;
-  cn_rlist = cn_res->id;
+  int field;
 
 /*
  * Create a scalar field object that will be used as the
@@ -1975,7 +2802,45 @@ nglPlotId contour_wrap(int wks, void *data, const char *type, int ylen,
 
   field = scalar_field(data, type, ylen, xlen, is_ycoord, ycoord,
                        ycoord_type, is_xcoord, xcoord, xcoord_type,
-                       is_missing, FillValue, sf_rlist);
+                       is_missing, FillValue, sf_res->id);
+
+  return(contour_field_wrap(wks, field, cn_res, tm_res, special_res));
+}
+
+/*
+ * This function uses the HLUs to create a contour plot of 1D data on
+ * an existing mesh (see create_mesh).
+ */
+
+nglPlotId contour_mesh_wrap(int wks, int mesh, void *data, 
+                            const char *type, ResInfo *sf_res,
+                            ResInfo *cn_res, ResInfo *tm_res, 
+                            nglRes *special_res)
+{
+  nglPlotId plot;
+  int field;
+
+  field = mesh_scalar_field(mesh, data, type, sf_res->id);
+  if(field < 0) {
+    initialize_ids(&plot);
+    return(plot);
+  }
+  return(contour_field_wrap(wks, field, cn_res, tm_res, special_res));
+}
+
+/*
+ * This function creates a contour plot of an existing scalar field
+ * object, and draws it if requested.
+ */
+
+nglPlotId contour_field_wrap(int wks, int field, ResInfo *cn_res,
+                             ResInfo *tm_res, nglRes *special_res)
+{
+  double t0 = stats_begin();
+  nglPlotId plot;
+  int contour, cn_rlist;
+
+  cn_rlist = cn_res->id;
 
 /*
  * Assign the data object.
@@ -2042,6 +2907,7 @@ nglPlotId contour_wrap(int wks, void *data, const char *type, int ylen,
 /*
  * Return.
  */
+  stats_end("contour", t0, 0.);
   return(plot);
 }
 
@@ -2058,6 +2924,7 @@ nglPlotId xy_wrap(int wks, void *x, void *y, const char *type_x,
                   ResInfo *ca_res, ResInfo *xy_res, ResInfo *xyd_res,
                   nglRes *special_res)
 {
+  double t0 = stats_begin();
   int cafield, xy, grlist, *xyds;
   ng_size_t num_dspec;
   nglPlotId plot;
@@ -2170,6 +3037,7 @@ nglPlotId xy_wrap(int wks, void *x, void *y, const char *type_x,
 /*
  * Return.
  */
+  stats_end("xy", t0, 0.);
   return(plot);
 }
 
@@ -2211,6 +3079,7 @@ nglPlotId vector_wrap(int wks, void *u, void *v, const char *type_u,
                       ResInfo *vf_res, ResInfo *vc_res, ResInfo *tm_res,
                       nglRes *special_res)
 {
+  double t0 = stats_begin();
   int field, vector;
   nglPlotId plot;
   int vf_rlist, vc_rlist;
@@ -2296,6 +3165,7 @@ nglPlotId vector_wrap(int wks, void *u, void *v, const char *type_u,
 /*
  * Return.
  */
+  stats_end("vector", t0, 0.);
   return(plot);
 
 }
@@ -2315,6 +3185,7 @@ nglPlotId streamline_wrap(int wks, void *u, void *v, const char *type_u,
                           ResInfo *vf_res, ResInfo *st_res, 
                           ResInfo *tm_res, nglRes *special_res)
 {
+  double t0 = stats_begin();
   int field, streamline;
   int vf_rlist, st_rlist;
   nglPlotId plot;
@@ -2391,6 +3262,7 @@ nglPlotId streamline_wrap(int wks, void *u, void *v, const char *type_u,
 /*
  * Return.
  */
+  stats_end("streamline", t0, 0.);
   return(plot);
 }
 
@@ -2401,6 +3273,7 @@ nglPlotId streamline_wrap(int wks, void *u, void *v, const char *type_u,
 
 nglPlotId map_wrap(int wks, ResInfo *mp_res, nglRes *special_res)
 {
+  double t0 = stats_begin();
   int map;
   nglPlotId plot;
   int mp_rlist;
@@ -2442,6 +3315,7 @@ nglPlotId map_wrap(int wks, ResInfo *mp_res, nglRes *special_res)
 /*
  * Return.
  */
+  stats_end("map", t0, 0.);
   return(plot);
 }
 
@@ -2459,6 +3333,65 @@ nglPlotId contour_map_wrap(int wks, void *data, const char *type,
                            void *FillValue, ResInfo *sf_res, 
                            ResInfo *cn_res, ResInfo *mp_res,
                            nglRes *special_res)
+{
+  double t0 = stats_begin();
+  nglPlotId plot;
+  int field;
+
+/*
+ * Create a scalar field object that will be used as the
+ * dataset for the contour object.
+ */
+  field = scalar_field(data, type, ylen, xlen, is_ycoord, ycoord,
+                       ycoord_type, is_xcoord, xcoord, xcoord_type,
+                       is_missing, FillValue, sf_res->id);
+
+  plot = contour_field_map_wrap(wks, field, cn_res, mp_res, special_res);
+
+/*
+ * Return.
+ */
+  stats_end("contour_map", t0, 0.);
+  return(plot);
+}
+
+/*
+ * This function uses the HLUs to create a contour plot of 1D data on
+ * an existing mesh (see create_mesh), over a map.
+ */
+
+nglPlotId contour_map_mesh_wrap(int wks, int mesh, void *data,
+                                const char *type, ResInfo *sf_res, 
+                                ResInfo *cn_res, ResInfo *mp_res,
+                                nglRes *special_res)
+{
+  double t0 = stats_begin();
+  nglPlotId plot;
+  int field;
+
+  field = mesh_scalar_field(mesh, data, type, sf_res->id);
+  if(field < 0) {
+    initialize_ids(&plot);
+  }
+  else {
+    plot = contour_field_map_wrap(wks, field, cn_res, mp_res, special_res);
+  }
+
+/*
+ * Return.
+ */
+  stats_end("contour_map", t0, 0.);
+  return(plot);
+}
+
+/*
+ * This function overlays contours of an existing scalar field object
+ * on a map, and draws them if requested. It does the work for
+ * contour_map_wrap and contour_map_mesh_wrap.
+ */
+
+nglPlotId contour_field_map_wrap(int wks, int field, ResInfo *cn_res,
+                                 ResInfo *mp_res, nglRes *special_res)
 {
   nglRes special_res2;
   nglPlotId contour, map, plot;
@@ -2485,11 +3418,7 @@ nglPlotId contour_map_wrap(int wks, void *data, const char *type,
   special_res2.nglXAxisType = 0;
   special_res2.nglYAxisType = 0;
 
-  contour = contour_wrap(wks, data, type, ylen, xlen,
-                         is_ycoord, ycoord, ycoord_type,
-                         is_xcoord, xcoord, xcoord_type,
-                         is_missing, FillValue, sf_res, cn_res,
-                         NULL, &special_res2);
+  contour = contour_field_wrap(wks, field, cn_res, NULL, &special_res2);
 
 /*
  * Create map plot.
@@ -2532,9 +3461,6 @@ nglPlotId contour_map_wrap(int wks, void *data, const char *type,
   free(map.map);
   free(contour.contour);
 
-/*
- * Return.
- */
   return(plot);
 }
 
@@ -2552,6 +3478,7 @@ nglPlotId vector_map_wrap(int wks, void *u, void *v, const char *type_u,
                           ResInfo *vf_res, ResInfo *vc_res,
                           ResInfo *mp_res, nglRes *special_res)
 {
+  double t0 = stats_begin();
   nglRes special_res2;
   nglPlotId vector, map, plot;
   int old_scale;
@@ -2627,6 +3554,7 @@ nglPlotId vector_map_wrap(int wks, void *u, void *v, const char *type_u,
 /*
  * Return.
  */
+  stats_end("vector_map", t0, 0.);
   return(plot);
 }
 
@@ -2645,6 +3573,7 @@ nglPlotId streamline_map_wrap(int wks, void *u, void *v,
                               ResInfo *st_res, ResInfo *mp_res,
                               nglRes *special_res)
 {
+  double t0 = stats_begin();
   nglRes special_res2;
   nglPlotId streamline, map, plot;
   int old_scale;
@@ -2718,6 +3647,7 @@ nglPlotId streamline_map_wrap(int wks, void *u, void *v,
 /*
  * Return.
  */
+  stats_end("streamline_map", t0, 0.);
   return(plot);
 }
 
@@ -2739,6 +3669,7 @@ nglPlotId streamline_scalar_wrap(int wks, void *u, void *v, void *t,
                              ResInfo *st_res, ResInfo *tm_res, 
                              nglRes *special_res)
 {
+  double t0 = stats_begin();
   int vffield, sffield, streamline;
   nglPlotId plot;
   int vf_rlist, sf_rlist, st_rlist; 
@@ -2827,6 +3758,7 @@ nglPlotId streamline_scalar_wrap(int wks, void *u, void *v, void *t,
 /*
  * Return.
  */
+  stats_end("streamline_scalar", t0, 0.);
   return(plot);
 }
 
@@ -2848,6 +3780,7 @@ nglPlotId streamline_scalar_map_wrap(int wks, void *u, void *v, void *t,
                                  ResInfo *st_res, ResInfo *mp_res,
                                  nglRes *special_res)
 {
+  double t0 = stats_begin();
   nglRes special_res2;
   nglPlotId plot, streamline, map;
   int old_scale;
@@ -2934,6 +3867,7 @@ nglPlotId streamline_scalar_map_wrap(int wks, void *u, void *v, void *t,
 /*
  * Return.
  */
+  stats_end("streamline_scalar_map", t0, 0.);
   return(plot);
 }
 
@@ -2958,6 +3892,7 @@ nglPlotId vector_scalar_wrap(int wks, void *u, void *v, void *t,
                              ResInfo *vc_res, ResInfo *tm_res, 
                              nglRes *special_res)
 {
+  double t0 = stats_begin();
   int vffield, sffield, vector;
   nglPlotId plot;
   int vf_rlist, sf_rlist, vc_rlist; 
@@ -3049,6 +3984,7 @@ nglPlotId vector_scalar_wrap(int wks, void *u, void *v, void *t,
 /*
  * Return.
  */
+  stats_end("vector_scalar", t0, 0.);
   return(plot);
 }
 
@@ -3070,6 +4006,7 @@ nglPlotId vector_scalar_map_wrap(int wks, void *u, void *v, void *t,
                                  ResInfo *vc_res, ResInfo *mp_res,
                                  nglRes *special_res)
 {
+  double t0 = stats_begin();
   nglRes special_res2;
   nglPlotId plot, vector, map;
   int old_scale;
@@ -3156,9 +4093,155 @@ nglPlotId vector_scalar_map_wrap(int wks, void *u, void *v, void *t,
 /*
  * Return.
  */
+  stats_end("vector_scalar_map", t0, 0.);
   return(plot);
 }
 
+/*
+ * This function retrieves the levels a plot is currently using and
+ * sets them back explicitly, so that a later data update doesn't
+ * cause them to be recomputed from the new data.
+ */
+void fix_plot_levels(int plot, char *mode_resname, char *levels_resname)
+{
+  int grlist, srlist;
+  float *levels = (float *) NULL;
+  ng_size_t nlevels = 0;
+
+  grlist = NhlRLCreate(NhlGETRL);
+  NhlRLClear(grlist);
+  NhlRLGetFloatArray(grlist,levels_resname,&levels,&nlevels);
+  NhlGetValues(plot,grlist);
+
+  if(levels != NULL && nlevels > 0) {
+    srlist = NhlRLCreate(NhlSETRL);
+    NhlRLClear(srlist);
+    NhlRLSetString(srlist,mode_resname,"ExplicitLevels");
+    NhlRLSetFloatArray(srlist,levels_resname,levels,nlevels);
+    NhlSetValues(plot,srlist);
+    NhlRLDestroy(srlist);
+    NhlFree(levels);
+  }
+  NhlRLDestroy(grlist);
+}
+
+/*
+ * This function replaces the data array of the scalar field
+ * belonging to an existing contour plot and redraws it. The field,
+ * the plot, and anything overlaid on or annotating the plot are
+ * reused, so this is much cheaper than creating the plot again
+ * when only the data changes from frame to frame.
+ *
+ * If keep_levels is True, then the contour levels currently in use
+ * are kept, rather than being recomputed from the new data.
+ */
+
+void update_scalar_field_wrap(int wks, nglPlotId *plot, void *data,
+                              const char *type, int ylen, int xlen,
+                              int keep_levels, ResInfo *sf_res,
+                              ResInfo *cn_res, nglRes *special_res)
+{
+  int contour, rank, length[2];
+  int sf_rlist, cn_rlist;
+
+  if(plot->nsffield < 1 || plot->ncontour < 1) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"update_scalar_field_wrap: the given plot does not contain a contour plot, so it can't be updated.");
+    return;
+  }
+  contour  = *(plot->contour);
+  sf_rlist = sf_res->id;
+  cn_rlist = cn_res->id;
+
+  if(keep_levels) {
+    fix_plot_levels(contour, "cnLevelSelectionMode", "cnLevels");
+  }
+
+/*
+ * A 1D array goes to a mesh scalar field, which expects the
+ * same number of values as before.
+ */
+  length[0] = ylen;
+  if(xlen == -1) {
+    rank      = 1;
+    length[1] = ylen;
+  }
+  else {
+    rank      = 2;
+    length[1] = xlen;
+  }
+  set_resource("sfDataArray", sf_rlist, data, type, rank, length);
+  NhlSetValues(*(plot->sffield),sf_rlist);
+
+/*
+ * Any other contour resources are applied after the levels have
+ * been fixed, so the user can still override them.
+ */
+  if(cn_res->nstrings > 0) NhlSetValues(contour,cn_rlist);
+
+  NhlUpdateData(contour);
+
+/*
+ * Draw plot and advance frame. The fourth argument to draw_and_frame
+ * says whether this is a panel, not whether there's a map: for a
+ * contour overlaid on a map, plot->base is the map, so the map and
+ * everything on it is maximized and drawn just as when the plot was
+ * created by contour_field_map_wrap.
+ */
+  draw_and_frame(wks, plot, 1, 0, special_res);
+}
+
+/*
+ * This function is the vector field analog of
+ * update_scalar_field_wrap. It works for both vector and
+ * streamline plots.
+ */
+
+void update_vector_field_wrap(int wks, nglPlotId *plot, void *u, void *v,
+                              const char *type_u, const char *type_v,
+                              int ylen, int xlen, int keep_levels,
+                              ResInfo *vf_res, ResInfo *pl_res,
+                              nglRes *special_res)
+{
+  int vplot, length[2];
+  int vf_rlist, pl_rlist;
+
+  if(plot->nvffield < 1 || (plot->nvector < 1 && plot->nstreamline < 1)) {
+    NhlPError(NhlWARNING,NhlEUNKNOWN,"update_vector_field_wrap: the given plot does not contain a vector or streamline plot, so it can't be updated.");
+    return;
+  }
+  vf_rlist = vf_res->id;
+  pl_rlist = pl_res->id;
+
+  if(plot->nvector > 0) {
+    vplot = *(plot->vector);
+    if(keep_levels) {
+      fix_plot_levels(vplot, "vcLevelSelectionMode", "vcLevels");
+    }
+  }
+  else {
+    vplot = *(plot->streamline);
+    if(keep_levels) {
+      fix_plot_levels(vplot, "stLevelSelectionMode", "stLevels");
+    }
+  }
+
+  length[0] = ylen;
+  length[1] = xlen;
+  set_resource("vfUDataArray", vf_rlist, u, type_u, 2, length );
+  set_resource("vfVDataArray", vf_rlist, v, type_v, 2, length );
+  NhlSetValues(*(plot->vffield),vf_rlist);
+
+  if(pl_res->nstrings > 0) NhlSetValues(vplot,pl_rlist);
+
+  NhlUpdateData(vplot);
+
+/*
+ * Draw plot and advance frame. As above, plot->base is the map for
+ * a vector or streamline plot overlaid on one.
+ */
+  draw_and_frame(wks, plot, 1, 0, special_res);
+}
+
 
 nglPlotId text_ndc_wrap(int wks, char* string, void *x, void *y,
                         const char *type_x, const char *type_y,
@@ -3365,6 +4448,7 @@ void poly_wrap(int wks, nglPlotId *plot, void *x, void *y,
                void *FillValue_y, NhlPolyType polytype, ResInfo *gs_res,
                nglRes *special_res)
 {
+  double t0 = stats_begin();
   int i, gsid, newlen, *indices, ibeg, iend, nlines, color;
   int srlist, grlist;
   float *xf, *yf, *xfnew, *yfnew, *xfmsg, *yfmsg, thickness;
@@ -3490,7 +4574,7 @@ void poly_wrap(int wks, nglPlotId *plot, void *x, void *y,
   }
     
   if(special_res->nglFrame) NhlFrame(wks);
-
+  stats_end("poly", t0, 0.);
 }
 
 
@@ -3508,6 +4592,7 @@ nglPlotId add_poly_wrap(int wks, nglPlotId *plot, void *x, void *y,
                         NhlPolyType polytype, ResInfo *gs_res, 
                         nglRes *special_res)
 {
+  double t0 = stats_begin();
   int *primitive_object, gsid, pr_rlist;
   int i, newlen, *indices, nlines, npoly, ibeg, iend, npts;
   float *xf, *yf, *xfnew, *yfnew, *xfmsg, *yfmsg;
@@ -3730,6 +4815,7 @@ nglPlotId add_poly_wrap(int wks, nglPlotId *plot, void *x, void *y,
 /*
  * Return.
  */
+  stats_end("add_poly", t0, 0.);
   return(poly);
 }
 
@@ -4257,19 +5343,80 @@ void draw_colormap_wrap(int wks)
   }
 }
 
+/*
+ * Retrieve the viewport and the bounding box of a plot in one pass.
+ */
+void get_layout_box(int plot, nglLayoutBox *box)
+{
+  int grlist;
+
+  grlist = NhlRLCreate(NhlGETRL);
+  NhlRLClear(grlist);
+  NhlRLGetFloat(grlist,"vpXF",     &box->vpx);
+  NhlRLGetFloat(grlist,"vpYF",     &box->vpy);
+  NhlRLGetFloat(grlist,"vpWidthF", &box->vpw);
+  NhlRLGetFloat(grlist,"vpHeightF",&box->vph);
+  (void)NhlGetValues(plot, grlist);
+  NhlRLDestroy(grlist);
+
+  NhlGetBB(plot,&box->bb);
+}
+
+/*
+ * Compute the viewport and bounding box that a plot will have once
+ * its viewport is moved to (x,y) and its size is multiplied by
+ * "scale". The annotations are resized along with the viewport, so
+ * the distances from the viewport edges to the edges of the bounding
+ * box get multiplied by the same scale factor.
+ */
+void scale_layout_box(nglLayoutBox *box, float x, float y, float scale,
+                      nglLayoutBox *new_box)
+{
+  new_box->vpx  = x;
+  new_box->vpy  = y;
+  new_box->vpw  = scale * box->vpw;
+  new_box->vph  = scale * box->vph;
+
+  new_box->bb.l = x - scale * (box->vpx - box->bb.l);
+  new_box->bb.r = x + new_box->vpw + scale * (box->bb.r - 
+                                              (box->vpx + box->vpw));
+  new_box->bb.t = y + scale * (box->bb.t - box->vpy);
+  new_box->bb.b = y - new_box->vph - scale * ((box->vpy - box->vph) - 
+                                              box->bb.b);
+}
+
+/*
+ * Return the layout table computed by the last call to panel_wrap,
+ * and the number of rows in it. Each row holds vpXF, vpYF, vpWidthF,
+ * and vpHeightF for one plot (-999 for missing plots), and the last
+ * row is for the common labelbar, if any.
+ */
+int get_panel_layout(float **layout)
+{
+  *layout = panel_layout;
+  return(npanel_layout);
+}
+
 /*
  * Routine for paneling same-sized plots.
+ *
+ * The viewport and bounding box of each plot are retrieved only once,
+ * into a layout table, and the positions and bounding boxes of the
+ * rescaled plots are computed from this table rather than retrieved
+ * again after each plot is moved. If nglPanelLayoutOnly is set, the
+ * layout is computed but the plots are neither changed nor drawn.
  */
 void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims, 
                 int ndims, ResInfo *lb_res, ResInfo *fs_res,
                 nglRes *special_res)
 {
+  double t0 = stats_begin();
   int i, nplots, npanels, is_row_spec, nrows, ncols, draw_boxes = 0;
   int num_plots_left, nplot, nplot4, nr, nc, new_ncols, nnewplots;
   nglPlotId *newplots, pplot;
   int *row_spec, first_time;
   int nvalid_plot, nvalid_plots, valid_plot;
-  int panel_save, panel_debug, panel_center;
+  int panel_save, panel_debug, panel_center, layout_only;
   int panel_labelbar, main_string_on, is_figure_strings, explicit;
   int fs_bkgrn, fs_perim_on, just;
   int *anno, fs_text, added_anno, am_rlist;
@@ -4291,7 +5438,7 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
   float xlft, xrgt, xbot, xtop;
   float xsp, ysp, xwsp_perc, ywsp_perc, xwsp, ywsp;
   float vpx, vpy, vpw, vph, dxl, dxr, dyt, dyb;
-  float *old_vp, *xpos, *ypos, max_rgt, max_top;
+  float *xpos, *ypos, max_rgt, max_top, *lb_layout;
   float top, bottom, left, right;
   float newtop, newbot, newrgt, newlft;
   float plot_width, plot_height, total_width, total_height;
@@ -4300,7 +5447,8 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
   float scaled_width, scaled_height, xrange, yrange;
   float scale, row_scale, col_scale, max_width, max_height;
   int grlist, sr_list;
-  NhlBoundingBox bb, *newbb;
+  NhlBoundingBox *newbb;
+  nglLayoutBox *lbox, *newbox;
   int lb_rlist, fs_rlist;
 
 /*
@@ -4309,6 +5457,13 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
   lb_rlist = lb_res->id;
   fs_rlist = fs_res->id;
 
+/*
+ * Throw away the layout table from the previous call.
+ */
+  if(panel_layout != NULL) free(panel_layout);
+  panel_layout  = NULL;
+  npanel_layout = 0;
+
 /*
  * Resource lists for getting and retrieving resources.
  */
@@ -4363,6 +5518,7 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
   panel_save        = special_res->nglPanelSave;
   panel_debug       = special_res->nglDebug;
   panel_center      = special_res->nglPanelCenter;
+  layout_only       = special_res->nglPanelLayoutOnly;
   is_figure_strings = special_res->nglPanelFigureStringsCount;
   panel_labelbar    = special_res->nglPanelLabelBar;
   just              = special_res->nglPanelFigureStringsJust;
@@ -4510,21 +5666,35 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
     return;
   }
   
+/*
+ * Initialize the layout table that can be retrieved afterwards
+ * with get_panel_layout. (The previous table was thrown away on
+ * entry, so an early return leaves an empty table, not a stale one.)
+ */
+  npanel_layout = nplots_orig + 1;
+  panel_layout  = (float *)malloc(4 * npanel_layout * sizeof(float));
+  for(i = 0; i < 4 * npanel_layout; i++) panel_layout[i] = -999.;
+  lb_layout = &panel_layout[4 * nplots_orig];
+
 /* 
+ * Retrieve the viewport and bounding box of every plot just once.
+ * Everything else is calculated from these values.
+ *
  * We assume all plots are the same size, so if we get the size of
  * one of them, then this should represent the size of the rest
  * of them.  Also, count the number of non-missing plots for later.
  */
+  lbox         = (nglLayoutBox *)malloc(nplots * sizeof(nglLayoutBox));
   valid_plot   = -1;
   nvalid_plots = 0;
   for(i = 0; i < nplots; i++) {
     if(plots[i].nbase > 0 && plots[i].base != NULL) {
+      get_layout_box(*(plots[i].base),&lbox[i]);
       if(valid_plot < 0) {
-        NhlGetBB(*(plots[i].base),&bb);
-        top    = bb.t;
-        bottom = bb.b;
-        left   = bb.l;
-        right  = bb.r;
+        top    = lbox[i].bb.t;
+        bottom = lbox[i].bb.b;
+        left   = lbox[i].bb.l;
+        right  = lbox[i].bb.r;
         valid_plot = i;
       }
       nvalid_plots++;
@@ -4532,6 +5702,8 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
   }
   if(nvalid_plots == 0) {
     NhlPError(NhlFATAL,NhlEUNKNOWN,"panel: all of the plots passed to panel appear to be invalid\n");
+    free(lbox);
+    npanel_layout = 0;
     return;
   }  
   else {
@@ -4832,12 +6004,10 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
  * viewport sizes from, because some users knowingly make the first
  * plot larger, and go ahead and panel them anyway.
  */
-  NhlRLClear(grlist);
-  NhlRLGetFloat(grlist,"vpXF",     &vpx);
-  NhlRLGetFloat(grlist,"vpYF",     &vpy);
-  NhlRLGetFloat(grlist,"vpWidthF", &vpw);
-  NhlRLGetFloat(grlist,"vpHeightF",&vph);
-  (void)NhlGetValues(*(plots[valid_plot].base), grlist);
+  vpx = lbox[valid_plot].vpx;
+  vpy = lbox[valid_plot].vpy;
+  vpw = lbox[valid_plot].vpw;
+  vph = lbox[valid_plot].vph;
   
 /*
  * Calculate distances from plot's left/right/top/bottom positions
@@ -4902,10 +6072,10 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
   max_top = 0.;
 
 /*
- * Variable to hold original viewport coordinates, and annotations (if
- * they exist).
+ * Variable to hold the viewports and bounding boxes of the rescaled
+ * plots, plus the labelbar.
  */
-  old_vp = (float *)malloc(4 * nplots * sizeof(float));
+  newbox = (nglLayoutBox *)malloc(nnewplots * sizeof(nglLayoutBox));
 
 /*
  * Loop through each row and create each plot in the new scaled-down
@@ -4942,43 +6112,54 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
         pplot.base = plots[nplot].base;
         nplot4 = nplot * 4;
 /*
- * Get the size of the plot so we can rescale it. Technically, each
- * plot should be the exact same size, but we can't assume that.
+ * Compute the new size and position of the plot, and of its
+ * bounding box, from the ones we retrieved earlier. Technically,
+ * each plot should be the exact same size, but we can't assume that.
  */
-        NhlRLClear(grlist);
-        NhlRLGetFloat(grlist,"vpXF",     &old_vp[nplot4]);
-        NhlRLGetFloat(grlist,"vpYF",     &old_vp[nplot4+1]);
-        NhlRLGetFloat(grlist,"vpWidthF", &old_vp[nplot4+2]);
-        NhlRLGetFloat(grlist,"vpHeightF",&old_vp[nplot4+3]);
-        (void)NhlGetValues(*(pplot.base), grlist);
+        scale_layout_box(&lbox[nplot],xpos[nc],ypos[nr],scale,
+                         &newbox[nvalid_plot]);
         
         if(panel_debug) {
           printf("-------Panel viewport values for each plot-------\n");
           printf("    plot # %d\n", nplot);
           printf("    x,y     = %g,%g\n", xpos[nc], ypos[nr]);
-          printf("orig wdt,hgt = %g,%g\n", old_vp[nplot4+2], 
-                                           old_vp[nplot4+3]);
-          printf("    wdt,hgt = %g,%g\n", scale*old_vp[nplot4+2], 
-                                          scale*old_vp[nplot4+3]);
+          printf("orig wdt,hgt = %g,%g\n", lbox[nplot].vpw, 
+                                           lbox[nplot].vph);
+          printf("    wdt,hgt = %g,%g\n", newbox[nvalid_plot].vpw, 
+                                          newbox[nvalid_plot].vph);
         }
 
-        NhlRLClear(sr_list);
-        NhlRLSetFloat(sr_list,"vpXF",     xpos[nc]);
-        NhlRLSetFloat(sr_list,"vpYF",     ypos[nr]);
-        NhlRLSetFloat(sr_list,"vpWidthF", scale*old_vp[nplot4+2]);
-        NhlRLSetFloat(sr_list,"vpHeightF",scale*old_vp[nplot4+3]);
-        (void)NhlSetValues(*(pplot.base), sr_list);
+/*
+ * Once the plot has really been moved, retrieve its viewport and
+ * bounding box again, so the layout table and the labelbar placement
+ * use what HLU actually did rather than our estimate. Only in
+ * layout-only mode, where the plots are left alone, is the estimate
+ * kept.
+ */
+        if(!layout_only) {
+          NhlRLClear(sr_list);
+          NhlRLSetFloat(sr_list,"vpXF",     xpos[nc]);
+          NhlRLSetFloat(sr_list,"vpYF",     ypos[nr]);
+          NhlRLSetFloat(sr_list,"vpWidthF", newbox[nvalid_plot].vpw);
+          NhlRLSetFloat(sr_list,"vpHeightF",newbox[nvalid_plot].vph);
+          (void)NhlSetValues(*(pplot.base), sr_list);
+          get_layout_box(*(pplot.base),&newbox[nvalid_plot]);
+        }
+        panel_layout[nplot4]   = newbox[nvalid_plot].vpx;
+        panel_layout[nplot4+1] = newbox[nvalid_plot].vpy;
+        panel_layout[nplot4+2] = newbox[nvalid_plot].vpw;
+        panel_layout[nplot4+3] = newbox[nvalid_plot].vph;
 
 /*
  * Retain maximum width and height for later.
  */
         if(!first_time) {
-          max_width  = max(max_width, old_vp[nplot4+2]);
-          max_height = max(max_height,old_vp[nplot4+3]);
+          max_width  = max(max_width, lbox[nplot].vpw);
+          max_height = max(max_height,lbox[nplot].vph);
         }
         else {
-          max_width  = old_vp[nplot4+2];
-          max_height = old_vp[nplot4+3];
+          max_width  = lbox[nplot].vpw;
+          max_height = lbox[nplot].vph;
           first_time = 0;
         }
 
@@ -4987,7 +6168,8 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
  */
         added_anno = 0;
         if(is_figure_strings) {
-          if(nplot < special_res->nglPanelFigureStringsCount && 
+          if(!layout_only &&
+             nplot < special_res->nglPanelFigureStringsCount && 
              (panel_strings[nplot] != NULL) &&
              strcmp(panel_strings[nplot],"")) {
 /*
@@ -5012,6 +6194,11 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
             NhlRLSetFloat   (am_rlist,"amOrthogonalPosF" , orth);
             NhlRLSetInteger (am_rlist,"amResizeNotify"   , True);
             (void)NhlSetValues(anno[nplot], am_rlist);
+/*
+ * The figure string may stick out of the plot, so retrieve the
+ * bounding box again for this one.
+ */
+            NhlGetBB(*(pplot.base),&newbox[nvalid_plot].bb);
           }
           else {
             anno[i] = -1;
@@ -5025,11 +6212,10 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
  * Info for possible labelbar or main_string
  */
         if(main_string_on || panel_labelbar || draw_boxes) {
-          NhlGetBB(*(pplot.base),&bb);
-          top    = bb.t;
-          bottom = bb.b;
-          left   = bb.l;
-          right  = bb.r;
+          top    = newbox[nvalid_plot].bb.t;
+          bottom = newbox[nvalid_plot].bb.b;
+          left   = newbox[nvalid_plot].bb.l;
+          right  = newbox[nvalid_plot].bb.r;
           max_rgt = max(right,max_rgt);
           max_top = max(top,max_top);
         }
@@ -5137,50 +6323,62 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
           lb_y += special_res->nglPanelLabelBarParallelPosF;
         }
       }
+      lb_layout[0] = lb_x;
+      lb_layout[1] = lb_y;
+      lb_layout[2] = lb_width;
+      lb_layout[3] = lb_height;
+
+      if(!layout_only) {
 /*
  * Now begin setting the labelbar resources.
  */
-      NhlRLSetFloat       (lb_rlist,"vpXF",              lb_x);
-      NhlRLSetFloat       (lb_rlist,"vpYF",              lb_y);
-      NhlRLSetFloat       (lb_rlist,"vpWidthF",          lb_width);
-      NhlRLSetFloat       (lb_rlist,"vpHeightF",         lb_height);
-      NhlRLSetString      (lb_rlist,"lbAutoManage",      "False");
-      NhlRLSetInteger     (lb_rlist,"lbOrientation",     lb_orient);
-      NhlRLSetIntegerArray(lb_rlist,"lbFillColors",      colors, ncolors);
-      NhlRLSetInteger     (lb_rlist,"lbBoxCount",        (int)ncolors);
-      if(!strcmp(plot_type,"contour")) {
-	NhlRLSetStringArray (lb_rlist,"lbLabelStrings", lstrings, nstrings);
-      }
-      else {
-	NhlRLSetFloatArray  (lb_rlist,"lbLabelStrings", levels, nlevels);
-      }
+        NhlRLSetFloat       (lb_rlist,"vpXF",              lb_x);
+        NhlRLSetFloat       (lb_rlist,"vpYF",              lb_y);
+        NhlRLSetFloat       (lb_rlist,"vpWidthF",          lb_width);
+        NhlRLSetFloat       (lb_rlist,"vpHeightF",         lb_height);
+        NhlRLSetString      (lb_rlist,"lbAutoManage",      "False");
+        NhlRLSetInteger     (lb_rlist,"lbOrientation",     lb_orient);
+        NhlRLSetIntegerArray(lb_rlist,"lbFillColors",      colors, ncolors);
+        NhlRLSetInteger     (lb_rlist,"lbBoxCount",        (int)ncolors);
+        if(!strcmp(plot_type,"contour")) {
+	  NhlRLSetStringArray (lb_rlist,"lbLabelStrings", lstrings, nstrings);
+        }
+        else {
+	  NhlRLSetFloatArray  (lb_rlist,"lbLabelStrings", levels, nlevels);
+        }
       
-      NhlRLSetInteger     (lb_rlist,"lbPerimOn",         lb_perim_on);
-      NhlRLSetInteger     (lb_rlist,"lbLabelAutoStride", lb_auto_stride);
-      NhlRLSetFloat       (lb_rlist,"lbLabelFontHeightF",lb_fh);
-      NhlRLSetInteger     (lb_rlist,"lbLabelAlignment",  lb_alignment);
-      /*
-       * Check if we want different fill patterns or fill scales.  If so, we
-       * have to pass these on to the labelbar.
-       */
-      NhlRLSetInteger(lb_rlist,"lbMonoFillColor",   mono_fill_col);
-      NhlRLSetInteger(lb_rlist,"lbMonoFillPattern", mono_fill_pat);
-      if(!mono_fill_pat) {
-        NhlRLSetIntegerArray(lb_rlist,"lbFillPatterns", patterns, npatterns);
-      }
-      NhlRLSetInteger(lb_rlist,"lbMonoFillScale", mono_fill_scl);
-      if(!mono_fill_scl) {
-        NhlRLSetFloatArray(lb_rlist,"lbFillScale", scales, nscales);
-      }
+        NhlRLSetInteger     (lb_rlist,"lbPerimOn",         lb_perim_on);
+        NhlRLSetInteger     (lb_rlist,"lbLabelAutoStride", lb_auto_stride);
+        NhlRLSetFloat       (lb_rlist,"lbLabelFontHeightF",lb_fh);
+        NhlRLSetInteger     (lb_rlist,"lbLabelAlignment",  lb_alignment);
+        /*
+         * Check if we want different fill patterns or fill scales.  If so, we
+         * have to pass these on to the labelbar.
+         */
+        NhlRLSetInteger(lb_rlist,"lbMonoFillColor",   mono_fill_col);
+        NhlRLSetInteger(lb_rlist,"lbMonoFillPattern", mono_fill_pat);
+        if(!mono_fill_pat) {
+          NhlRLSetIntegerArray(lb_rlist,"lbFillPatterns", patterns, npatterns);
+        }
+        NhlRLSetInteger(lb_rlist,"lbMonoFillScale", mono_fill_scl);
+        if(!mono_fill_scl) {
+          NhlRLSetFloatArray(lb_rlist,"lbFillScale", scales, nscales);
+        }
 /*
  * Create the labelbar and add to our list of plots.
  */
-      NhlCreate(&labelbar_object,"labelbar",NhllabelBarClass,wks,lb_rlist);
-      *(newplots[nvalid_plot].base) = labelbar_object;
+        NhlCreate(&labelbar_object,"labelbar",NhllabelBarClass,wks,lb_rlist);
+        *(newplots[nvalid_plot].base) = labelbar_object;
+        newbox[nvalid_plot].vpx = lb_x;
+        newbox[nvalid_plot].vpy = lb_y;
+        newbox[nvalid_plot].vpw = lb_width;
+        newbox[nvalid_plot].vph = lb_height;
+        NhlGetBB(labelbar_object,&newbox[nvalid_plot].bb);
 /*
  * Increment plot counter.
  */
-      nvalid_plot++;
+        nvalid_plot++;
+      }
 /*
  * Free up memory.
  */
@@ -5211,13 +6409,28 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
  * not to indicate the rightmost location of the rightmost graphic
  * (which could be a vertical labelbar.
  */
+/*
+ * If we are only computing the layout, then we are done. None of the
+ * plots have been changed, so there's nothing to restore.
+ */
+  if(layout_only) {
+    if(!is_row_spec) free(row_spec);
+    free(newplots);
+    free(lbox);
+    free(newbox);
+    free(ypos);
+    stats_end("panel", t0, 0.);
+    return;
+  }
+
   newbb  = (NhlBoundingBox *)malloc(nnewplots*sizeof(NhlBoundingBox));
 /*
  * Get largest bounding box that encompasses all non-missing graphical
- * objects.
+ * objects. These were already computed above, so there's no need to 
+ * retrieve them from the plots again.
  */
   for( i = 0; i < nnewplots; i++ ) { 
-    NhlGetBB(*(newplots[i].base),&newbb[i]);
+    newbb[i] = newbox[i].bb;
 
     if(i) {
       newtop = max(newtop,newbb[i].t);
@@ -5235,12 +6448,10 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
  * that we can calculate the distances between the viewport
  * coordinates and the edges of the bounding boxes.
  */
-      NhlRLClear(grlist);
-      NhlRLGetFloat(grlist,"vpXF",      &vpx);
-      NhlRLGetFloat(grlist,"vpYF",      &vpy);
-      NhlRLGetFloat(grlist,"vpWidthF",  &vpw);
-      NhlRLGetFloat(grlist,"vpHeightF", &vph);
-      (void)NhlGetValues(*(newplots[i].base), grlist);
+      vpx = newbox[i].vpx;
+      vpy = newbox[i].vpy;
+      vpw = newbox[i].vpw;
+      vph = newbox[i].vph;
       dxl = vpx-newbb[i].l;
       dxr = newbb[i].r-(vpx+vpw);
       dyt = (newbb[i].t-vpy);
@@ -5298,7 +6509,9 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
  * also where the plots will be maximized for PostScript output,
  * if so indicated.
  */
+  panel_bb = newbb;
   draw_and_frame(wks, newplots, nnewplots, 1, special_res);
+  panel_bb = NULL;
 
 /*
  * Restore nglPanelInvsbl* resources because these should only
@@ -5319,22 +6532,22 @@ void panel_wrap(int wks, nglPlotId *plots, int nplots_orig, int *dims,
           NhlRemoveAnnotation(*(plots[i].base),anno[i]);
         }
 
-        nplot4 = 4 * i;
-        
         NhlRLClear(sr_list);
-        NhlRLSetFloat(sr_list,"vpXF",     old_vp[nplot4]);
-        NhlRLSetFloat(sr_list,"vpYF",     old_vp[nplot4+1]);
-        NhlRLSetFloat(sr_list,"vpWidthF", old_vp[nplot4+2]);
-        NhlRLSetFloat(sr_list,"vpHeightF",old_vp[nplot4+3]);
+        NhlRLSetFloat(sr_list,"vpXF",     lbox[i].vpx);
+        NhlRLSetFloat(sr_list,"vpYF",     lbox[i].vpy);
+        NhlRLSetFloat(sr_list,"vpWidthF", lbox[i].vpw);
+        NhlRLSetFloat(sr_list,"vpHeightF",lbox[i].vph);
         (void)NhlSetValues(*(plots[i].base), sr_list);
       }
     }
   }
   if(!is_row_spec) free(row_spec);
   free(newplots);
-  free(old_vp);
+  free(lbox);
+  free(newbox);
   free(ypos);
   free(newbb);
+  stats_end("panel", t0, 0.);
 }
 
 void c_wmbarbp(int wksid, float x, float y, float u, float v) {
@@ -5372,28 +6585,93 @@ void c_wmbarbp(int wksid, float x, float y, float u, float v) {
   gdeactivate_ws (wksid);
 }
 
+/*
+ * Draws n wind barbs in one call. The workstation is activated once,
+ * and over a map all the points are projected first, so that the
+ * ones that aren't visible are dropped before any barb is drawn.
+ */
+void c_wmbarbs(int wksid, double *x, double *y, double *u, double *v,
+               int n) {
+
+  int i, ezf, nvis;
+  float *xt, *yt, *ut, *vt, xtn, ytn, ang1, ang2, vlen, xtm, ytm;
+  float d2r=0.01745329;
+
+  if (n <= 0) return;
+
+  gactivate_ws (wksid);
+  c_wmgeti("ezf",&ezf);
+  if (ezf != -1) {
+    xt = (float *)malloc(4*n*sizeof(float));
+    yt = &xt[n];
+    ut = &xt[2*n];
+    vt = &xt[3*n];
+/*
+ * Project the points and find the direction of each barb on the map,
+ * as in c_wmbarbp, keeping only the visible ones.
+ */
+    nvis = 0;
+    for (i = 0; i < n; i++) {
+      c_maptrn((float)x[i], (float)y[i], &xt[nvis], &yt[nvis]);
+      if (xt[nvis] == (float)1.e12) continue;
+      ang1 = atan2(u[i],v[i]);
+      xtm  = x[i] + 0.1 * cos(ang1);
+      ytm  = y[i] + 0.1 * sin(ang1)/cos(d2r*x[i]);
+      c_maptrn(xtm, ytm, &xtn, &ytn);
+      ang2 = atan2(ytn-yt[nvis],xtn-xt[nvis]);
+      vlen = sqrt(u[i]*u[i] + v[i]*v[i]);
+      ut[nvis] = vlen*cos(ang2);
+      vt[nvis] = vlen*sin(ang2);
+      nvis++;
+    }
+    for (i = 0; i < nvis; i++) {
+      c_wmbarb(xt[i], yt[i], ut[i], vt[i]);
+    }
+    free(xt);
+  }
+  else {
+    for (i = 0; i < n; i++) {
+      c_wmbarb((float)x[i], (float)y[i], (float)u[i], (float)v[i]);
+    }
+  }
+
+  gdeactivate_ws (wksid);
+}
+
+/*
+ * Corrects the two wind direction digits dd of a station string at
+ * (x,y), which projects to (xt,yt), for the map projection. North is
+ * coded as 36, never 00, and a calm wind (00) is left alone.
+ */
+static void wmstnm_rotate(float x, float y, float xt, float yt, char *dd)
+{
+  int iang;
+  float xtt, ytt, fang;
+
+  if (!isdigit(dd[0]) || !isdigit(dd[1])) return;
+  if (dd[0] == '0' && dd[1] == '0') return;
+
+  fang = 10.*0.0174532925199*(10*(dd[0]-'0') + (dd[1]-'0'));
+  c_maptrn(x+0.1*cos(fang),
+           y+0.1/cos(0.0174532925199*x)*sin(fang), &xtt, &ytt);
+  fang = fmod(57.2957795130823*atan2(xtt-xt, ytt-yt)+360., 360.);
+  iang = NINT(fang/10.);
+  if (iang <= 0 || iang > 36) iang = 36;
+  dd[0] = '0' + iang/10;
+  dd[1] = '0' + iang%10;
+}
+
 void c_wmstnmp(int wksid, float x, float y, char *imdat) {
 
-  int ezf,iang;
-  float xt,yt,xtt,ytt,fang;
-  char tang[3];
+  int ezf;
+  float xt,yt;
   
   gactivate_ws (wksid);
   c_wmgeti("ezf",&ezf);
   if (ezf != -1) {
     c_maptrn(x,y,&xt,&yt);
     if (xt != 1.e12) {
-      tang[0] = imdat[6];
-      tang[1] = imdat[7];
-      tang[2] = 0;
-      fang = 10.*0.0174532925199*atof(tang);
-      c_maptrn(x+0.1*cos(fang),
-           y+0.1/cos(0.0174532925199*x)*sin(fang), &xtt, &ytt);
-      fang = fmod(57.2957795130823*atan2(xtt-xt, ytt-yt)+360., 360.);
-      iang = (int) max(0,min(35,NINT(fang/10.)));
-      sprintf(tang,"%2d",iang);
-      imdat[6] = tang[0];
-      imdat[7] = tang[1];
+      wmstnm_rotate(x, y, xt, yt, &imdat[6]);
       c_wmstnm(xt, yt, imdat);
     }
   }
@@ -5403,6 +6681,118 @@ void c_wmstnmp(int wksid, float x, float y, char *imdat) {
   gdeactivate_ws (wksid);
 }
 
+/*
+ * Draws n station models in one call. imdat holds the n 50-character
+ * station strings one after another, and is changed in place: over a
+ * map, the wind direction digits of each station are corrected for
+ * the projection, as in c_wmstnmp.
+ *
+ * If thin is positive, a station is skipped if it would be closer
+ * than thin (in NDC) to a station earlier in the list that is drawn,
+ * so stations should be given in order of priority.
+ */
+void c_wmstnms(int wksid, double *x, double *y, int n, char *imdat,
+               double thin) {
+
+  int i, j, k, ezf, nvis, ll, ngrid, gx, gy, gi, gj, keep;
+  int *vis, *head, *next;
+  float *xt, *yt;
+  float fl, fr, fb, ft, ul, ur, ub, ut;
+  double *xn, *yn, dx, dy, cell;
+  char *stn;
+
+  if (n <= 0) return;
+
+  xt  = (float *)malloc(2*n*sizeof(float));
+  yt  = &xt[n];
+  vis = (int *)malloc(n*sizeof(int));
+
+  gactivate_ws (wksid);
+  c_wmgeti("ezf",&ezf);
+/*
+ * Project the stations and correct their wind directions, keeping
+ * the indices of the visible ones.
+ */
+  nvis = 0;
+  for (i = 0; i < n; i++) {
+    stn = &imdat[50*i];
+    if (ezf == -1) {
+      xt[nvis] = (float)x[i];
+      yt[nvis] = (float)y[i];
+    }
+    else {
+      c_maptrn((float)x[i], (float)y[i], &xt[nvis], &yt[nvis]);
+      if (xt[nvis] == (float)1.e12) continue;
+      wmstnm_rotate((float)x[i], (float)y[i], xt[nvis], yt[nvis], &stn[6]);
+    }
+    vis[nvis++] = i;
+  }
+
+/*
+ * Thin the visible stations on a grid of cells at least thin wide in
+ * NDC, so only the stations in the 3x3 cells around each one need to
+ * be checked.
+ */
+  if (thin > 0. && nvis > 1) {
+    c_getset(&fl,&fr,&fb,&ft,&ul,&ur,&ub,&ut,&ll);
+    xn = (double *)malloc(2*nvis*sizeof(double));
+    yn = &xn[nvis];
+    for (i = 0; i < nvis; i++) {
+      xn[i] = fl + (xt[i]-ul)/(ur-ul)*(fr-fl);
+      yn[i] = fb + (yt[i]-ub)/(ut-ub)*(ft-fb);
+    }
+    ngrid = (int) (1./thin);
+    ngrid = max(1,min(1024,ngrid));
+    cell  = 1./ngrid;
+    head  = (int *)malloc(ngrid*ngrid*sizeof(int));
+    next  = (int *)malloc(nvis*sizeof(int));
+    for (i = 0; i < ngrid*ngrid; i++) head[i] = -1;
+    k = 0;
+    for (i = 0; i < nvis; i++) {
+      gx = max(0,min(ngrid-1,(int)floor(xn[i]/cell)));
+      gy = max(0,min(ngrid-1,(int)floor(yn[i]/cell)));
+      keep = 1;
+      for (gj = max(0,gy-1); keep && gj <= min(ngrid-1,gy+1); gj++) {
+        for (gi = max(0,gx-1); keep && gi <= min(ngrid-1,gx+1); gi++) {
+          for (j = head[gj*ngrid+gi]; j >= 0; j = next[j]) {
+            dx = xn[i]-xn[j];
+            dy = yn[i]-yn[j];
+            if (dx*dx + dy*dy < thin*thin) {
+              keep = 0;
+              break;
+            }
+          }
+        }
+      }
+      if (!keep) continue;
+/*
+ * Kept stations are moved down to position k; next and xn/yn are
+ * indexed by that position.
+ */
+      xn[k] = xn[i];
+      yn[k] = yn[i];
+      xt[k] = xt[i];
+      yt[k] = yt[i];
+      vis[k] = vis[i];
+      next[k] = head[gy*ngrid+gx];
+      head[gy*ngrid+gx] = k;
+      k++;
+    }
+    nvis = k;
+    free(head);
+    free(next);
+    free(xn);
+  }
+
+  for (i = 0; i < nvis; i++) {
+    c_wmstnm(xt[i], yt[i], &imdat[50*vis[i]]);
+  }
+  gdeactivate_ws (wksid);
+
+  free(xt);
+  free(vis);
+}
+
 void c_wmsetip(char* string, int v) {
   c_wmseti(string, v);
 }
@@ -85,6 +85,7 @@ typedef struct {
   float nglPanelInvsblLeft;
   float nglPanelInvsblRight;
   float nglPanelInvsblBottom;
+  int   nglPanelLayoutOnly;
 
 /*
  * Special resource for figure strings.
@@ -177,6 +178,35 @@ typedef struct {
   int   nvffield;
 } nglPlotId;
 
+/*
+ * Define a structure to hold the viewport and bounding box of one
+ * plot, so a panel layout can be computed without querying the plot
+ * over and over again.
+ */
+typedef struct {
+  float vpx;
+  float vpy;
+  float vpw;
+  float vph;
+  NhlBoundingBox bb;
+} nglLayoutBox;
+
+/*
+ * Define a structure to hold an unstructured mesh that can be shared
+ * by several contour plots.
+ */
+typedef struct {
+  int    npts;
+  float *x;
+  float *y;
+  int    nvert;
+  float *xbounds;
+  float *ybounds;
+  int    ntri;
+  int   *nodes;
+  int    triangulated;
+} nglMesh;
+
 /*
  *  Structure for passing resource list information.
  */
@@ -184,6 +214,7 @@ typedef struct _ResInfo {
   int id;
   int nstrings;
   char **strings;
+  void *temps;
 } ResInfo;
 
 /*
@@ -200,6 +231,13 @@ extern int is_res_set(ResInfo *, char *);
 extern void getbb (int pid, float *t, float *b, float *l, float *r);
 extern void compute_ps_device_coords(int, nglPlotId *, int, nglRes *);
 
+extern void get_layout_box(int, nglLayoutBox *);
+
+extern void scale_layout_box(nglLayoutBox *, float, float, float,
+                             nglLayoutBox *);
+
+extern int get_panel_layout(float **);
+
 extern void maximize_plots(int, nglPlotId *, int, int, nglRes *);
 
 extern void overlay_on_irregular(int, nglPlotId *asplot, ResInfo *, 
@@ -221,6 +259,36 @@ extern int *get_non_missing_pairs(float *, float *, int, int, float *,
 extern void collapse_nomsg_xy(float *, float *, float **, float **, int, int,
                               int, float *, float *, int *);
 
+extern int region_cull(double *, double *, int, int, double, double, 
+                       double, double, double, int *);
+
+extern int decimate_xy(double *, double *, int, double, double, int, int,
+                       int, double, int, double, double *, double *);
+
+extern int histogram2d(double *, double *, int, int, int, double, double,
+                       double, double, int, double, int, double, double *);
+
+extern void raster_fill_cells(double *, int, int, int, int, double *, int,
+                              int *, int, double, int, int *);
+
+extern int raster_fill_wrap(int, int, double *, int, int, double, double,
+                            double, double, int, double *, int, int *, int,
+                            double, int);
+
+extern unsigned char *png_to_rgba(unsigned char *, int, int *, int *);
+
+extern double stats_time();
+extern void set_stats(int);
+extern int get_stats_level();
+extern double stats_begin();
+extern void stats_end(const char *, double, double);
+extern int get_nstats();
+extern const char *get_stat(int, long *, double *, double *);
+extern int get_ntrace_events();
+extern const char *get_trace_event(int, double *, double *);
+
+extern int load_colormap_files();
+
 extern void set_resource(char *, int, void *, const char *, int, int *);
 
 extern int create_graphicstyle_object(int);
@@ -247,6 +315,20 @@ extern int vector_field(void *, void *, const char *, const char *, int,
                         int, int, void *, const char *, int, void*, 
                         const char *, int, int, void *, void *, int);
 
+/*
+ * Mesh routines, for sharing one unstructured grid among several
+ * contour plots.
+ */
+
+extern int *c_csstri(int, float [], float [], int *, int *);
+
+extern int create_mesh(double *, double *, int, double *, double *, int,
+                       int *, int, int);
+
+extern void destroy_mesh(int);
+
+extern int mesh_scalar_field(int, void *, const char *, int);
+
 /*
  * Workstation routine.
  */
@@ -264,6 +346,13 @@ extern nglPlotId contour_wrap(int, void *, const char *, int, int,
                               const char *, int, void *, ResInfo *,
                               ResInfo *, ResInfo *, nglRes *);
 
+extern nglPlotId contour_mesh_wrap(int, int, void *, const char *, 
+                                   ResInfo *, ResInfo *, ResInfo *,
+                                   nglRes *);
+
+extern nglPlotId contour_field_wrap(int, int, ResInfo *, ResInfo *,
+                                    nglRes *);
+
 extern nglPlotId xy_wrap(int, void *, void *, const char *,
                          const char *, int, int *, int, int *, int, int,
                          void *, void *, ResInfo *, ResInfo *,
@@ -293,6 +382,13 @@ extern nglPlotId contour_map_wrap(int, void *, const char *, int, int,
                                   ResInfo *, ResInfo *, ResInfo *,
                                   nglRes *);
 
+extern nglPlotId contour_map_mesh_wrap(int, int, void *, const char *, 
+                                       ResInfo *, ResInfo *, ResInfo *,
+                                       nglRes *);
+
+extern nglPlotId contour_field_map_wrap(int, int, ResInfo *, ResInfo *,
+                                        nglRes *);
+
 extern nglPlotId vector_map_wrap(int, void *, void *, const char *, 
                                  const char *, int, int, int, void *, 
                                  const char *, int, void *, 
@@ -341,6 +437,20 @@ extern nglPlotId vector_scalar_map_wrap(int, void *, void *, void *,
                                         ResInfo *, ResInfo *,
                                         ResInfo *, ResInfo *, nglRes *);
 
+/*
+ * Routines for updating the data of an existing plot.
+ */
+
+extern void fix_plot_levels(int, char *, char *);
+
+extern void update_scalar_field_wrap(int, nglPlotId *, void *, const char *,
+                                     int, int, int, ResInfo *, ResInfo *,
+                                     nglRes *);
+
+extern void update_vector_field_wrap(int, nglPlotId *, void *, void *,
+                                     const char *, const char *, int, int,
+                                     int, ResInfo *, ResInfo *, nglRes *);
+
 /*
  * Text routines.
  */
@@ -193,6 +193,14 @@ static int dict_setitemstring(PyObject *d, const char *key, PyObject *val) {
 #include <stdio.h>
 #include <math.h>
 #include <stdarg.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <ncarg/hlu/hluP.h>
 #include <ncarg/hlu/ResListP.h>
 #include <ncarg/hlu/AppI.h>
@@ -271,10 +279,12 @@ extern NhlClass NhlPstreamlinePlotClass();
 extern const char *NGGetNCARGEnv(const char *name);
 
 extern void c_wmbarbp(int, float, float, float, float);
+extern void c_wmbarbs(int, double *, double *, double *, double *, int);
 extern void c_wmsetip(NhlString,int);
 extern void c_wmsetrp(NhlString,float);
 extern void c_wmsetcp(NhlString,NhlString);
 extern void c_wmstnmp(int, float, float, NhlString);
+extern void c_wmstnms(int, double *, double *, int, char *, double);
 extern int  c_wmgetip(NhlString);
 extern float c_wmgetrp(NhlString);
 extern NhlString c_wmgetcp(NhlString);
@@ -289,12 +299,38 @@ extern NhlString c_nngetcp(NhlString);
 extern void *pvoid();
 
 extern double c_dgcdist(double, double, double, double, int);
+extern void c_dcapethermo_cols(double *, int, double *, double *, int, int,
+                               double, double *, double *, double *,
+                               double *, double *);
+extern void c_dgcdist_n(double *, double *, double *, double *, int, int,
+                        double *);
+extern void c_dgcazim_n(double *, double *, double *, double *, int,
+                        double *);
+extern void c_dgcdest_n(double *, double *, double *, double *, int, int,
+                        double *, double *);
+extern void c_dgcdist_pairs(double *, double *, int, double *, double *,
+                            int, int, double *);
 extern double c_dshowalskewt(double *, double *, double *, int);
 extern double c_dpwskewt(double *, double *, int);
 extern double c_dsatlftskewt(double, double);
 extern double c_dtmrskewt(double, double);
 extern double c_dtdaskewt(double, double);
 extern void c_dptlclskewt(double, double, double, double *, double *);
+extern void c_dskewt_n(int, double *, double *, int, double *);
+extern int c_nnweights(int, double *, double *, int, int, double *,
+                       double *, int **, int **, double **);
+extern void c_nnapply(int, int *, int *, double *, int, int, double *,
+                      double, double *);
+extern void *c_cssfit(int, double *, double *, int *);
+extern void c_cssfree(void *);
+extern void c_cssgrads(void *, int, double *, double *);
+extern void c_csseval(void *, int, double *, double *, int, double *,
+                      double *, double *);
+extern int c_ftcurv_n(int, int, int, double *, double *, int, double *,
+                      int, double, double, double *, double *, double *);
+extern long c_asciicount(char *, size_t, char, int, int, long *);
+extern long c_asciiparse(char *, size_t, char, int, int, long *, long,
+                         void *);
 
 static PyObject* t_output_helper(PyObject* target, PyObject* o) {
     PyObject*   o2;
@@ -415,6 +451,9 @@ void set_nglRes_i(int pos, int ival) {
   else if (pos == 57) {
     nglRlist.nglMaskLambertConformalOutlineOn = ival;
   }
+  else if (pos == 58) {
+    nglRlist.nglPanelLayoutOnly = ival;
+  }
   else {
     printf("set_nglRes_i: invalid argument %d\n",pos);
   }
@@ -508,6 +547,9 @@ int get_nglRes_i(int pos) {
   else if (pos == 57) {
     return(nglRlist.nglMaskLambertConformalOutlineOn);
   }
+  else if (pos == 58) {
+    return(nglRlist.nglPanelLayoutOnly);
+  }
   else {
     printf("get_nglRes_i: invalid argument %d\n",pos);
   }
@@ -723,6 +765,122 @@ NhlString get_nglRes_s (int pos) {
   }
 }
 
+/*
+ *  The type of the special resource at each position used by the
+ *  set_nglRes_* functions: i(nt), f(loat), s(tring), or c for the
+ *  string array.
+ */
+static const char nglRes_types[] =
+  "iiiiiifffiiffiffffffffiiiiiifffffffiiiciiffiifsiiiffffiiiii";
+
+/*
+ *  The special resource defaults are built once and copied into
+ *  nglRlist at the start of each plotting call, rather than being
+ *  set one at a time.
+ */
+static nglRes nglRes_defaults;
+static int    nglRes_defaults_set = 0;
+
+/*
+ *  Copies of the string values handed to nglRlist by set_nglRes_p.
+ */
+static char      *nglRes_app_file    = NULL;
+static NhlString *nglRes_fig_strings = NULL;
+static int        nglRes_nfig_strings = 0;
+
+void set_nglRes_defaults(int list_type) {
+  if (!nglRes_defaults_set) {
+    initialize_resources(&nglRes_defaults,nglPlot);
+    nglRes_defaults.nglPointTickmarksOutward         = 0;
+    nglRes_defaults.nglMaskLambertConformal          = 0;
+    nglRes_defaults.nglMaskLambertConformalOutlineOn = 1;
+    nglRes_defaults_set = 1;
+  }
+  nglRlist = nglRes_defaults;
+  if (list_type == nglPrimitive) {
+    nglRlist.nglMaximize = 0;
+    nglRlist.nglFrame    = 0;
+  }
+}
+
+/*
+ *  Sets any number of special resources in one call. values is a
+ *  dictionary keyed by the same positions set_nglRes_i, set_nglRes_f,
+ *  set_nglRes_c and set_nglRes_s take.
+ */
+int set_nglRes_p(PyObject *values) {
+  Py_ssize_t pos = 0;
+  PyObject *key, *value, *seq;
+  int i, ipos, nitems;
+
+  if (!PyDict_Check(values)) {
+    printf("set_nglRes_p: special resources must be a dictionary\n");
+    return(0);
+  }
+  while (PyDict_Next(values, &pos, &key, &value)) {
+    ipos = (int) PyInt_AsLong(key);
+    if (ipos < 0 || ipos >= (int) sizeof(nglRes_types)-1) {
+      PyErr_Clear();
+      printf("set_nglRes_p: invalid argument %d\n",ipos);
+      continue;
+    }
+    switch(nglRes_types[ipos]) {
+    case 'i':
+      if (PyFloat_Check(value)) {
+        set_nglRes_i(ipos,(int) PyFloat_AsDouble(value));
+      }
+      else {
+        set_nglRes_i(ipos,(int) PyInt_AsLong(value));
+      }
+      break;
+    case 'f':
+      set_nglRes_f(ipos,(float) PyFloat_AsDouble(value));
+      break;
+    case 's':
+      if (!is_string_type(value)) {
+        printf("set_nglRes_p: position %d must be a string\n",ipos);
+        break;
+      }
+      free(nglRes_app_file);
+      nglRes_app_file = (char *) as_utf8_char(value);
+      set_nglRes_s(ipos,nglRes_app_file);
+      break;
+    case 'c':
+      seq = PySequence_Fast(value,"");
+      if (seq == NULL) {
+        PyErr_Clear();
+        printf("set_nglRes_p: position %d must be a list of strings\n",ipos);
+        break;
+      }
+      nitems = (int) PySequence_Fast_GET_SIZE(seq);
+      for (i = 0; i < nitems; i++) {
+        if (!is_string_type(PySequence_Fast_GET_ITEM(seq,i))) break;
+      }
+      if (i < nitems) {
+        Py_DECREF(seq);
+        printf("set_nglRes_p: position %d must be a list of strings\n",ipos);
+        break;
+      }
+      for (i = 0; i < nglRes_nfig_strings; i++) free(nglRes_fig_strings[i]);
+      free(nglRes_fig_strings);
+      nglRes_fig_strings = (NhlString *) calloc(nitems+1,sizeof(NhlString));
+      for (i = 0; i < nitems; i++) {
+        nglRes_fig_strings[i] = (NhlString)
+                    as_utf8_char(PySequence_Fast_GET_ITEM(seq,i));
+      }
+      nglRes_nfig_strings = nitems;
+      Py_DECREF(seq);
+      set_nglRes_c(ipos,nglRes_fig_strings);
+      break;
+    }
+  }
+  if (PyErr_Occurred()) {
+    PyErr_Clear();
+    printf("set_nglRes_p: some special resource values were invalid\n");
+  }
+  return(1);
+}
+
 void set_PCMP04(int arg_num, float value)
 {
   if (arg_num < 1 || arg_num > 3) {
@@ -794,6 +952,285 @@ PyObject *dcapethermo(double *penv, double *tenv, int nlvl, double lclmb,
   return resultobj;
 }
 
+PyObject *dcapethermo_cols_p(double *p, int p_is_1d, double *t, double *td,
+                             int nlvl, int ncol, double tmsg) {
+  PyObject *obj[5], *resultobj;
+  npy_intp dims[1];
+  int i;
+
+  dims[0] = (npy_intp)(ncol > 0 ? ncol : 0);
+  for(i = 0; i < 5; i++) {
+    obj[i] = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+    if (obj[i] == NULL) {
+      while(i-- > 0) Py_DECREF(obj[i]);
+      return NULL;
+    }
+  }
+/*
+ *  The GIL is kept, so that DCAPETHERMO is never running in two
+ *  threads at once.
+ */
+  c_dcapethermo_cols(p,p_is_1d,t,td,nlvl,(int)dims[0],tmsg,
+                     (double *)((PyArrayObject *)obj[0])->data,
+                     (double *)((PyArrayObject *)obj[1])->data,
+                     (double *)((PyArrayObject *)obj[2])->data,
+                     (double *)((PyArrayObject *)obj[3])->data,
+                     (double *)((PyArrayObject *)obj[4])->data);
+
+  resultobj = Py_None;
+  for(i = 0; i < 5; i++) {
+    resultobj = t_output_helper(resultobj,obj[i]);
+  }
+  return resultobj;
+}
+
+/*
+ *  The temperatures for n skew-T background points, from c_dskewt_n.
+ *  That is a plain loop calling the Fortran helper once per point, so
+ *  the results are the same as n calls of c_dtmrskewt, c_dtdaskewt or
+ *  c_dsatlftskewt.
+ */
+PyObject *skewt_thermo_p(int which, double *a, double *p, int n) {
+  PyObject *obj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  if (obj == NULL) return NULL;
+  c_dskewt_n(which,a,p,(int)dims[0],(double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+/*
+ *  Natural neighbor weights from c_nnweights, kept in a capsule by
+ *  nn_weights_p so that they can be applied to any number of fields
+ *  with nn_apply_p.
+ */
+#define NGL_NN_CAPSULE "ngl.NatgridWeights"
+
+typedef struct {
+  int    nin, nout;
+  int    *ptr, *idx;
+  double *wts;
+} nglNNWeights;
+
+static void free_nn_weights(PyObject *capsule) {
+  nglNNWeights *nn;
+
+  nn = (nglNNWeights *) PyCapsule_GetPointer(capsule,NGL_NN_CAPSULE);
+  if (nn != NULL) {
+    free(nn->ptr);
+    free(nn->idx);
+    free(nn->wts);
+    free(nn);
+  }
+}
+
+PyObject *nn_weights_p(int n, double *x, double *y, int nxo, int nyo,
+                       double *xo, double *yo) {
+  nglNNWeights *nn;
+  PyObject *obj, *resultobj;
+  int ier;
+
+  nn = (nglNNWeights *) malloc(sizeof(nglNNWeights));
+  if (nn == NULL) return PyErr_NoMemory();
+  nn->nin  = n;
+  nn->nout = nxo*nyo;
+  Py_BEGIN_ALLOW_THREADS
+  ier = c_nnweights(n,x,y,nxo,nyo,xo,yo,&nn->ptr,&nn->idx,&nn->wts);
+  Py_END_ALLOW_THREADS
+  if (ier != 0) {
+    free(nn);
+    Py_INCREF(Py_None);
+    obj = Py_None;
+  }
+  else {
+    obj = PyCapsule_New((void *) nn,NGL_NN_CAPSULE,free_nn_weights);
+  }
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) ier));
+  resultobj = t_output_helper(resultobj,obj);
+  return resultobj;
+}
+
+/*
+ *  z holds nfld fields of values at the points the weights were made
+ *  for. The array isn't kept, so it's converted here rather than by
+ *  the sequence typemaps.
+ */
+PyObject *nn_apply_p(PyObject *weights, PyObject *z, int nfld, double fill) {
+  nglNNWeights *nn;
+  PyArrayObject *arr;
+  PyObject *obj;
+  npy_intp dims[1];
+
+  nn = (nglNNWeights *) PyCapsule_GetPointer(weights,NGL_NN_CAPSULE);
+  if (nn == NULL) {
+    PyErr_Clear();
+    printf("nn_apply_p: invalid natural neighbor weights\n");
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  arr = (PyArrayObject *) PyArray_ContiguousFromAny(z,PyArray_DOUBLE,0,0);
+  if (arr == NULL || PyArray_SIZE(arr) != (npy_intp)nfld*nn->nin) {
+    PyErr_Clear();
+    Py_XDECREF(arr);
+    printf("nn_apply_p: the fields must have %d values each\n",nn->nin);
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  dims[0] = (npy_intp)nfld*nn->nout;
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  Py_BEGIN_ALLOW_THREADS
+  c_nnapply(nn->nout,nn->ptr,nn->idx,nn->wts,nn->nin,nfld,
+            (double *)arr->data,fill,(double *)((PyArrayObject *)obj)->data);
+  Py_END_ALLOW_THREADS
+  Py_DECREF(arr);
+  return(obj);
+}
+
+/*
+ *  A spherical surface from c_cssfit, kept in a capsule by css_fit_p.
+ *  css_grads_p estimates the gradients of fields at its points, and
+ *  css_eval_p evaluates the fields anywhere on the sphere.
+ */
+#define NGL_CSS_CAPSULE "ngl.SphereSurface"
+
+typedef struct {
+  int  n;
+  void *surf;
+} nglCSSurface;
+
+static void free_css_surface(PyObject *capsule) {
+  nglCSSurface *css;
+
+  css = (nglCSSurface *) PyCapsule_GetPointer(capsule,NGL_CSS_CAPSULE);
+  if (css != NULL) {
+    c_cssfree(css->surf);
+    free(css);
+  }
+}
+
+static nglCSSurface *css_from_capsule(PyObject *capsule, char *name) {
+  nglCSSurface *css;
+
+  css = (nglCSSurface *) PyCapsule_GetPointer(capsule,NGL_CSS_CAPSULE);
+  if (css == NULL) {
+    PyErr_Clear();
+    printf("%s: invalid spherical surface\n",name);
+  }
+  return(css);
+}
+
+PyObject *css_fit_p(int n, double *rlat, double *rlon) {
+  nglCSSurface *css;
+  PyObject *obj, *resultobj;
+  int ier;
+
+  css = (nglCSSurface *) malloc(sizeof(nglCSSurface));
+  css->n = n;
+  Py_BEGIN_ALLOW_THREADS
+  css->surf = c_cssfit(n,rlat,rlon,&ier);
+  Py_END_ALLOW_THREADS
+  if (ier != 0) {
+    c_cssfree(css->surf);
+    free(css);
+    Py_INCREF(Py_None);
+    obj = Py_None;
+  }
+  else {
+    obj = PyCapsule_New((void *) css,NGL_CSS_CAPSULE,free_css_surface);
+  }
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) ier));
+  resultobj = t_output_helper(resultobj,obj);
+  return resultobj;
+}
+
+/*
+ *  The gradients (nfld x n x 3) of the nfld fields of values f at
+ *  the points of the surface.
+ */
+PyObject *css_grads_p(PyObject *surf, PyObject *f, int nfld) {
+  nglCSSurface *css;
+  PyArrayObject *arr;
+  PyObject *obj;
+  npy_intp dims[1];
+
+  css = css_from_capsule(surf,"css_grads_p");
+  if (css == NULL) {
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  arr = (PyArrayObject *) PyArray_ContiguousFromAny(f,PyArray_DOUBLE,0,0);
+  if (arr == NULL || PyArray_SIZE(arr) != (npy_intp)nfld*css->n) {
+    PyErr_Clear();
+    Py_XDECREF(arr);
+    printf("css_grads_p: the fields must have %d values each\n",css->n);
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  dims[0] = (npy_intp)nfld*css->n*3;
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  Py_BEGIN_ALLOW_THREADS
+  c_cssgrads(css->surf,nfld,(double *)arr->data,
+             (double *)((PyArrayObject *)obj)->data);
+  Py_END_ALLOW_THREADS
+  Py_DECREF(arr);
+  return(obj);
+}
+
+/*
+ *  The nfld fields with values f and gradients g (from css_grads_p)
+ *  at the points (plat,plon), in degrees. None of the arrays are
+ *  kept, so they're converted here rather than by the sequence
+ *  typemaps.
+ */
+PyObject *css_eval_p(PyObject *surf, PyObject *f, PyObject *g, int nfld,
+                     PyObject *plat, PyObject *plon) {
+  nglCSSurface *css;
+  PyArrayObject *farr, *garr, *latarr, *lonarr;
+  PyObject *obj;
+  npy_intp dims[1];
+  int np;
+
+  css = css_from_capsule(surf,"css_eval_p");
+  if (css == NULL) {
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  farr   = (PyArrayObject *) PyArray_ContiguousFromAny(f,PyArray_DOUBLE,0,0);
+  garr   = (PyArrayObject *) PyArray_ContiguousFromAny(g,PyArray_DOUBLE,0,0);
+  latarr = (PyArrayObject *) PyArray_ContiguousFromAny(plat,PyArray_DOUBLE,0,0);
+  lonarr = (PyArrayObject *) PyArray_ContiguousFromAny(plon,PyArray_DOUBLE,0,0);
+  if (farr == NULL || garr == NULL || latarr == NULL || lonarr == NULL ||
+      PyArray_SIZE(farr) != (npy_intp)nfld*css->n ||
+      PyArray_SIZE(garr) != (npy_intp)nfld*css->n*3 ||
+      PyArray_SIZE(latarr) != PyArray_SIZE(lonarr)) {
+    PyErr_Clear();
+    Py_XDECREF(farr);
+    Py_XDECREF(garr);
+    Py_XDECREF(latarr);
+    Py_XDECREF(lonarr);
+    printf("css_eval_p: the values, gradients or output points are the wrong size\n");
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  np = (int) PyArray_SIZE(latarr);
+  dims[0] = (npy_intp)nfld*np;
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  Py_BEGIN_ALLOW_THREADS
+  c_csseval(css->surf,nfld,(double *)farr->data,(double *)garr->data,np,
+            (double *)latarr->data,(double *)lonarr->data,
+            (double *)((PyArrayObject *)obj)->data);
+  Py_END_ALLOW_THREADS
+  Py_DECREF(farr);
+  Py_DECREF(garr);
+  Py_DECREF(latarr);
+  Py_DECREF(lonarr);
+  return(obj);
+}
+
 PyObject *ftcurvc(int n, float *x, float *y, int m, float *xo)
 {
   float *yo;
@@ -853,6 +1290,72 @@ PyObject *ftcurvpic(float xl, float xr, float p, int m, float *xi, float *yi)
   return resultobj;
 }
 
+/*
+ *  Splines through nrow curves of n points at once (c_ftcurv_n). x
+ *  holds n abscissae shared by all the curves, or n for each. Returns
+ *  the error code and the values at xo, followed by the derivatives
+ *  (for curves that aren't periodic) and the integrals from xo[0] if
+ *  full is set (None otherwise). fitgrid isn't reentrant, so the
+ *  interpreter lock is kept.
+ */
+PyObject *ftcurv_n_p(int nrow, int n, PyObject *x, PyObject *y,
+                     PyObject *xo, int periodic, double p, double sigma,
+                     int full) {
+  PyArrayObject *xarr, *yarr, *xoarr;
+  PyObject *yo, *dyo, *iyo, *resultobj;
+  npy_intp dims[1];
+  int ier, m, xinc;
+
+  xarr  = (PyArrayObject *) PyArray_ContiguousFromAny(x,PyArray_DOUBLE,0,0);
+  yarr  = (PyArrayObject *) PyArray_ContiguousFromAny(y,PyArray_DOUBLE,0,0);
+  xoarr = (PyArrayObject *) PyArray_ContiguousFromAny(xo,PyArray_DOUBLE,0,0);
+  if (xarr == NULL || yarr == NULL || xoarr == NULL ||
+      PyArray_SIZE(yarr) != (npy_intp)nrow*n ||
+      (PyArray_SIZE(xarr) != n && PyArray_SIZE(xarr) != (npy_intp)nrow*n)) {
+    PyErr_Clear();
+    Py_XDECREF(xarr);
+    Py_XDECREF(yarr);
+    Py_XDECREF(xoarr);
+    printf("ftcurv_n_p: the abscissae and values are the wrong size\n");
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  xinc = PyArray_SIZE(xarr) == n ? 0 : n;
+  m = (int) PyArray_SIZE(xoarr);
+  dims[0] = (npy_intp)nrow*m;
+  yo = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  if (full && !periodic) {
+    dyo = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  }
+  else {
+    Py_INCREF(Py_None);
+    dyo = Py_None;
+  }
+  if (full) {
+    iyo = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  }
+  else {
+    Py_INCREF(Py_None);
+    iyo = Py_None;
+  }
+  ier = c_ftcurv_n(nrow,n,xinc,(double *)xarr->data,(double *)yarr->data,
+                   m,(double *)xoarr->data,periodic,p,sigma,
+                   (double *)((PyArrayObject *)yo)->data,
+                   dyo != Py_None ? (double *)((PyArrayObject *)dyo)->data
+                                  : NULL,
+                   iyo != Py_None ? (double *)((PyArrayObject *)iyo)->data
+                                  : NULL);
+  Py_DECREF(xarr);
+  Py_DECREF(yarr);
+  Py_DECREF(xoarr);
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) ier));
+  resultobj = t_output_helper(resultobj,yo);
+  resultobj = t_output_helper(resultobj,dyo);
+  resultobj = t_output_helper(resultobj,iyo);
+  return resultobj;
+}
+
 
 void natgridc(int n, float *x, float *y, float *z, int nxi, int nyi,
              float *xi, float *yi, int *ier, int nxir, int nyir, float *aout[])
@@ -982,15 +1485,13 @@ NhlErrorTypes NhlQNDCToData(int pid, float *x, float *y, int n,
     mxt = NULL;
   }
   else {
-    mxt = malloc(sizeof(float));
-    *mxt = xmissing;
+    mxt = &xmissing;
   }
   if (iymissing != 1) {
     myt = NULL;
   }
   else {
-    myt = malloc(sizeof(float));
-    *myt = ymissing;
+    myt = &ymissing;
   }
   return(NhlNDCToData(pid, x, y, n, xout, yout, mxt, myt,
                       status, out_of_range));
@@ -1005,17 +1506,15 @@ PyObject *NhlPNDCToData(int pid, float *x, float *y, int n, float xmissing,
   npy_intp dims[1];
   float out_of_range;
 
-  xout = (float *) malloc(n*sizeof(float));
-  yout = (float *) malloc(n*sizeof(float));
+  dims[0] = (npy_intp)n;
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  xout = (float *) ((PyArrayObject *)obj1)->data;
+  yout = (float *) ((PyArrayObject *)obj2)->data;
   rval = (int) NhlQNDCToData(pid, x, y, n, xout, yout, xmissing,
                              ymissing, ixmissing, iymissing,
                              &status, &out_of_range);
   nhlerr = (PyObject *) PyInt_FromLong((long) rval); 
-  dims[0] = (npy_intp)n;
-  obj1 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) xout);
-  obj2 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) yout);
   rstatus = (PyObject *) PyInt_FromLong((long) status); 
   range = (PyObject *) PyFloat_FromDouble((double) out_of_range); 
 
@@ -1039,15 +1538,13 @@ NhlErrorTypes NhlQDataToNDC(int pid, float *x, float *y, int n,
     mxt = NULL;
   }
   else {
-    mxt = malloc(sizeof(float));
-    *mxt = xmissing;
+    mxt = &xmissing;
   }
   if (iymissing != 1) {
     myt = NULL;
   }
   else {
-    myt = malloc(sizeof(float));
-    *myt = ymissing;
+    myt = &ymissing;
   }
   return(NhlDataToNDC(pid, x, y, n, xout, yout, mxt, myt,
                       status, out_of_range));
@@ -1062,17 +1559,15 @@ PyObject *NhlPDataToNDC(int pid, float *x, float *y, int n, float xmissing,
   npy_intp dims[1];
   float out_of_range;
 
-  xout = (float *) malloc(n*sizeof(float));
-  yout = (float *) malloc(n*sizeof(float));
+  dims[0] = (npy_intp)n;
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  xout = (float *) ((PyArrayObject *)obj1)->data;
+  yout = (float *) ((PyArrayObject *)obj2)->data;
   rval = (int) NhlQDataToNDC(pid, x, y, n, xout, yout, xmissing,
                              ymissing, ixmissing, iymissing,
                              &status, &out_of_range);
   nhlerr = (PyObject *) PyInt_FromLong((long) rval); 
-  dims[0] = (npy_intp)n;
-  obj1 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) xout);
-  obj2 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) yout);
   rstatus = (PyObject *) PyInt_FromLong((long) status); 
   range = (PyObject *) PyFloat_FromDouble((double) out_of_range); 
 
@@ -1086,6 +1581,220 @@ PyObject *NhlPDataToNDC(int pid, float *x, float *y, int n, float xmissing,
   return resultobj;
 }
 
+/*
+ *  Converts the points (x,y) between data and NDC space for plot pid
+ *  (data to NDC, or NDC to data if todata is set), into the arrays
+ *  xout and yout given by the caller. These must be contiguous
+ *  float32 or float64 arrays with as many elements as x and y, of any
+ *  shape. The HLU transformations are done in float, through small
+ *  buffers, unless everything is float32 already. Returns the HLU
+ *  error, the status (1 if any points were out of range) and the
+ *  out of range value.
+ */
+#define NGL_TRANS_CHUNK 512
+
+static int trans_out_ok(PyObject *obj, npy_intp n) {
+  PyArrayObject *arr = (PyArrayObject *) obj;
+
+  return(PyArray_Check(obj) && PyArray_ISCARRAY(arr) &&
+         PyArray_SIZE(arr) == n &&
+         (arr->descr->type_num == PyArray_FLOAT ||
+          arr->descr->type_num == PyArray_DOUBLE));
+}
+
+static int trans_is_float(PyObject *obj) {
+  return(PyArray_Check(obj) && PyArray_ISCARRAY((PyArrayObject *) obj) &&
+         ((PyArrayObject *) obj)->descr->type_num == PyArray_FLOAT);
+}
+
+PyObject *ndc_transform_p(int pid, int todata, PyObject *x, PyObject *y,
+                          PyObject *xout, PyObject *yout, double xmissing,
+                          double ymissing, int ixmissing, int iymissing)
+{
+  PyArrayObject *xarr, *yarr, *xoarr, *yoarr;
+  PyObject *resultobj;
+  NhlErrorTypes rval, err = NhlNOERROR;
+  float xb[NGL_TRANS_CHUNK], yb[NGL_TRANS_CHUNK];
+  float xo[NGL_TRANS_CHUNK], yo[NGL_TRANS_CHUNK];
+  float mx = (float) xmissing, my = (float) ymissing, oor = 0.;
+  float *mxt, *myt;
+  double *xd, *yd;
+  npy_intp n, i, k, off;
+  int status, anystatus = 0;
+
+  mxt = ixmissing == 1 ? &mx : NULL;
+  myt = iymissing == 1 ? &my : NULL;
+  xoarr = (PyArrayObject *) xout;
+  yoarr = (PyArrayObject *) yout;
+  if (trans_is_float(x) && trans_is_float(y) &&
+      trans_is_float(xout) && trans_is_float(yout) &&
+      PyArray_SIZE((PyArrayObject *) x) == PyArray_SIZE(xoarr) &&
+      PyArray_SIZE((PyArrayObject *) y) == PyArray_SIZE(yoarr) &&
+      PyArray_SIZE(xoarr) == PyArray_SIZE(yoarr)) {
+    n = PyArray_SIZE(xoarr);
+    if (todata) {
+      err = NhlNDCToData(pid,(float *)((PyArrayObject *)x)->data,
+                         (float *)((PyArrayObject *)y)->data,(int) n,
+                         (float *)xoarr->data,(float *)yoarr->data,
+                         mxt,myt,&anystatus,&oor);
+    }
+    else {
+      err = NhlDataToNDC(pid,(float *)((PyArrayObject *)x)->data,
+                         (float *)((PyArrayObject *)y)->data,(int) n,
+                         (float *)xoarr->data,(float *)yoarr->data,
+                         mxt,myt,&anystatus,&oor);
+    }
+  }
+  else {
+    xarr = (PyArrayObject *) PyArray_ContiguousFromAny(x,PyArray_DOUBLE,0,0);
+    yarr = (PyArrayObject *) PyArray_ContiguousFromAny(y,PyArray_DOUBLE,0,0);
+    if (xarr == NULL || yarr == NULL ||
+        PyArray_SIZE(xarr) != PyArray_SIZE(yarr) ||
+        !trans_out_ok(xout,PyArray_SIZE(xarr)) ||
+        !trans_out_ok(yout,PyArray_SIZE(xarr))) {
+      PyErr_Clear();
+      Py_XDECREF(xarr);
+      Py_XDECREF(yarr);
+      printf("ndc_transform_p: the output arrays must be contiguous float32 or float64\n  arrays with as many elements as the input\n");
+      Py_INCREF(Py_None);
+      return(Py_None);
+    }
+    n  = PyArray_SIZE(xarr);
+    xd = (double *) xarr->data;
+    yd = (double *) yarr->data;
+    for (off = 0; off < n; off += NGL_TRANS_CHUNK) {
+      k = min(n - off,NGL_TRANS_CHUNK);
+      for (i = 0; i < k; i++) {
+        xb[i] = (float) xd[off+i];
+        yb[i] = (float) yd[off+i];
+      }
+      if (todata) {
+        rval = NhlNDCToData(pid,xb,yb,(int) k,xo,yo,mxt,myt,&status,&oor);
+      }
+      else {
+        rval = NhlDataToNDC(pid,xb,yb,(int) k,xo,yo,mxt,myt,&status,&oor);
+      }
+      if (rval < err) err = rval;
+      if (status) anystatus = 1;
+      if (xoarr->descr->type_num == PyArray_FLOAT) {
+        memcpy(&((float *)xoarr->data)[off],xo,k*sizeof(float));
+      }
+      else {
+        for (i = 0; i < k; i++) ((double *)xoarr->data)[off+i] = xo[i];
+      }
+      if (yoarr->descr->type_num == PyArray_FLOAT) {
+        memcpy(&((float *)yoarr->data)[off],yo,k*sizeof(float));
+      }
+      else {
+        for (i = 0; i < k; i++) ((double *)yoarr->data)[off+i] = yo[i];
+      }
+    }
+    Py_DECREF(xarr);
+    Py_DECREF(yarr);
+  }
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) err));
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) anystatus));
+  resultobj = t_output_helper(resultobj,PyFloat_FromDouble((double) oor));
+  return resultobj;
+}
+
+/*
+ *  Reads the numbers (of type 0 = int, 1 = float, 2 = double) in an
+ *  ASCII file, separated by white space or the character sep, into a
+ *  new array, for asciiread. size is the number of values wanted, or
+ *  -1 for all of them. The file is mapped into memory rather than
+ *  read, and with nthreads other than 1 (0 for the OpenMP default)
+ *  it's split into chunks that are read in parallel. Returns 0, the
+ *  array, and the number of values found; if the file can't be
+ *  opened, IOError is raised, as open() would.
+ */
+PyObject *asciiread_p(char *filename, char *sep, int type, PyObject *size,
+                      int nthreads)
+{
+  PyObject *arr = NULL, *resultobj;
+  struct stat st;
+  char *buf = NULL;
+  size_t len = 0, got;
+  ssize_t nr;
+  long nmax, total = 0, nread, *counts = NULL;
+  int fd, err, nchunk = 1, mapped = 0;
+  npy_intp dims[1];
+
+  nmax = PyInt_AsLong(size);
+  fd = open(filename,O_RDONLY);
+  if (fd < 0 || fstat(fd,&st) != 0) {
+    err = errno;
+    if (fd >= 0) close(fd);
+    errno = err;
+    return PyErr_SetFromErrnoWithFilename(PyExc_IOError,filename);
+  }
+  len = (size_t) st.st_size;
+  if (len > 0) {
+    buf = (char *) mmap(NULL,len,PROT_READ,MAP_PRIVATE,fd,0);
+    if (buf == (char *) MAP_FAILED) {
+/*
+ *  Files that can't be mapped (pipes, some network file systems) are
+ *  read into memory instead.
+ */
+      buf = (char *) malloc(len);
+      if (buf == NULL) {
+        close(fd);
+        return PyErr_NoMemory();
+      }
+      for (got = 0; got < len; got += (size_t) nr) {
+        nr = read(fd,buf+got,len-got);
+        if (nr <= 0) break;
+      }
+      len = got;
+    }
+    else {
+      mapped = 1;
+    }
+  }
+  close(fd);
+
+#ifdef _OPENMP
+  nchunk = nthreads > 0 ? nthreads : omp_get_max_threads();
+#endif
+  if ((size_t) nchunk > len/(1 << 20) + 1) nchunk = (int) (len/(1 << 20)) + 1;
+  if (mapped && nchunk == 1) madvise(buf,len,MADV_SEQUENTIAL);
+
+  if (nmax < 0 || nchunk > 1) {
+    counts = (long *) malloc(nchunk*sizeof(long));
+    if (counts == NULL) {
+      PyErr_NoMemory();
+      goto done;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    total = c_asciicount(buf,len,sep[0],type,nchunk,counts);
+    Py_END_ALLOW_THREADS
+  }
+  dims[0] = (npy_intp) (nmax < 0 ? total : nmax);
+  arr = (PyObject *) PyArray_ZEROS(1,dims,type == 0 ? PyArray_INT :
+                     (type == 1 ? PyArray_FLOAT : PyArray_DOUBLE),0);
+  if (arr == NULL) goto done;
+  Py_BEGIN_ALLOW_THREADS
+  nread = c_asciiparse(buf,len,sep[0],type,nchunk,counts,(long) dims[0],
+                       ((PyArrayObject *)arr)->data);
+  Py_END_ALLOW_THREADS
+
+done:
+  free(counts);
+  if (mapped) {
+    munmap(buf,len);
+  }
+  else {
+    free(buf);
+  }
+  if (arr == NULL) return NULL;
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong(0L));
+  resultobj = t_output_helper(resultobj,arr);
+  resultobj = t_output_helper(resultobj,PyInt_FromLong(nread));
+  return resultobj;
+}
+
 PyObject *NhlGetMDFloatArray(int pid, char *name) {
   PyObject *obj1, *nhlerr, *resultobj;
   int i, num_dims, grlist;
@@ -1173,6 +1882,545 @@ PyObject *NhlGetMDIntegerArray(int pid, char *name) {
   return resultobj;
 }
 
+PyObject *panel_layout_p() {
+  PyObject *resultobj;
+  float *layout;
+  double *dptr;
+  int i, nrows;
+  npy_intp dims[2];
+
+  nrows   = get_panel_layout(&layout);
+  dims[0] = (npy_intp)nrows;
+  dims[1] = 4;
+  resultobj = (PyObject *) PyArray_SimpleNew(2,dims,PyArray_DOUBLE);
+  dptr = (double *)((PyArrayObject *)resultobj)->data;
+  for(i = 0; i < 4*nrows; i++) dptr[i] = (double)layout[i];
+  return resultobj;
+}
+
+PyObject *region_cull_p(double *lat, double *lon, int ncells, int nvert,
+                        double minlat, double maxlat, double minlon,
+                        double maxlon, double halo) {
+  PyObject *resultobj;
+  int *indices, nkeep;
+  npy_intp dims[1];
+
+  indices = (int *)malloc((ncells > 0 ? ncells : 1)*sizeof(int));
+  nkeep   = region_cull(lat,lon,ncells,nvert,minlat,maxlat,minlon,maxlon,
+                        halo,indices);
+  dims[0] = (npy_intp)nkeep;
+  resultobj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_INT);
+  memcpy(((PyArrayObject *)resultobj)->data,indices,nkeep*sizeof(int));
+  free(indices);
+  return resultobj;
+}
+
+PyObject *decimate_xy_p(double *x, double *y, int n, double xmin, 
+                        double xmax, int ncols, int xlog, int is_missing_x,
+                        double xmsg, int is_missing_y, double ymsg) {
+  PyObject *obj1, *obj2, *resultobj;
+  double *xout, *yout;
+  int nout;
+  npy_intp dims[1];
+
+  xout = (double *)malloc((n > 0 ? n : 1)*sizeof(double));
+  yout = (double *)malloc((n > 0 ? n : 1)*sizeof(double));
+  nout = decimate_xy(x,y,n,xmin,xmax,ncols,xlog,is_missing_x,xmsg,
+                     is_missing_y,ymsg,xout,yout);
+
+  dims[0] = (npy_intp)nout;
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  memcpy(((PyArrayObject *)obj1)->data,xout,nout*sizeof(double));
+  memcpy(((PyArrayObject *)obj2)->data,yout,nout*sizeof(double));
+  free(xout);
+  free(yout);
+
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,obj1);
+  resultobj = t_output_helper(resultobj,obj2);
+  return resultobj;
+}
+
+PyObject *histogram2d_p(double *x, double *y, int n, int nx, int ny, 
+                        double xmin, double xmax, double ymin, double ymax,
+                        int is_missing_x, double xmsg, int is_missing_y, 
+                        double ymsg) {
+  PyObject *obj;
+  npy_intp dims[2];
+
+  dims[0] = (npy_intp)(ny > 0 ? ny : 0);
+  dims[1] = (npy_intp)(nx > 0 ? nx : 0);
+  obj = (PyObject *) PyArray_SimpleNew(2,dims,PyArray_DOUBLE);
+  histogram2d(x,y,n,(int)dims[1],(int)dims[0],xmin,xmax,ymin,ymax,
+              is_missing_x,xmsg,is_missing_y,ymsg,
+              (double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+PyObject *gc_dist_p(double *lat1, double *lon1, double *lat2, double *lon2,
+                    int n, int iu) {
+  PyObject *obj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  c_dgcdist_n(lat1,lon1,lat2,lon2,n,iu,
+              (double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+PyObject *gc_azim_p(double *lat1, double *lon1, double *lat2, double *lon2,
+                    int n) {
+  PyObject *obj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  c_dgcazim_n(lat1,lon1,lat2,lon2,n,(double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+PyObject *gc_dest_p(double *lat, double *lon, double *dist, double *azim,
+                    int n, int iu) {
+  PyObject *obj1, *obj2, *resultobj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  c_dgcdest_n(lat,lon,dist,azim,n,iu,(double *)((PyArrayObject *)obj1)->data,
+              (double *)((PyArrayObject *)obj2)->data);
+
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,obj1);
+  resultobj = t_output_helper(resultobj,obj2);
+  return resultobj;
+}
+
+PyObject *gc_dist_pairs_p(double *lat1, double *lon1, int n, double *lat2,
+                          double *lon2, int m, int iu) {
+  PyObject *obj;
+  npy_intp dims[2];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  dims[1] = (npy_intp)(m > 0 ? m : 0);
+  obj = (PyObject *) PyArray_SimpleNew(2,dims,PyArray_DOUBLE);
+  c_dgcdist_pairs(lat1,lon1,(int)dims[0],lat2,lon2,(int)dims[1],iu,
+                  (double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+/*
+ *  Draws station models from the concatenated 50-character station
+ *  strings in imdat. c_wmstnms changes the strings, so it is given
+ *  a copy, which is returned with the wind directions as drawn.
+ */
+PyObject *wmstnms_p(int wksid, double *x, double *y, int n, PyObject *imdat,
+                    double thin) {
+  PyObject *obj;
+  char *buf;
+
+  if (n <= 0 || !PyBytes_Check(imdat) ||
+      PyBytes_Size(imdat) < 50*(Py_ssize_t)n) {
+    printf("wmstnms_p: station data must be %d 50-character strings\n",n);
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+  buf = (char *) malloc(50*n);
+  memcpy(buf,PyBytes_AsString(imdat),50*n);
+  c_wmstnms(wksid,x,y,n,buf,thin);
+  obj = PyBytes_FromStringAndSize(buf,50*(Py_ssize_t)n);
+  free(buf);
+  return obj;
+}
+
+PyObject *png_to_rgba_p(PyObject *png) {
+  PyArrayObject *arr;
+  PyObject *obj;
+  unsigned char *rgba;
+  int width, height;
+  npy_intp dims[3];
+
+  arr = (PyArrayObject *) PyArray_ContiguousFromAny(png,PyArray_UBYTE,1,1);
+  if (arr == NULL) return NULL;
+  rgba = png_to_rgba((unsigned char *)arr->data,(int)arr->dimensions[0],
+                     &width,&height);
+  Py_DECREF(arr);
+  if (rgba == NULL) {
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
+  dims[0] = (npy_intp)height;
+  dims[1] = (npy_intp)width;
+  dims[2] = 4;
+  obj = (PyObject *) PyArray_SimpleNew(3,dims,PyArray_UBYTE);
+  memcpy(((PyArrayObject *)obj)->data,rgba,(long)width*height*4);
+  free(rgba);
+  return obj;
+}
+
+/*
+ *  Returns the timing statistics kept by the gsun code as a dictionary
+ *  of stage name: (count, seconds, bytes), and the trace events as a
+ *  list of (stage name, start, duration) tuples, in seconds.
+ */
+PyObject *get_stats_p() {
+  PyObject *dict, *item;
+  const char *name;
+  long count;
+  double seconds, bytes;
+  int i;
+
+  dict = PyDict_New();
+  for (i = 0; i < get_nstats(); i++) {
+    name = get_stat(i,&count,&seconds,&bytes);
+    item = Py_BuildValue("(ldd)",count,seconds,bytes);
+    PyDict_SetItemString(dict,name,item);
+    Py_DECREF(item);
+  }
+  return dict;
+}
+
+PyObject *get_trace_p() {
+  PyObject *list;
+  const char *name;
+  double start, duration;
+  int i, n;
+
+  n = get_ntrace_events();
+  list = PyList_New(n);
+  for (i = 0; i < n; i++) {
+    name = get_trace_event(i,&start,&duration);
+    PyList_SET_ITEM(list,i,Py_BuildValue("(sdd)",name,start,duration));
+  }
+  return list;
+}
+
+/*
+ *  Memory that a resource list refers to. The NhlRLSet* functions
+ *  don't copy the values they are given, so the arrays and strings
+ *  created while converting a dictionary have to be kept until the
+ *  resource list has been used, and are freed after that.
+ */
+typedef struct _nglRLTemps {
+  int       nptrs, maxptrs;
+  void      **ptrs;
+  int       nobjs, maxobjs;
+  PyObject  **objs;
+} nglRLTemps;
+
+static void *rl_keep(nglRLTemps *temps, void *ptr) {
+  if (temps->nptrs == temps->maxptrs) {
+    temps->maxptrs = temps->maxptrs ? 2*temps->maxptrs : 16;
+    temps->ptrs = (void **) realloc(temps->ptrs,
+                                    temps->maxptrs*sizeof(void *));
+  }
+  temps->ptrs[temps->nptrs++] = ptr;
+  return(ptr);
+}
+
+static PyObject *rl_keep_obj(nglRLTemps *temps, PyObject *obj) {
+  if (temps->nobjs == temps->maxobjs) {
+    temps->maxobjs = temps->maxobjs ? 2*temps->maxobjs : 8;
+    temps->objs = (PyObject **) realloc(temps->objs,
+                                        temps->maxobjs*sizeof(PyObject *));
+  }
+  temps->objs[temps->nobjs++] = obj;
+  return(obj);
+}
+
+/*
+ *  Destroys a resource list created by dict_to_rlist and frees
+ *  everything it refers to. Lists that weren't created here (their
+ *  temps field is NULL) are left alone.
+ */
+static void free_resinfo(ResInfo *info) {
+  int i;
+  nglRLTemps *temps;
+
+  if (info == NULL || info->temps == NULL) return;
+  temps = (nglRLTemps *) info->temps;
+
+  NhlRLDestroy(info->id);
+  for (i = 0; i < temps->nptrs; i++) free(temps->ptrs[i]);
+  for (i = 0; i < temps->nobjs; i++) Py_XDECREF(temps->objs[i]);
+  free(temps->ptrs);
+  free(temps->objs);
+  free(temps);
+  if (info->strings != NULL) {
+    for (i = 0; i < info->nstrings; i++) free(info->strings[i]);
+    free(info->strings);
+  }
+  info->temps   = NULL;
+  info->strings = NULL;
+}
+
+/*
+ *  Sets the items of a tuple or list value in the resource list.
+ *  The items must be all strings, or all ints and floats; a float
+ *  anywhere makes it an array of doubles.
+ */
+static int rl_set_sequence(int rlist, char *name, PyObject *value,
+                           nglRLTemps *temps) {
+  int i, list_type, is_tuple;
+  ng_size_t list_len;
+  PyObject *item;
+  char **strings;
+  double *dvals;
+  int *ivals;
+
+  is_tuple = PyTuple_Check(value);
+  list_len = is_tuple ? (ng_size_t)PyTuple_Size(value) :
+                        (ng_size_t)PyList_Size(value);
+  item = is_tuple ? PyTuple_GetItem(value,0) : PyList_GetItem(value,0);
+  if (item == NULL) {
+    PyErr_Clear();
+    printf("The %s value for resource %s is empty.\n",
+           is_tuple ? "tuple" : "list", name);
+    return(0);
+  }
+  if (PyList_Check(item) || PyTuple_Check(item)) {
+    if (is_tuple) {
+      printf("Tuple values are not allowed to have list or tuple items.\n");
+    }
+    else {
+      printf("Use NumPy arrays for multiple dimension arrays.\n");
+    }
+    return(0);
+  }
+/*
+ *    list_type = 2 (int)
+ *              = 0 (string)
+ *              = 1 (float)
+ */
+  list_type = is_string_type(item) ? 0 : 2;
+  for (i = 0; i < list_len ; i++) {
+    item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+    if (list_type == 0) {
+      if (!is_string_type(item)) {
+        printf("All items in the %s value for resource %s must be strings\n",
+               is_tuple ? "tuple" : "list", name);
+        return(0);
+      }
+    }
+    else if (PyFloat_Check(item)) {
+      list_type = 1;
+    }
+    else if (!PyInt_Check(item)) {
+      printf("All items in the %s value for resource %s must be ints or floats.\n",
+             is_tuple ? "tuple" : "list", name);
+      return(0);
+    }
+  }
+
+  switch (list_type) {
+    case 0:
+      strings = (char **) rl_keep(temps,malloc(list_len*sizeof(char *)));
+      for (i = 0; i < list_len ; i++) {
+        item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+        strings[i] = (char *) rl_keep(temps,(void *) as_utf8_char(item));
+      }
+      NhlRLSetStringArray(rlist,name,strings,list_len);
+      break;
+    case 1:
+      dvals = (double *) rl_keep(temps,malloc(list_len*sizeof(double)));
+      for (i = 0; i < list_len ; i++) {
+        item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+        dvals[i] = PyFloat_AsDouble(item);
+      }
+      NhlRLSetDoubleArray(rlist,name,dvals,list_len);
+      break;
+    case 2:
+      ivals = (int *) rl_keep(temps,malloc(list_len*sizeof(int)));
+      for (i = 0; i < list_len ; i++) {
+        item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+        ivals[i] = (int) PyInt_AsLong(item);
+      }
+      NhlRLSetIntegerArray(rlist,name,ivals,list_len);
+      break;
+  }
+  return(1);
+}
+
+/*
+ *  Converts a dictionary of resources to a new HLU resource list,
+ *  filling in info. If copy is set, array values are copied rather
+ *  than referenced, so that the list doesn't change if the arrays
+ *  do. Returns 0 (after printing a message) if a value can't be
+ *  converted, or with a TypeError set if dict isn't a dictionary.
+ *  Use free_resinfo to release the list.
+ */
+static int dict_to_rlist(PyObject *dict, ResInfo *info, int copy) {
+  int i, count, array_type, ndims, rlist;
+  Py_ssize_t pos = 0;
+  PyObject *key, *value;
+  PyArrayObject *arr, *tarr;
+  ng_size_t *len_dims;
+  nglRLTemps *temps;
+  char *name, *svalue;
+  double t0, nbytes = 0.;
+
+  t0 = stats_begin();
+  rlist = NhlRLCreate(NhlSETRL);
+  NhlRLClear(rlist);
+  temps = (nglRLTemps *) calloc(1,sizeof(nglRLTemps));
+
+  info->id       = rlist;
+  info->nstrings = 0;
+  info->strings  = NULL;
+  info->temps    = (void *) temps;
+
+  if (!PyDict_Check(dict)) {
+    PyErr_SetString(PyExc_TypeError,"Resource lists must be dictionaries");
+    free_resinfo(info);
+    stats_end("rlist",t0,nbytes);
+    return(0);
+  }
+
+  info->nstrings = PyDict_Size(dict);
+  info->strings  = (char **) calloc(info->nstrings ? info->nstrings : 1,
+                                    sizeof(char *));
+  count = 0;
+/*
+ *  Loop over the keyword/value pairs in the dictionary.
+ *  The values must be one of: tuple, int, float, long,
+ *  list, string, or array.
+ */
+  while (PyDict_Next(dict, &pos, &key, &value)) {
+    name = (char *) as_utf8_char(key);
+    info->strings[count++] = name;
+
+    if (PyTuple_Check(value) || PyList_Check(value)) {
+      if (!rl_set_sequence(rlist,name,value,temps)) {
+        free_resinfo(info);
+        stats_end("rlist",t0,nbytes);
+        return(0);
+      }
+    }
+/*
+ *  Python and NumPy scalars.
+ */
+    else if (PyArray_IsAnyScalar(value)) {
+      if (PyInt_Check(value) || PyLong_Check(value) ||
+          PyArray_IsScalar(value,Int) || PyArray_IsScalar(value,Long)) {
+        NhlRLSetInteger(rlist,name,(int) PyInt_AsLong(value));
+      }
+      else if (PyFloat_Check(value) || PyArray_IsScalar(value,Float)) {
+        NhlRLSetDouble(rlist,name,PyFloat_AsDouble(value));
+      }
+      else if (is_string_type(value) || PyArray_IsScalar(value,String)) {
+        svalue = (char *) rl_keep(temps,(void *) as_utf8_char(value));
+        NhlRLSetString(rlist,name,svalue);
+      }
+    }
+/*
+ *  value is an array.
+ */
+    else if (PyArray_Check(value)) {
+      array_type = (int) ((PyArrayObject *)value)->descr->type_num;
+      if (array_type == PyArray_LONG || array_type == PyArray_INT) {
+        array_type = PyArray_LONG;
+      }
+      else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
+        array_type = PyArray_DOUBLE;
+      }
+      else {
+        printf(
+          "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
+        free_resinfo(info);
+        stats_end("rlist",t0,nbytes);
+        return(0);
+      }
+      arr = (PyArrayObject *) PyArray_ContiguousFromAny(value,array_type,0,0);
+      if (copy && arr != NULL) {
+        tarr = (PyArrayObject *) PyArray_Copy(arr);
+        Py_DECREF(arr);
+        arr = tarr;
+      }
+      if (arr == NULL) {
+        PyErr_Clear();
+        printf("  value for keyword %s could not be converted.\n",name);
+        free_resinfo(info);
+        stats_end("rlist",t0,nbytes);
+        return(0);
+      }
+      rl_keep_obj(temps,(PyObject *) arr);
+      nbytes += (double) PyArray_NBYTES(arr);
+      ndims = arr->nd;
+      len_dims = (ng_size_t *) rl_keep(temps,
+                              malloc((ndims ? ndims : 1)*sizeof(ng_size_t)));
+      for(i = 0; i < ndims; i++ ) {
+        len_dims[i] = (ng_size_t)arr->dimensions[i];
+      }
+      if (array_type == PyArray_LONG) {
+        NhlRLSetMDLongArray(rlist,name,(long *)arr->data,ndims,len_dims);
+      }
+      else {
+        NhlRLSetMDDoubleArray(rlist,name,(double *)arr->data,ndims,len_dims);
+      }
+    }
+    else {
+      printf("  value for keyword %s is invalid.\n",name);
+      free_resinfo(info);
+      stats_end("rlist",t0,nbytes);
+      return(0);
+    }
+  }
+  stats_end("rlist",t0,nbytes);
+  return(1);
+}
+
+/*
+ *  A resource list that was converted once, with compile_rlist_p,
+ *  so that it can be applied over and over without going through
+ *  the dictionary again.
+ */
+#define NGL_RLIST_CAPSULE "ngl.ResourceList"
+
+static void free_compiled_rlist(PyObject *capsule) {
+  ResInfo *info;
+
+  info = (ResInfo *) PyCapsule_GetPointer(capsule,NGL_RLIST_CAPSULE);
+  if (info != NULL) {
+    free_resinfo(info);
+    free(info);
+  }
+}
+
+PyObject *compile_rlist_p(PyObject *dict) {
+  ResInfo *info;
+
+  info = (ResInfo *) malloc(sizeof(ResInfo));
+  if (!dict_to_rlist(dict,info,1)) {
+    free(info);
+    if (PyErr_Occurred()) return(NULL);
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  return(PyCapsule_New((void *) info,NGL_RLIST_CAPSULE,free_compiled_rlist));
+}
+
+/*
+ *  Fills in info from either a dictionary or a compiled resource
+ *  list. A compiled list is shared, so its temps field is cleared
+ *  to keep free_resinfo from destroying it.
+ */
+static int rlist_from_object(PyObject *obj, ResInfo *info) {
+  ResInfo *compiled;
+
+  if (PyCapsule_IsValid(obj,NGL_RLIST_CAPSULE)) {
+    compiled = (ResInfo *) PyCapsule_GetPointer(obj,NGL_RLIST_CAPSULE);
+    info->id       = compiled->id;
+    info->nstrings = compiled->nstrings;
+    info->strings  = compiled->strings;
+    info->temps    = NULL;
+    return(1);
+  }
+  return(dict_to_rlist(obj,info,0));
+}
+
 float *d2f(int isize, double *darray) {
   float *farray;
   int i;
@@ -1365,11 +2613,39 @@ import_array();
   $1 = (int *) arr->data;
 }
 
-%typemap (in) ng_size_t *sequence_as_ngsizet {
-  PyArrayObject *arr;
-  arr =
-   (PyArrayObject *) PyArray_ContiguousFromAny($input,PyArray_LONG,0,0);
-  $1 = (long *) arr->data;
+%typemap (in) ng_size_t *sequence_as_ngsizet {
+  PyArrayObject *arr;
+  arr =
+   (PyArrayObject *) PyArray_ContiguousFromAny($input,PyArray_LONG,0,0);
+  $1 = (long *) arr->data;
+}
+
+//
+// array_as_double and array_as_int convert a sequence like
+// sequence_as_double and sequence_as_int, but fail if it can't be
+// converted, and release the converted array when the call returns.
+// The function must not keep the pointer.
+//
+%typemap (in) double *array_as_double (PyArrayObject *arr = NULL) {
+  arr =
+   (PyArrayObject *) PyArray_ContiguousFromAny($input,PyArray_DOUBLE,0,0);
+  if (arr == NULL) SWIG_fail;
+  $1 = (double *) arr->data;
+}
+
+%typemap (freearg) double *array_as_double {
+  Py_XDECREF(arr$argnum);
+}
+
+%typemap (in) int *array_as_int (PyArrayObject *arr = NULL) {
+  arr =
+   (PyArrayObject *) PyArray_ContiguousFromAny($input,PyArray_INT,0,0);
+  if (arr == NULL) SWIG_fail;
+  $1 = (int *) arr->data;
+}
+
+%typemap (freearg) int *array_as_int {
+  Py_XDECREF(arr$argnum);
 }
 
 %typemap (argout) (int *numberf) {
@@ -2369,606 +3645,35 @@ import_array();
 %}
 
 %typemap(in) ResInfo *rlist {
-  int i,list_type,count;
-  ng_size_t list_len;
-  Py_ssize_t pos=0;
-  PyObject *key,*value;
-  PyArrayObject *arr;
-  char **strings;
-  double *dvals;
-  int *ivals,array_type,rlist,ndims;
-  ng_size_t *len_dims;
-  long *lvals;
   static ResInfo trname;
-  char **trnames;
-
-/*
- *  Clear the resource list.
- */
-  rlist = NhlRLCreate(NhlSETRL);
-  NhlRLClear(rlist);
-
-/*
- *  Check on the type of the argument - it must be a dictionary.
- */
-  if (PyDict_Check($input)) {
-    count = 0;
-    trname.nstrings = PyDict_Size($input);
-    trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-    pos = 0;
-/*
- *  Loop over the keyword/value pairs in the dictionary.
- *  The values must be one of: tuple, int, float, long,
- *  list, string, or array.
- */
-    while (PyDict_Next($input, &pos, &key, &value)) {
-      trnames[count] = as_utf8_char(key);
-      count++;
-
-/*
- *  value is a tuple.
- */
-      if (PyTuple_Check(value)) {
-/*
- *  Lists and tuples are not allowed as items in a tuple value.
- */
-        if (PyList_Check(PyTuple_GetItem(value,0)) ||
-           PyTuple_Check(PyTuple_GetItem(value,0))) {
-          printf("Tuple values are not allowed to have list or tuple items.\n");
-          return NULL;
-        }
-        list_len = (ng_size_t)PyTuple_Size(value);
-/*
- *  Determine if the tuple is a tuple of strings, ints, or floats.
- *  
- *    list_type = 2 (int)
- *              = 0 (string)
- *              = 1 (float)
- */
-        list_type = 2;
-        if (is_string_type(PyTuple_GetItem(value,0))) {
-/*
- *  Check that all items in the tuple are strings.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (!is_string_type(PyTuple_GetItem(value,i))) {
-              printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-            return NULL;
-            }
-          }
-          list_type = 0;
-        }
-        else {
-/*
- *  If the items in the tuple value are not strings, then
- *  they must all be ints or floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                 (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-              printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-              return NULL;
-              break;
-            }
-          }
-/*
- *  Check to see if the tuple has all ints and, if not, type it as
- *  a tuple of floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-              list_type = 1;
-              break;
-            }
-          }
-        }
 
 /*
- *  Make the appropriate NhlRLSet calls based on the type of
- *  tuple elements.
- */
-        switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-        }
-      }
-/*
- *  value is a list.
- */
-      else if (PyList_Check(value)) {
-/*
- *  Lists and tuples are not allowed as items in a list value.
+ *  Convert the dictionary to a new resource list. It, and the
+ *  memory it refers to, is freed once the call has returned.
  */
-        if (PyList_Check(PyList_GetItem(value,0)) ||
-           PyList_Check(PyList_GetItem(value,0))) {
-          printf("Use NumPy arrays for multiple dimension arrays.\n");
-          return NULL;
-        }
-        list_len = (ng_size_t)PyList_Size(value);
-/*
- *  Determine if the list is a list of strings, ints, or floats.
- *  
- *    list_type = 2 (int)
- *              = 0 (string)
- *              = 1 (float)
- */
-        list_type = 2;
-        if (is_string_type(PyList_GetItem(value,0))) {
-/*
- *  Check that all items in the list are strings.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (!is_string_type(PyList_GetItem(value,i))) {
-              printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-              return NULL;
-              break;
-            }
-          }
-          list_type = 0;
-        }
-        else {
-/*
- *  If the items in the list value are not strings, then
- *  they must all be ints or floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                 (!PyInt_Check(PyList_GetItem(value,i))) ) {
-              printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-              return NULL;
-            }
-          }
-/*
- *  Check to see if the list has all ints and, if not, type it as
- *  a list of floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (PyFloat_Check(PyList_GetItem(value,i))) {
-              list_type = 1;
-            }
-          }
-        }
-        switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-        }
-      }
-/*
- *  Check for scalars.
- */
-      else if (PyArray_IsAnyScalar(value)) {
-/*
- *  Check for Python Scalars.
- */
-        if (PyArray_IsPythonScalar(value)) {
-/*
- *  value is a Python int.
- */
-          if (PyInt_Check(value)) {
-            NhlRLSetInteger(rlist,as_utf8_char(key),
-                               (int) PyInt_AsLong(value));
-          }
-/*
- *  value is a Python float.
- */
-          else if (PyFloat_Check(value)) {
-            NhlRLSetDouble(rlist,as_utf8_char(key),
-                               PyFloat_AsDouble(value));
-          }
-/*
- *  value is a Python long.
- */
-          else if (PyLong_Check(value)) {
-            NhlRLSetInteger(rlist,as_utf8_char(key),
-                               (int) PyInt_AsLong(value));
-          }
-/*
- *  value is a Python string
- */
-          else if (is_string_type(value)) {
-            NhlRLSetString(rlist,as_utf8_char(key),
-                               as_utf8_char(value));
-          }
-        }
-/*
- *  otherwise we have numpy scalars
- */
-        else {
-/*
- *  value is a numpy int.
- */
-          if (PyArray_IsScalar(value,Int)) {
-            NhlRLSetInteger(rlist,as_utf8_char(key),
-                               (int) PyInt_AsLong(value));
-          }
-/*
- *  value is a numpy float.
- */
-          else if (PyArray_IsScalar(value,Float)) {
-            NhlRLSetDouble(rlist,as_utf8_char(key),
-                               PyFloat_AsDouble(value));
-          }
-/*
- *  value is a numpy long.
- */
-          else if (PyArray_IsScalar(value,Long)) {
-            NhlRLSetInteger(rlist,as_utf8_char(key),
-                               (int) PyInt_AsLong(value));
-          }
-/*
- *  value is a numpy string
- */
-          else if (PyArray_IsScalar(value,String)) {
-            NhlRLSetString(rlist,as_utf8_char(key),
-                               as_utf8_char(value));
-          }
-        }
-      }
-/*
- *  value is an array.
- */
-      else if (PyArray_Check(value)) {
-        
-        array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-/*
- *  Process the legal array types.
- */
-        if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-          arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-                     ((PyObject *) value,PyArray_LONG,0,0);
-          lvals = (long *)arr->data;
-          ndims = arr->nd;
-          len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-          for(i = 0; i < ndims; i++ ) {
-            len_dims[i] = (ng_size_t)arr->dimensions[i];
-          }
-          NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-        }
-        else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-          arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-                 ((PyObject *) value,PyArray_DOUBLE,0,0);
-          dvals = (double *)arr->data;
-          ndims = arr->nd;
-          len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-          for(i = 0; i < ndims; i++ ) {
-            len_dims[i] = (ng_size_t)arr->dimensions[i];
-          }
-          NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-        }
-        else {
-          printf(
-            "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-        }
-      }
-      else {
-        printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-        return NULL;
-      }
-    }
-    trname.strings = trnames;
-  }
-  else {
-    printf("Resource lists must be dictionaries\n");
+  if (!dict_to_rlist($input,&trname,0)) {
+    SWIG_fail;
   }
-  trname.id = rlist;
   $1 = (ResInfo *) &trname;
 }
 
-%typemap(in) int res_id {
-  int i,list_type,count;
-  ng_size_t list_len;
-  Py_ssize_t pos=0;
-  PyObject *key,*value;
-  PyArrayObject *arr;
-  char **strings;
-  double *dvals;
-  int *ivals,array_type,rlist,ndims;
-  ng_size_t *len_dims;
-  long *lvals;
-  ResInfo trname;
-  char **trnames;
-
-/*
- *  Clear the resource list.
- */
-  rlist = NhlRLCreate(NhlSETRL);
-  NhlRLClear(rlist);
-
-/*
- *  Check on the type of the argument - it must be a dictionary.
- */
-  if (PyDict_Check($input)) {
-    count = 0;
-    trname.nstrings = PyDict_Size($input);
-    trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-    pos = 0;
-/*
- *  Loop over the keyword/value pairs in the dictionary.
- *  The values must be one of: tuple, int, float, long,
- *  list, string, or array.
- */
-    while (PyDict_Next($input, &pos, &key, &value)) {
-      trnames[count] = as_utf8_char(key);
-      count++;
-
-/*
- *  value is a tuple.
- */
-      if (PyTuple_Check(value)) {
-/*
- *  Lists and tuples are not allowed as items in a tuple value.
- */
-        if (PyList_Check(PyTuple_GetItem(value,0)) ||
-           PyTuple_Check(PyTuple_GetItem(value,0))) {
-          printf("Tuple values are not allowed to have list or tuple items.\n");
-          return NULL;
-        }
-        list_len = (ng_size_t)PyTuple_Size(value);
-/*
- *  Determine if the tuple is a tuple of strings, ints, or floats.
- *  
- *    list_type = 2 (int)
- *              = 0 (string)
- *              = 1 (float)
- */
-        list_type = 2;
-        if (is_string_type(PyTuple_GetItem(value,0))) {
-/*
- *  Check that all items in the tuple are strings.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (!is_string_type(PyTuple_GetItem(value,i))) {
-              printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-            return NULL;
-            }
-          }
-          list_type = 0;
-        }
-        else {
-/*
- *  If the items in the tuple value are not strings, then
- *  they must all be ints or floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                 (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-              printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-              return NULL;
-              break;
-            }
-          }
-/*
- *  Check to see if the tuple has all ints and, if not, type it as
- *  a tuple of floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-              list_type = 1;
-              break;
-            }
-          }
-        }
+%typemap(freearg) ResInfo *rlist {
+  free_resinfo($1);
+}
 
-/*
- *  Make the appropriate NhlRLSet calls based on the type of
- *  tuple elements.
- */
-        switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-        }
-      }
-/*
- *  value is a list.
- */
-      else if (PyList_Check(value)) {
-/*
- *  Lists and tuples are not allowed as items in a list value.
- */
-        if (PyList_Check(PyList_GetItem(value,0)) ||
-           PyList_Check(PyList_GetItem(value,0))) {
-          printf("Use NumPy arrays for multiple dimension arrays.\n");
-          return NULL;
-        }
-        list_len = (ng_size_t)PyList_Size(value);
-/*
- *  Determine if the list is a list of strings, ints, or floats.
- *  
- *    list_type = 2 (int)
- *              = 0 (string)
- *              = 1 (float)
- */
-        list_type = 2;
-        if (is_string_type(PyList_GetItem(value,0))) {
-/*
- *  Check that all items in the list are strings.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (!is_string_type(PyList_GetItem(value,i))) {
-              printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-              return NULL;
-              break;
-            }
-          }
-          list_type = 0;
-        }
-        else {
-/*
- *  If the items in the list value are not strings, then
- *  they must all be ints or floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                 (!PyInt_Check(PyList_GetItem(value,i))) ) {
-              printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-              return NULL;
-            }
-          }
-/*
- *  Check to see if the list has all ints and, if not, type it as
- *  a list of floats.
- */
-          for (i = 0; i < list_len ; i++) {
-            if (PyFloat_Check(PyList_GetItem(value,i))) {
-              list_type = 1;
-            }
-          }
-        }
-        switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-        }
-      }
-/*
- *  value is an int.
- */
-      else if (PyInt_Check(value)) {
-        NhlRLSetInteger(rlist,as_utf8_char(key),(int) PyInt_AsLong(value));
-      }
-/*
- *  value is a float.
- */
-      else if (PyFloat_Check(value)) {
-        NhlRLSetDouble(rlist,as_utf8_char(key),PyFloat_AsDouble(value));
-      }
-/*
- *  value is a long.
- */
-      else if (PyLong_Check(value)) {
-        NhlRLSetInteger(rlist,as_utf8_char(key),(int) PyInt_AsLong(value));
-      }
-/*
- *  value is a string
- */
-      else if (is_string_type(value)) {
-        NhlRLSetString(rlist,as_utf8_char(key),as_utf8_char(value));
-      }
-/*
- *  value is an array.
- */
-      else if (PyArray_Check(value)) {
-        
-        array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-/*
- *  Process the legal array types.
- */
-        if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-          arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-                ((PyObject *) value,PyArray_LONG,0,0);
-          lvals = (long *)arr->data;
-          ndims = arr->nd;
-          len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-          for(i = 0; i < ndims; i++ ) {
-            len_dims[i] = (ng_size_t)arr->dimensions[i];
-          }
-          NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-        }
-        else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-          arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-                 ((PyObject *) value,PyArray_DOUBLE,0,0);
-          dvals = (double *)arr->data;
-          ndims = arr->nd;
-          len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-          for(i = 0; i < ndims; i++ ) {
-            len_dims[i] = (ng_size_t)arr->dimensions[i];
-          }
-          NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-        }
-        else {
-          printf(
-            "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-        }
-      }
-      else {
-        printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-        return NULL;
-      }
-    }
-    trname.strings = trnames;
-  }
-  else {
-    printf("Resource lists must be dictionaries\n");
+//
+//  res_id also takes a resource list compiled with compile_rlist_p,
+//  which is used as is and not freed.
+//
+%typemap(in) int res_id (ResInfo trname) {
+  if (!rlist_from_object($input,&trname)) {
+    SWIG_fail;
   }
-  trname.id = rlist;
-  $1 = rlist;
+  $1 = trname.id;
+}
+
+%typemap(argout) int res_id {
+  free_resinfo(&trname$argnum);
 }
 
 typedef char *NhlString;
@@ -3255,6 +3960,8 @@ extern void getbb(int, float *OUTPUT, float *OUTPUT, float *OUTPUT, float *OUTPU
 
 
 extern void c_wmbarbp(int, float, float, float, float);
+extern void c_wmbarbs(int, double *array_as_double, double *array_as_double,
+                      double *array_as_double, double *array_as_double, int);
 extern void c_wmsetip(NhlString,int);
 extern void c_wmsetrp(NhlString,float);
 extern void c_wmsetcp(NhlString,NhlString);
@@ -3297,6 +4004,71 @@ extern NhlString get_nglRes_s(int);
 
 extern NhlErrorTypes NglGaus_p(int num, int nxir, int nyir, double *p_array_double_out[]);
 
+extern void update_scalar_field_wrap(int, nglPlotId *plot, 
+                           void *sequence_as_void, const char *, int, int,
+                           int, ResInfo *rlist, ResInfo *rlist, 
+                           nglRes *rlist);
+extern void update_vector_field_wrap(int, nglPlotId *plot, 
+                           void *sequence_as_void, void *sequence_as_void,
+                           const char *, const char *, int, int, int,
+                           ResInfo *rlist, ResInfo *rlist, nglRes *rlist);
+extern PyObject *panel_layout_p();
+extern int create_mesh(double *array_as_double, double *array_as_double,
+                       int, double *array_as_double, double *array_as_double,
+                       int, int *array_as_int, int, int);
+extern void destroy_mesh(int);
+extern nglPlotId contour_mesh_wrap(int, int, void *sequence_as_void, 
+                            const char *, ResInfo *rlist, ResInfo *rlist,
+                            ResInfo *rlist, nglRes *rlist);
+extern nglPlotId contour_map_mesh_wrap(int, int, void *sequence_as_void, 
+                            const char *, ResInfo *rlist, ResInfo *rlist,
+                            ResInfo *rlist, nglRes *rlist);
+extern PyObject *region_cull_p(double *array_as_double, double *array_as_double,
+                       int, int, double, double, double, double, double);
+extern PyObject *decimate_xy_p(double *array_as_double, double *array_as_double,
+                       int, double, double, int, int, int, double, int, double);
+extern PyObject *histogram2d_p(double *array_as_double, double *array_as_double,
+                       int, int, int, double, double, double, double, int, double,
+                       int, double);
+extern int raster_fill_wrap(int, int, double *array_as_double, int, int,
+                       double, double, double, double, int,
+                       double *array_as_double, int, int *array_as_int,
+                       int, double, int);
+extern PyObject *png_to_rgba_p(PyObject *);
+extern int load_colormap_files();
+extern PyObject *compile_rlist_p(PyObject *);
+extern void set_nglRes_defaults(int);
+extern int set_nglRes_p(PyObject *);
+extern void set_stats(int);
+extern int get_stats_level();
+extern PyObject *get_stats_p();
+extern PyObject *get_trace_p();
+extern PyObject *gc_dist_p(double *array_as_double, double *array_as_double,
+                       double *array_as_double, double *array_as_double, int, int);
+extern PyObject *gc_azim_p(double *array_as_double, double *array_as_double,
+                       double *array_as_double, double *array_as_double, int);
+extern PyObject *gc_dest_p(double *array_as_double, double *array_as_double,
+                       double *array_as_double, double *array_as_double, int, int);
+extern PyObject *gc_dist_pairs_p(double *array_as_double, double *array_as_double, int,
+                       double *array_as_double, double *array_as_double, int, int);
+extern PyObject *wmstnms_p(int, double *array_as_double, double *array_as_double, int,
+                      PyObject *, double);
+extern PyObject *dcapethermo_cols_p(double *array_as_double, int,
+                       double *array_as_double, double *array_as_double, int, int, double);
+extern PyObject *skewt_thermo_p(int, double *array_as_double, double *array_as_double, int);
+extern PyObject *nn_weights_p(int, double *array_as_double, double *array_as_double,
+                       int, int, double *array_as_double, double *array_as_double);
+extern PyObject *nn_apply_p(PyObject *, PyObject *, int, double);
+extern PyObject *css_fit_p(int, double *array_as_double, double *array_as_double);
+extern PyObject *css_grads_p(PyObject *, PyObject *, int);
+extern PyObject *css_eval_p(PyObject *, PyObject *, PyObject *, int,
+                       PyObject *, PyObject *);
+extern PyObject *ftcurv_n_p(int, int, PyObject *, PyObject *, PyObject *,
+                       int, double, double, int);
+extern PyObject *ndc_transform_p(int, int, PyObject *, PyObject *, PyObject *,
+                       PyObject *, double, double, int, int);
+extern PyObject *asciiread_p(char *, char *, int, PyObject *, int);
+
 %newobject _NGGetNCARGEnv(const char *);
 %newobject  NhlSetValues (int, int res_id);
 %newobject  NhlRLSetString (int, NhlString, NhlString);
@@ -3529,3 +4301,44 @@ extern NhlErrorTypes NglGaus_p(int num, int nxir, int nyir, double *p_array_doub
 %newobject  get_nglRes_i(int);
 %newobject  get_nglRes_f(int);
 %newobject  get_nglRes_c(int);
+%newobject panel_layout_p();
+%newobject contour_mesh_wrap(int, int, void *sequence_as_void, 
+                            const char *, ResInfo *rlist, ResInfo *rlist,
+                            ResInfo *rlist, nglRes *rlist);
+%newobject contour_map_mesh_wrap(int, int, void *sequence_as_void, 
+                            const char *, ResInfo *rlist, ResInfo *rlist,
+                            ResInfo *rlist, nglRes *rlist);
+%newobject region_cull_p(double *array_as_double, double *array_as_double,
+                       int, int, double, double, double, double, double);
+%newobject decimate_xy_p(double *array_as_double, double *array_as_double,
+                       int, double, double, int, int, int, double, int, double);
+%newobject histogram2d_p(double *array_as_double, double *array_as_double,
+                       int, int, int, double, double, double, double, int, double,
+                       int, double);
+%newobject png_to_rgba_p(PyObject *);
+%newobject compile_rlist_p(PyObject *);
+%newobject get_stats_p();
+%newobject get_trace_p();
+%newobject gc_dist_p(double *array_as_double, double *array_as_double,
+                       double *array_as_double, double *array_as_double, int, int);
+%newobject gc_azim_p(double *array_as_double, double *array_as_double,
+                       double *array_as_double, double *array_as_double, int);
+%newobject gc_dest_p(double *array_as_double, double *array_as_double,
+                       double *array_as_double, double *array_as_double, int, int);
+%newobject gc_dist_pairs_p(double *array_as_double, double *array_as_double, int,
+                       double *array_as_double, double *array_as_double, int, int);
+%newobject dcapethermo_cols_p(double *array_as_double, int,
+                       double *array_as_double, double *array_as_double, int, int, double);
+%newobject skewt_thermo_p(int, double *array_as_double, double *array_as_double, int);
+%newobject nn_weights_p(int, double *array_as_double, double *array_as_double,
+                       int, int, double *array_as_double, double *array_as_double);
+%newobject nn_apply_p(PyObject *, PyObject *, int, double);
+%newobject css_fit_p(int, double *array_as_double, double *array_as_double);
+%newobject css_grads_p(PyObject *, PyObject *, int);
+%newobject css_eval_p(PyObject *, PyObject *, PyObject *, int,
+                       PyObject *, PyObject *);
+%newobject ftcurv_n_p(int, int, PyObject *, PyObject *, PyObject *,
+                       int, double, double, int);
+%newobject ndc_transform_p(int, int, PyObject *, PyObject *, PyObject *,
+                       PyObject *, double, double, int, int);
+%newobject asciiread_p(char *, char *, int, PyObject *, int);
@@ -3217,6 +3217,14 @@ static int dict_setitemstring(PyObject *d, const char *key, PyObject *val) {
 #include <stdio.h>
 #include <math.h>
 #include <stdarg.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#ifdef _OPENMP
+#include <omp.h>
+#endif
 #include <ncarg/hlu/hluP.h>
 #include <ncarg/hlu/ResListP.h>
 #include <ncarg/hlu/AppI.h>
@@ -3295,10 +3303,12 @@ extern NhlClass NhlPstreamlinePlotClass();
 extern const char *NGGetNCARGEnv(const char *name);
 
 extern void c_wmbarbp(int, float, float, float, float);
+extern void c_wmbarbs(int, double *, double *, double *, double *, int);
 extern void c_wmsetip(NhlString,int);
 extern void c_wmsetrp(NhlString,float);
 extern void c_wmsetcp(NhlString,NhlString);
 extern void c_wmstnmp(int, float, float, NhlString);
+extern void c_wmstnms(int, double *, double *, int, char *, double);
 extern int  c_wmgetip(NhlString);
 extern float c_wmgetrp(NhlString);
 extern NhlString c_wmgetcp(NhlString);
@@ -3313,12 +3323,38 @@ extern NhlString c_nngetcp(NhlString);
 extern void *pvoid();
 
 extern double c_dgcdist(double, double, double, double, int);
+extern void c_dcapethermo_cols(double *, int, double *, double *, int, int,
+                               double, double *, double *, double *,
+                               double *, double *);
+extern void c_dgcdist_n(double *, double *, double *, double *, int, int,
+                        double *);
+extern void c_dgcazim_n(double *, double *, double *, double *, int,
+                        double *);
+extern void c_dgcdest_n(double *, double *, double *, double *, int, int,
+                        double *, double *);
+extern void c_dgcdist_pairs(double *, double *, int, double *, double *,
+                            int, int, double *);
 extern double c_dshowalskewt(double *, double *, double *, int);
 extern double c_dpwskewt(double *, double *, int);
 extern double c_dsatlftskewt(double, double);
 extern double c_dtmrskewt(double, double);
 extern double c_dtdaskewt(double, double);
 extern void c_dptlclskewt(double, double, double, double *, double *);
+extern void c_dskewt_n(int, double *, double *, int, double *);
+extern int c_nnweights(int, double *, double *, int, int, double *,
+                       double *, int **, int **, double **);
+extern void c_nnapply(int, int *, int *, double *, int, int, double *,
+                      double, double *);
+extern void *c_cssfit(int, double *, double *, int *);
+extern void c_cssfree(void *);
+extern void c_cssgrads(void *, int, double *, double *);
+extern void c_csseval(void *, int, double *, double *, int, double *,
+                      double *, double *);
+extern int c_ftcurv_n(int, int, int, double *, double *, int, double *,
+                      int, double, double, double *, double *, double *);
+extern long c_asciicount(char *, size_t, char, int, int, long *);
+extern long c_asciiparse(char *, size_t, char, int, int, long *, long,
+                         void *);
 
 static PyObject* t_output_helper(PyObject* target, PyObject* o) {
     PyObject*   o2;
@@ -3439,6 +3475,9 @@ void set_nglRes_i(int pos, int ival) {
   else if (pos == 57) {
     nglRlist.nglMaskLambertConformalOutlineOn = ival;
   }
+  else if (pos == 58) {
+    nglRlist.nglPanelLayoutOnly = ival;
+  }
   else {
     printf("set_nglRes_i: invalid argument %d\n",pos);
   }
@@ -3532,6 +3571,9 @@ int get_nglRes_i(int pos) {
   else if (pos == 57) {
     return(nglRlist.nglMaskLambertConformalOutlineOn);
   }
+  else if (pos == 58) {
+    return(nglRlist.nglPanelLayoutOnly);
+  }
   else {
     printf("get_nglRes_i: invalid argument %d\n",pos);
   }
@@ -3747,6 +3789,122 @@ NhlString get_nglRes_s (int pos) {
   }
 }
 
+/*
+ *  The type of the special resource at each position used by the
+ *  set_nglRes_* functions: i(nt), f(loat), s(tring), or c for the
+ *  string array.
+ */
+static const char nglRes_types[] =
+  "iiiiiifffiiffiffffffffiiiiiifffffffiiiciiffiifsiiiffffiiiii";
+
+/*
+ *  The special resource defaults are built once and copied into
+ *  nglRlist at the start of each plotting call, rather than being
+ *  set one at a time.
+ */
+static nglRes nglRes_defaults;
+static int    nglRes_defaults_set = 0;
+
+/*
+ *  Copies of the string values handed to nglRlist by set_nglRes_p.
+ */
+static char      *nglRes_app_file    = NULL;
+static NhlString *nglRes_fig_strings = NULL;
+static int        nglRes_nfig_strings = 0;
+
+void set_nglRes_defaults(int list_type) {
+  if (!nglRes_defaults_set) {
+    initialize_resources(&nglRes_defaults,nglPlot);
+    nglRes_defaults.nglPointTickmarksOutward         = 0;
+    nglRes_defaults.nglMaskLambertConformal          = 0;
+    nglRes_defaults.nglMaskLambertConformalOutlineOn = 1;
+    nglRes_defaults_set = 1;
+  }
+  nglRlist = nglRes_defaults;
+  if (list_type == nglPrimitive) {
+    nglRlist.nglMaximize = 0;
+    nglRlist.nglFrame    = 0;
+  }
+}
+
+/*
+ *  Sets any number of special resources in one call. values is a
+ *  dictionary keyed by the same positions set_nglRes_i, set_nglRes_f,
+ *  set_nglRes_c and set_nglRes_s take.
+ */
+int set_nglRes_p(PyObject *values) {
+  Py_ssize_t pos = 0;
+  PyObject *key, *value, *seq;
+  int i, ipos, nitems;
+
+  if (!PyDict_Check(values)) {
+    printf("set_nglRes_p: special resources must be a dictionary\n");
+    return(0);
+  }
+  while (PyDict_Next(values, &pos, &key, &value)) {
+    ipos = (int) PyInt_AsLong(key);
+    if (ipos < 0 || ipos >= (int) sizeof(nglRes_types)-1) {
+      PyErr_Clear();
+      printf("set_nglRes_p: invalid argument %d\n",ipos);
+      continue;
+    }
+    switch(nglRes_types[ipos]) {
+    case 'i':
+      if (PyFloat_Check(value)) {
+        set_nglRes_i(ipos,(int) PyFloat_AsDouble(value));
+      }
+      else {
+        set_nglRes_i(ipos,(int) PyInt_AsLong(value));
+      }
+      break;
+    case 'f':
+      set_nglRes_f(ipos,(float) PyFloat_AsDouble(value));
+      break;
+    case 's':
+      if (!is_string_type(value)) {
+        printf("set_nglRes_p: position %d must be a string\n",ipos);
+        break;
+      }
+      free(nglRes_app_file);
+      nglRes_app_file = (char *) as_utf8_char(value);
+      set_nglRes_s(ipos,nglRes_app_file);
+      break;
+    case 'c':
+      seq = PySequence_Fast(value,"");
+      if (seq == NULL) {
+        PyErr_Clear();
+        printf("set_nglRes_p: position %d must be a list of strings\n",ipos);
+        break;
+      }
+      nitems = (int) PySequence_Fast_GET_SIZE(seq);
+      for (i = 0; i < nitems; i++) {
+        if (!is_string_type(PySequence_Fast_GET_ITEM(seq,i))) break;
+      }
+      if (i < nitems) {
+        Py_DECREF(seq);
+        printf("set_nglRes_p: position %d must be a list of strings\n",ipos);
+        break;
+      }
+      for (i = 0; i < nglRes_nfig_strings; i++) free(nglRes_fig_strings[i]);
+      free(nglRes_fig_strings);
+      nglRes_fig_strings = (NhlString *) calloc(nitems+1,sizeof(NhlString));
+      for (i = 0; i < nitems; i++) {
+        nglRes_fig_strings[i] = (NhlString)
+                    as_utf8_char(PySequence_Fast_GET_ITEM(seq,i));
+      }
+      nglRes_nfig_strings = nitems;
+      Py_DECREF(seq);
+      set_nglRes_c(ipos,nglRes_fig_strings);
+      break;
+    }
+  }
+  if (PyErr_Occurred()) {
+    PyErr_Clear();
+    printf("set_nglRes_p: some special resource values were invalid\n");
+  }
+  return(1);
+}
+
 void set_PCMP04(int arg_num, float value)
 {
   if (arg_num < 1 || arg_num > 3) {
@@ -3818,6 +3976,285 @@ PyObject *dcapethermo(double *penv, double *tenv, int nlvl, double lclmb,
   return resultobj;
 }
 
+PyObject *dcapethermo_cols_p(double *p, int p_is_1d, double *t, double *td,
+                             int nlvl, int ncol, double tmsg) {
+  PyObject *obj[5], *resultobj;
+  npy_intp dims[1];
+  int i;
+
+  dims[0] = (npy_intp)(ncol > 0 ? ncol : 0);
+  for(i = 0; i < 5; i++) {
+    obj[i] = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+    if (obj[i] == NULL) {
+      while(i-- > 0) Py_DECREF(obj[i]);
+      return NULL;
+    }
+  }
+/*
+ *  The GIL is kept, so that DCAPETHERMO is never running in two
+ *  threads at once.
+ */
+  c_dcapethermo_cols(p,p_is_1d,t,td,nlvl,(int)dims[0],tmsg,
+                     (double *)((PyArrayObject *)obj[0])->data,
+                     (double *)((PyArrayObject *)obj[1])->data,
+                     (double *)((PyArrayObject *)obj[2])->data,
+                     (double *)((PyArrayObject *)obj[3])->data,
+                     (double *)((PyArrayObject *)obj[4])->data);
+
+  resultobj = Py_None;
+  for(i = 0; i < 5; i++) {
+    resultobj = t_output_helper(resultobj,obj[i]);
+  }
+  return resultobj;
+}
+
+/*
+ *  The temperatures for n skew-T background points, from c_dskewt_n.
+ *  That is a plain loop calling the Fortran helper once per point, so
+ *  the results are the same as n calls of c_dtmrskewt, c_dtdaskewt or
+ *  c_dsatlftskewt.
+ */
+PyObject *skewt_thermo_p(int which, double *a, double *p, int n) {
+  PyObject *obj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  if (obj == NULL) return NULL;
+  c_dskewt_n(which,a,p,(int)dims[0],(double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+/*
+ *  Natural neighbor weights from c_nnweights, kept in a capsule by
+ *  nn_weights_p so that they can be applied to any number of fields
+ *  with nn_apply_p.
+ */
+#define NGL_NN_CAPSULE "ngl.NatgridWeights"
+
+typedef struct {
+  int    nin, nout;
+  int    *ptr, *idx;
+  double *wts;
+} nglNNWeights;
+
+static void free_nn_weights(PyObject *capsule) {
+  nglNNWeights *nn;
+
+  nn = (nglNNWeights *) PyCapsule_GetPointer(capsule,NGL_NN_CAPSULE);
+  if (nn != NULL) {
+    free(nn->ptr);
+    free(nn->idx);
+    free(nn->wts);
+    free(nn);
+  }
+}
+
+PyObject *nn_weights_p(int n, double *x, double *y, int nxo, int nyo,
+                       double *xo, double *yo) {
+  nglNNWeights *nn;
+  PyObject *obj, *resultobj;
+  int ier;
+
+  nn = (nglNNWeights *) malloc(sizeof(nglNNWeights));
+  if (nn == NULL) return PyErr_NoMemory();
+  nn->nin  = n;
+  nn->nout = nxo*nyo;
+  Py_BEGIN_ALLOW_THREADS
+  ier = c_nnweights(n,x,y,nxo,nyo,xo,yo,&nn->ptr,&nn->idx,&nn->wts);
+  Py_END_ALLOW_THREADS
+  if (ier != 0) {
+    free(nn);
+    Py_INCREF(Py_None);
+    obj = Py_None;
+  }
+  else {
+    obj = PyCapsule_New((void *) nn,NGL_NN_CAPSULE,free_nn_weights);
+  }
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) ier));
+  resultobj = t_output_helper(resultobj,obj);
+  return resultobj;
+}
+
+/*
+ *  z holds nfld fields of values at the points the weights were made
+ *  for. The array isn't kept, so it's converted here rather than by
+ *  the sequence typemaps.
+ */
+PyObject *nn_apply_p(PyObject *weights, PyObject *z, int nfld, double fill) {
+  nglNNWeights *nn;
+  PyArrayObject *arr;
+  PyObject *obj;
+  npy_intp dims[1];
+
+  nn = (nglNNWeights *) PyCapsule_GetPointer(weights,NGL_NN_CAPSULE);
+  if (nn == NULL) {
+    PyErr_Clear();
+    printf("nn_apply_p: invalid natural neighbor weights\n");
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  arr = (PyArrayObject *) PyArray_ContiguousFromAny(z,PyArray_DOUBLE,0,0);
+  if (arr == NULL || PyArray_SIZE(arr) != (npy_intp)nfld*nn->nin) {
+    PyErr_Clear();
+    Py_XDECREF(arr);
+    printf("nn_apply_p: the fields must have %d values each\n",nn->nin);
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  dims[0] = (npy_intp)nfld*nn->nout;
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  Py_BEGIN_ALLOW_THREADS
+  c_nnapply(nn->nout,nn->ptr,nn->idx,nn->wts,nn->nin,nfld,
+            (double *)arr->data,fill,(double *)((PyArrayObject *)obj)->data);
+  Py_END_ALLOW_THREADS
+  Py_DECREF(arr);
+  return(obj);
+}
+
+/*
+ *  A spherical surface from c_cssfit, kept in a capsule by css_fit_p.
+ *  css_grads_p estimates the gradients of fields at its points, and
+ *  css_eval_p evaluates the fields anywhere on the sphere.
+ */
+#define NGL_CSS_CAPSULE "ngl.SphereSurface"
+
+typedef struct {
+  int  n;
+  void *surf;
+} nglCSSurface;
+
+static void free_css_surface(PyObject *capsule) {
+  nglCSSurface *css;
+
+  css = (nglCSSurface *) PyCapsule_GetPointer(capsule,NGL_CSS_CAPSULE);
+  if (css != NULL) {
+    c_cssfree(css->surf);
+    free(css);
+  }
+}
+
+static nglCSSurface *css_from_capsule(PyObject *capsule, char *name) {
+  nglCSSurface *css;
+
+  css = (nglCSSurface *) PyCapsule_GetPointer(capsule,NGL_CSS_CAPSULE);
+  if (css == NULL) {
+    PyErr_Clear();
+    printf("%s: invalid spherical surface\n",name);
+  }
+  return(css);
+}
+
+PyObject *css_fit_p(int n, double *rlat, double *rlon) {
+  nglCSSurface *css;
+  PyObject *obj, *resultobj;
+  int ier;
+
+  css = (nglCSSurface *) malloc(sizeof(nglCSSurface));
+  css->n = n;
+  Py_BEGIN_ALLOW_THREADS
+  css->surf = c_cssfit(n,rlat,rlon,&ier);
+  Py_END_ALLOW_THREADS
+  if (ier != 0) {
+    c_cssfree(css->surf);
+    free(css);
+    Py_INCREF(Py_None);
+    obj = Py_None;
+  }
+  else {
+    obj = PyCapsule_New((void *) css,NGL_CSS_CAPSULE,free_css_surface);
+  }
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) ier));
+  resultobj = t_output_helper(resultobj,obj);
+  return resultobj;
+}
+
+/*
+ *  The gradients (nfld x n x 3) of the nfld fields of values f at
+ *  the points of the surface.
+ */
+PyObject *css_grads_p(PyObject *surf, PyObject *f, int nfld) {
+  nglCSSurface *css;
+  PyArrayObject *arr;
+  PyObject *obj;
+  npy_intp dims[1];
+
+  css = css_from_capsule(surf,"css_grads_p");
+  if (css == NULL) {
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  arr = (PyArrayObject *) PyArray_ContiguousFromAny(f,PyArray_DOUBLE,0,0);
+  if (arr == NULL || PyArray_SIZE(arr) != (npy_intp)nfld*css->n) {
+    PyErr_Clear();
+    Py_XDECREF(arr);
+    printf("css_grads_p: the fields must have %d values each\n",css->n);
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  dims[0] = (npy_intp)nfld*css->n*3;
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  Py_BEGIN_ALLOW_THREADS
+  c_cssgrads(css->surf,nfld,(double *)arr->data,
+             (double *)((PyArrayObject *)obj)->data);
+  Py_END_ALLOW_THREADS
+  Py_DECREF(arr);
+  return(obj);
+}
+
+/*
+ *  The nfld fields with values f and gradients g (from css_grads_p)
+ *  at the points (plat,plon), in degrees. None of the arrays are
+ *  kept, so they're converted here rather than by the sequence
+ *  typemaps.
+ */
+PyObject *css_eval_p(PyObject *surf, PyObject *f, PyObject *g, int nfld,
+                     PyObject *plat, PyObject *plon) {
+  nglCSSurface *css;
+  PyArrayObject *farr, *garr, *latarr, *lonarr;
+  PyObject *obj;
+  npy_intp dims[1];
+  int np;
+
+  css = css_from_capsule(surf,"css_eval_p");
+  if (css == NULL) {
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  farr   = (PyArrayObject *) PyArray_ContiguousFromAny(f,PyArray_DOUBLE,0,0);
+  garr   = (PyArrayObject *) PyArray_ContiguousFromAny(g,PyArray_DOUBLE,0,0);
+  latarr = (PyArrayObject *) PyArray_ContiguousFromAny(plat,PyArray_DOUBLE,0,0);
+  lonarr = (PyArrayObject *) PyArray_ContiguousFromAny(plon,PyArray_DOUBLE,0,0);
+  if (farr == NULL || garr == NULL || latarr == NULL || lonarr == NULL ||
+      PyArray_SIZE(farr) != (npy_intp)nfld*css->n ||
+      PyArray_SIZE(garr) != (npy_intp)nfld*css->n*3 ||
+      PyArray_SIZE(latarr) != PyArray_SIZE(lonarr)) {
+    PyErr_Clear();
+    Py_XDECREF(farr);
+    Py_XDECREF(garr);
+    Py_XDECREF(latarr);
+    Py_XDECREF(lonarr);
+    printf("css_eval_p: the values, gradients or output points are the wrong size\n");
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  np = (int) PyArray_SIZE(latarr);
+  dims[0] = (npy_intp)nfld*np;
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  Py_BEGIN_ALLOW_THREADS
+  c_csseval(css->surf,nfld,(double *)farr->data,(double *)garr->data,np,
+            (double *)latarr->data,(double *)lonarr->data,
+            (double *)((PyArrayObject *)obj)->data);
+  Py_END_ALLOW_THREADS
+  Py_DECREF(farr);
+  Py_DECREF(garr);
+  Py_DECREF(latarr);
+  Py_DECREF(lonarr);
+  return(obj);
+}
+
 PyObject *ftcurvc(int n, float *x, float *y, int m, float *xo)
 {
   float *yo;
@@ -3877,6 +4314,72 @@ PyObject *ftcurvpic(float xl, float xr, float p, int m, float *xi, float *yi)
   return resultobj;
 }
 
+/*
+ *  Splines through nrow curves of n points at once (c_ftcurv_n). x
+ *  holds n abscissae shared by all the curves, or n for each. Returns
+ *  the error code and the values at xo, followed by the derivatives
+ *  (for curves that aren't periodic) and the integrals from xo[0] if
+ *  full is set (None otherwise). fitgrid isn't reentrant, so the
+ *  interpreter lock is kept.
+ */
+PyObject *ftcurv_n_p(int nrow, int n, PyObject *x, PyObject *y,
+                     PyObject *xo, int periodic, double p, double sigma,
+                     int full) {
+  PyArrayObject *xarr, *yarr, *xoarr;
+  PyObject *yo, *dyo, *iyo, *resultobj;
+  npy_intp dims[1];
+  int ier, m, xinc;
+
+  xarr  = (PyArrayObject *) PyArray_ContiguousFromAny(x,PyArray_DOUBLE,0,0);
+  yarr  = (PyArrayObject *) PyArray_ContiguousFromAny(y,PyArray_DOUBLE,0,0);
+  xoarr = (PyArrayObject *) PyArray_ContiguousFromAny(xo,PyArray_DOUBLE,0,0);
+  if (xarr == NULL || yarr == NULL || xoarr == NULL ||
+      PyArray_SIZE(yarr) != (npy_intp)nrow*n ||
+      (PyArray_SIZE(xarr) != n && PyArray_SIZE(xarr) != (npy_intp)nrow*n)) {
+    PyErr_Clear();
+    Py_XDECREF(xarr);
+    Py_XDECREF(yarr);
+    Py_XDECREF(xoarr);
+    printf("ftcurv_n_p: the abscissae and values are the wrong size\n");
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  xinc = PyArray_SIZE(xarr) == n ? 0 : n;
+  m = (int) PyArray_SIZE(xoarr);
+  dims[0] = (npy_intp)nrow*m;
+  yo = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  if (full && !periodic) {
+    dyo = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  }
+  else {
+    Py_INCREF(Py_None);
+    dyo = Py_None;
+  }
+  if (full) {
+    iyo = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  }
+  else {
+    Py_INCREF(Py_None);
+    iyo = Py_None;
+  }
+  ier = c_ftcurv_n(nrow,n,xinc,(double *)xarr->data,(double *)yarr->data,
+                   m,(double *)xoarr->data,periodic,p,sigma,
+                   (double *)((PyArrayObject *)yo)->data,
+                   dyo != Py_None ? (double *)((PyArrayObject *)dyo)->data
+                                  : NULL,
+                   iyo != Py_None ? (double *)((PyArrayObject *)iyo)->data
+                                  : NULL);
+  Py_DECREF(xarr);
+  Py_DECREF(yarr);
+  Py_DECREF(xoarr);
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) ier));
+  resultobj = t_output_helper(resultobj,yo);
+  resultobj = t_output_helper(resultobj,dyo);
+  resultobj = t_output_helper(resultobj,iyo);
+  return resultobj;
+}
+
 
 void natgridc(int n, float *x, float *y, float *z, int nxi, int nyi,
              float *xi, float *yi, int *ier, int nxir, int nyir, float *aout[])
@@ -4006,15 +4509,13 @@ NhlErrorTypes NhlQNDCToData(int pid, float *x, float *y, int n,
     mxt = NULL;
   }
   else {
-    mxt = malloc(sizeof(float));
-    *mxt = xmissing;
+    mxt = &xmissing;
   }
   if (iymissing != 1) {
     myt = NULL;
   }
   else {
-    myt = malloc(sizeof(float));
-    *myt = ymissing;
+    myt = &ymissing;
   }
   return(NhlNDCToData(pid, x, y, n, xout, yout, mxt, myt,
                       status, out_of_range));
@@ -4029,17 +4530,15 @@ PyObject *NhlPNDCToData(int pid, float *x, float *y, int n, float xmissing,
   npy_intp dims[1];
   float out_of_range;
 
-  xout = (float *) malloc(n*sizeof(float));
-  yout = (float *) malloc(n*sizeof(float));
+  dims[0] = (npy_intp)n;
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  xout = (float *) ((PyArrayObject *)obj1)->data;
+  yout = (float *) ((PyArrayObject *)obj2)->data;
   rval = (int) NhlQNDCToData(pid, x, y, n, xout, yout, xmissing,
                              ymissing, ixmissing, iymissing,
                              &status, &out_of_range);
   nhlerr = (PyObject *) PyInt_FromLong((long) rval); 
-  dims[0] = (npy_intp)n;
-  obj1 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) xout);
-  obj2 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) yout);
   rstatus = (PyObject *) PyInt_FromLong((long) status); 
   range = (PyObject *) PyFloat_FromDouble((double) out_of_range); 
 
@@ -4063,15 +4562,13 @@ NhlErrorTypes NhlQDataToNDC(int pid, float *x, float *y, int n,
     mxt = NULL;
   }
   else {
-    mxt = malloc(sizeof(float));
-    *mxt = xmissing;
+    mxt = &xmissing;
   }
   if (iymissing != 1) {
     myt = NULL;
   }
   else {
-    myt = malloc(sizeof(float));
-    *myt = ymissing;
+    myt = &ymissing;
   }
   return(NhlDataToNDC(pid, x, y, n, xout, yout, mxt, myt,
                       status, out_of_range));
@@ -4086,17 +4583,15 @@ PyObject *NhlPDataToNDC(int pid, float *x, float *y, int n, float xmissing,
   npy_intp dims[1];
   float out_of_range;
 
-  xout = (float *) malloc(n*sizeof(float));
-  yout = (float *) malloc(n*sizeof(float));
+  dims[0] = (npy_intp)n;
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_FLOAT);
+  xout = (float *) ((PyArrayObject *)obj1)->data;
+  yout = (float *) ((PyArrayObject *)obj2)->data;
   rval = (int) NhlQDataToNDC(pid, x, y, n, xout, yout, xmissing,
                              ymissing, ixmissing, iymissing,
                              &status, &out_of_range);
   nhlerr = (PyObject *) PyInt_FromLong((long) rval); 
-  dims[0] = (npy_intp)n;
-  obj1 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) xout);
-  obj2 = (PyObject *) PyArray_SimpleNewFromData(1,dims,PyArray_FLOAT,
-                                                (char *) yout);
   rstatus = (PyObject *) PyInt_FromLong((long) status); 
   range = (PyObject *) PyFloat_FromDouble((double) out_of_range); 
 
@@ -4110,6 +4605,220 @@ PyObject *NhlPDataToNDC(int pid, float *x, float *y, int n, float xmissing,
   return resultobj;
 }
 
+/*
+ *  Converts the points (x,y) between data and NDC space for plot pid
+ *  (data to NDC, or NDC to data if todata is set), into the arrays
+ *  xout and yout given by the caller. These must be contiguous
+ *  float32 or float64 arrays with as many elements as x and y, of any
+ *  shape. The HLU transformations are done in float, through small
+ *  buffers, unless everything is float32 already. Returns the HLU
+ *  error, the status (1 if any points were out of range) and the
+ *  out of range value.
+ */
+#define NGL_TRANS_CHUNK 512
+
+static int trans_out_ok(PyObject *obj, npy_intp n) {
+  PyArrayObject *arr = (PyArrayObject *) obj;
+
+  return(PyArray_Check(obj) && PyArray_ISCARRAY(arr) &&
+         PyArray_SIZE(arr) == n &&
+         (arr->descr->type_num == PyArray_FLOAT ||
+          arr->descr->type_num == PyArray_DOUBLE));
+}
+
+static int trans_is_float(PyObject *obj) {
+  return(PyArray_Check(obj) && PyArray_ISCARRAY((PyArrayObject *) obj) &&
+         ((PyArrayObject *) obj)->descr->type_num == PyArray_FLOAT);
+}
+
+PyObject *ndc_transform_p(int pid, int todata, PyObject *x, PyObject *y,
+                          PyObject *xout, PyObject *yout, double xmissing,
+                          double ymissing, int ixmissing, int iymissing)
+{
+  PyArrayObject *xarr, *yarr, *xoarr, *yoarr;
+  PyObject *resultobj;
+  NhlErrorTypes rval, err = NhlNOERROR;
+  float xb[NGL_TRANS_CHUNK], yb[NGL_TRANS_CHUNK];
+  float xo[NGL_TRANS_CHUNK], yo[NGL_TRANS_CHUNK];
+  float mx = (float) xmissing, my = (float) ymissing, oor = 0.;
+  float *mxt, *myt;
+  double *xd, *yd;
+  npy_intp n, i, k, off;
+  int status, anystatus = 0;
+
+  mxt = ixmissing == 1 ? &mx : NULL;
+  myt = iymissing == 1 ? &my : NULL;
+  xoarr = (PyArrayObject *) xout;
+  yoarr = (PyArrayObject *) yout;
+  if (trans_is_float(x) && trans_is_float(y) &&
+      trans_is_float(xout) && trans_is_float(yout) &&
+      PyArray_SIZE((PyArrayObject *) x) == PyArray_SIZE(xoarr) &&
+      PyArray_SIZE((PyArrayObject *) y) == PyArray_SIZE(yoarr) &&
+      PyArray_SIZE(xoarr) == PyArray_SIZE(yoarr)) {
+    n = PyArray_SIZE(xoarr);
+    if (todata) {
+      err = NhlNDCToData(pid,(float *)((PyArrayObject *)x)->data,
+                         (float *)((PyArrayObject *)y)->data,(int) n,
+                         (float *)xoarr->data,(float *)yoarr->data,
+                         mxt,myt,&anystatus,&oor);
+    }
+    else {
+      err = NhlDataToNDC(pid,(float *)((PyArrayObject *)x)->data,
+                         (float *)((PyArrayObject *)y)->data,(int) n,
+                         (float *)xoarr->data,(float *)yoarr->data,
+                         mxt,myt,&anystatus,&oor);
+    }
+  }
+  else {
+    xarr = (PyArrayObject *) PyArray_ContiguousFromAny(x,PyArray_DOUBLE,0,0);
+    yarr = (PyArrayObject *) PyArray_ContiguousFromAny(y,PyArray_DOUBLE,0,0);
+    if (xarr == NULL || yarr == NULL ||
+        PyArray_SIZE(xarr) != PyArray_SIZE(yarr) ||
+        !trans_out_ok(xout,PyArray_SIZE(xarr)) ||
+        !trans_out_ok(yout,PyArray_SIZE(xarr))) {
+      PyErr_Clear();
+      Py_XDECREF(xarr);
+      Py_XDECREF(yarr);
+      printf("ndc_transform_p: the output arrays must be contiguous float32 or float64\n  arrays with as many elements as the input\n");
+      Py_INCREF(Py_None);
+      return(Py_None);
+    }
+    n  = PyArray_SIZE(xarr);
+    xd = (double *) xarr->data;
+    yd = (double *) yarr->data;
+    for (off = 0; off < n; off += NGL_TRANS_CHUNK) {
+      k = min(n - off,NGL_TRANS_CHUNK);
+      for (i = 0; i < k; i++) {
+        xb[i] = (float) xd[off+i];
+        yb[i] = (float) yd[off+i];
+      }
+      if (todata) {
+        rval = NhlNDCToData(pid,xb,yb,(int) k,xo,yo,mxt,myt,&status,&oor);
+      }
+      else {
+        rval = NhlDataToNDC(pid,xb,yb,(int) k,xo,yo,mxt,myt,&status,&oor);
+      }
+      if (rval < err) err = rval;
+      if (status) anystatus = 1;
+      if (xoarr->descr->type_num == PyArray_FLOAT) {
+        memcpy(&((float *)xoarr->data)[off],xo,k*sizeof(float));
+      }
+      else {
+        for (i = 0; i < k; i++) ((double *)xoarr->data)[off+i] = xo[i];
+      }
+      if (yoarr->descr->type_num == PyArray_FLOAT) {
+        memcpy(&((float *)yoarr->data)[off],yo,k*sizeof(float));
+      }
+      else {
+        for (i = 0; i < k; i++) ((double *)yoarr->data)[off+i] = yo[i];
+      }
+    }
+    Py_DECREF(xarr);
+    Py_DECREF(yarr);
+  }
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) err));
+  resultobj = t_output_helper(resultobj,PyInt_FromLong((long) anystatus));
+  resultobj = t_output_helper(resultobj,PyFloat_FromDouble((double) oor));
+  return resultobj;
+}
+
+/*
+ *  Reads the numbers (of type 0 = int, 1 = float, 2 = double) in an
+ *  ASCII file, separated by white space or the character sep, into a
+ *  new array, for asciiread. size is the number of values wanted, or
+ *  -1 for all of them. The file is mapped into memory rather than
+ *  read, and with nthreads other than 1 (0 for the OpenMP default)
+ *  it's split into chunks that are read in parallel. Returns 0, the
+ *  array, and the number of values found; if the file can't be
+ *  opened, IOError is raised, as open() would.
+ */
+PyObject *asciiread_p(char *filename, char *sep, int type, PyObject *size,
+                      int nthreads)
+{
+  PyObject *arr = NULL, *resultobj;
+  struct stat st;
+  char *buf = NULL;
+  size_t len = 0, got;
+  ssize_t nr;
+  long nmax, total = 0, nread, *counts = NULL;
+  int fd, err, nchunk = 1, mapped = 0;
+  npy_intp dims[1];
+
+  nmax = PyInt_AsLong(size);
+  fd = open(filename,O_RDONLY);
+  if (fd < 0 || fstat(fd,&st) != 0) {
+    err = errno;
+    if (fd >= 0) close(fd);
+    errno = err;
+    return PyErr_SetFromErrnoWithFilename(PyExc_IOError,filename);
+  }
+  len = (size_t) st.st_size;
+  if (len > 0) {
+    buf = (char *) mmap(NULL,len,PROT_READ,MAP_PRIVATE,fd,0);
+    if (buf == (char *) MAP_FAILED) {
+/*
+ *  Files that can't be mapped (pipes, some network file systems) are
+ *  read into memory instead.
+ */
+      buf = (char *) malloc(len);
+      if (buf == NULL) {
+        close(fd);
+        return PyErr_NoMemory();
+      }
+      for (got = 0; got < len; got += (size_t) nr) {
+        nr = read(fd,buf+got,len-got);
+        if (nr <= 0) break;
+      }
+      len = got;
+    }
+    else {
+      mapped = 1;
+    }
+  }
+  close(fd);
+
+#ifdef _OPENMP
+  nchunk = nthreads > 0 ? nthreads : omp_get_max_threads();
+#endif
+  if ((size_t) nchunk > len/(1 << 20) + 1) nchunk = (int) (len/(1 << 20)) + 1;
+  if (mapped && nchunk == 1) madvise(buf,len,MADV_SEQUENTIAL);
+
+  if (nmax < 0 || nchunk > 1) {
+    counts = (long *) malloc(nchunk*sizeof(long));
+    if (counts == NULL) {
+      PyErr_NoMemory();
+      goto done;
+    }
+    Py_BEGIN_ALLOW_THREADS
+    total = c_asciicount(buf,len,sep[0],type,nchunk,counts);
+    Py_END_ALLOW_THREADS
+  }
+  dims[0] = (npy_intp) (nmax < 0 ? total : nmax);
+  arr = (PyObject *) PyArray_ZEROS(1,dims,type == 0 ? PyArray_INT :
+                     (type == 1 ? PyArray_FLOAT : PyArray_DOUBLE),0);
+  if (arr == NULL) goto done;
+  Py_BEGIN_ALLOW_THREADS
+  nread = c_asciiparse(buf,len,sep[0],type,nchunk,counts,(long) dims[0],
+                       ((PyArrayObject *)arr)->data);
+  Py_END_ALLOW_THREADS
+
+done:
+  free(counts);
+  if (mapped) {
+    munmap(buf,len);
+  }
+  else {
+    free(buf);
+  }
+  if (arr == NULL) return NULL;
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,PyInt_FromLong(0L));
+  resultobj = t_output_helper(resultobj,arr);
+  resultobj = t_output_helper(resultobj,PyInt_FromLong(nread));
+  return resultobj;
+}
+
 PyObject *NhlGetMDFloatArray(int pid, char *name) {
   PyObject *obj1, *nhlerr, *resultobj;
   int i, num_dims, grlist;
@@ -4197,48 +4906,587 @@ PyObject *NhlGetMDIntegerArray(int pid, char *name) {
   return resultobj;
 }
 
-float *d2f(int isize, double *darray) {
-  float *farray;
-  int i;
-  farray = (float *) malloc(isize*sizeof(float));
-  for (i = 0; i < isize; i++) {
-    farray[i] = (float) darray[i];
-  }
-  return (farray);
+PyObject *panel_layout_p() {
+  PyObject *resultobj;
+  float *layout;
+  double *dptr;
+  int i, nrows;
+  npy_intp dims[2];
+
+  nrows   = get_panel_layout(&layout);
+  dims[0] = (npy_intp)nrows;
+  dims[1] = 4;
+  resultobj = (PyObject *) PyArray_SimpleNew(2,dims,PyArray_DOUBLE);
+  dptr = (double *)((PyArrayObject *)resultobj)->data;
+  for(i = 0; i < 4*nrows; i++) dptr[i] = (double)layout[i];
+  return resultobj;
 }
 
-void gendat (int idim, int m, int n, int mlow, int mhgh, 
-             float dlow, float dhgh, float *data)
-{
-/*
- * This is a routine to generate test data for two-dimensional graphics
- * routines.  Given an array "DATA", dimensioned "IDIM x 1", it fills
- * the sub-array ((DATA(I,J),I=1,M),J=1,N) with a two-dimensional field
- * of data having approximately "MLOW" lows and "MHGH" highs, a minimum
- * value of exactly "DLOW" and a maximum value of exactly "DHGH".
- *
- * "MLOW" and "MHGH" are each forced to be greater than or equal to 1
- * and less than or equal to 25.
- *
- * The function used is a sum of exponentials.
- */
-    float ccnt[3][50], fovm, fovn, dmin, dmax, temp;
-    extern float fran();
-    int nlow, nhgh, ncnt, i, j, k, ii;
+PyObject *region_cull_p(double *lat, double *lon, int ncells, int nvert,
+                        double minlat, double maxlat, double minlon,
+                        double maxlon, double halo) {
+  PyObject *resultobj;
+  int *indices, nkeep;
+  npy_intp dims[1];
 
-    fovm=9./(float)m;
-    fovn=9./(float)n;
+  indices = (int *)malloc((ncells > 0 ? ncells : 1)*sizeof(int));
+  nkeep   = region_cull(lat,lon,ncells,nvert,minlat,maxlat,minlon,maxlon,
+                        halo,indices);
+  dims[0] = (npy_intp)nkeep;
+  resultobj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_INT);
+  memcpy(((PyArrayObject *)resultobj)->data,indices,nkeep*sizeof(int));
+  free(indices);
+  return resultobj;
+}
 
-    nlow=max(1,min(25,mlow));
-    nhgh=max(1,min(25,mhgh));
-    ncnt=nlow+nhgh;
+PyObject *decimate_xy_p(double *x, double *y, int n, double xmin, 
+                        double xmax, int ncols, int xlog, int is_missing_x,
+                        double xmsg, int is_missing_y, double ymsg) {
+  PyObject *obj1, *obj2, *resultobj;
+  double *xout, *yout;
+  int nout;
+  npy_intp dims[1];
 
-    for( k=1; k <= ncnt; k++ ) {
-        ccnt[0][k-1]=1.+((float)m-1.)*fran();
-        ccnt[1][k-1]=1.+((float)n-1.)*fran();
-        if (k <= nlow) {
-            ccnt[2][k-1]= -1.;
-        }
+  xout = (double *)malloc((n > 0 ? n : 1)*sizeof(double));
+  yout = (double *)malloc((n > 0 ? n : 1)*sizeof(double));
+  nout = decimate_xy(x,y,n,xmin,xmax,ncols,xlog,is_missing_x,xmsg,
+                     is_missing_y,ymsg,xout,yout);
+
+  dims[0] = (npy_intp)nout;
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  memcpy(((PyArrayObject *)obj1)->data,xout,nout*sizeof(double));
+  memcpy(((PyArrayObject *)obj2)->data,yout,nout*sizeof(double));
+  free(xout);
+  free(yout);
+
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,obj1);
+  resultobj = t_output_helper(resultobj,obj2);
+  return resultobj;
+}
+
+PyObject *histogram2d_p(double *x, double *y, int n, int nx, int ny, 
+                        double xmin, double xmax, double ymin, double ymax,
+                        int is_missing_x, double xmsg, int is_missing_y, 
+                        double ymsg) {
+  PyObject *obj;
+  npy_intp dims[2];
+
+  dims[0] = (npy_intp)(ny > 0 ? ny : 0);
+  dims[1] = (npy_intp)(nx > 0 ? nx : 0);
+  obj = (PyObject *) PyArray_SimpleNew(2,dims,PyArray_DOUBLE);
+  histogram2d(x,y,n,(int)dims[1],(int)dims[0],xmin,xmax,ymin,ymax,
+              is_missing_x,xmsg,is_missing_y,ymsg,
+              (double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+PyObject *gc_dist_p(double *lat1, double *lon1, double *lat2, double *lon2,
+                    int n, int iu) {
+  PyObject *obj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  c_dgcdist_n(lat1,lon1,lat2,lon2,n,iu,
+              (double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+PyObject *gc_azim_p(double *lat1, double *lon1, double *lat2, double *lon2,
+                    int n) {
+  PyObject *obj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  c_dgcazim_n(lat1,lon1,lat2,lon2,n,(double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+PyObject *gc_dest_p(double *lat, double *lon, double *dist, double *azim,
+                    int n, int iu) {
+  PyObject *obj1, *obj2, *resultobj;
+  npy_intp dims[1];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  obj1 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  obj2 = (PyObject *) PyArray_SimpleNew(1,dims,PyArray_DOUBLE);
+  c_dgcdest_n(lat,lon,dist,azim,n,iu,(double *)((PyArrayObject *)obj1)->data,
+              (double *)((PyArrayObject *)obj2)->data);
+
+  resultobj = Py_None;
+  resultobj = t_output_helper(resultobj,obj1);
+  resultobj = t_output_helper(resultobj,obj2);
+  return resultobj;
+}
+
+PyObject *gc_dist_pairs_p(double *lat1, double *lon1, int n, double *lat2,
+                          double *lon2, int m, int iu) {
+  PyObject *obj;
+  npy_intp dims[2];
+
+  dims[0] = (npy_intp)(n > 0 ? n : 0);
+  dims[1] = (npy_intp)(m > 0 ? m : 0);
+  obj = (PyObject *) PyArray_SimpleNew(2,dims,PyArray_DOUBLE);
+  c_dgcdist_pairs(lat1,lon1,(int)dims[0],lat2,lon2,(int)dims[1],iu,
+                  (double *)((PyArrayObject *)obj)->data);
+  return obj;
+}
+
+/*
+ *  Draws station models from the concatenated 50-character station
+ *  strings in imdat. c_wmstnms changes the strings, so it is given
+ *  a copy, which is returned with the wind directions as drawn.
+ */
+PyObject *wmstnms_p(int wksid, double *x, double *y, int n, PyObject *imdat,
+                    double thin) {
+  PyObject *obj;
+  char *buf;
+
+  if (n <= 0 || !PyBytes_Check(imdat) ||
+      PyBytes_Size(imdat) < 50*(Py_ssize_t)n) {
+    printf("wmstnms_p: station data must be %d 50-character strings\n",n);
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+  buf = (char *) malloc(50*n);
+  memcpy(buf,PyBytes_AsString(imdat),50*n);
+  c_wmstnms(wksid,x,y,n,buf,thin);
+  obj = PyBytes_FromStringAndSize(buf,50*(Py_ssize_t)n);
+  free(buf);
+  return obj;
+}
+
+PyObject *png_to_rgba_p(PyObject *png) {
+  PyArrayObject *arr;
+  PyObject *obj;
+  unsigned char *rgba;
+  int width, height;
+  npy_intp dims[3];
+
+  arr = (PyArrayObject *) PyArray_ContiguousFromAny(png,PyArray_UBYTE,1,1);
+  if (arr == NULL) return NULL;
+  rgba = png_to_rgba((unsigned char *)arr->data,(int)arr->dimensions[0],
+                     &width,&height);
+  Py_DECREF(arr);
+  if (rgba == NULL) {
+    Py_INCREF(Py_None);
+    return Py_None;
+  }
+
+  dims[0] = (npy_intp)height;
+  dims[1] = (npy_intp)width;
+  dims[2] = 4;
+  obj = (PyObject *) PyArray_SimpleNew(3,dims,PyArray_UBYTE);
+  memcpy(((PyArrayObject *)obj)->data,rgba,(long)width*height*4);
+  free(rgba);
+  return obj;
+}
+
+/*
+ *  Returns the timing statistics kept by the gsun code as a dictionary
+ *  of stage name: (count, seconds, bytes), and the trace events as a
+ *  list of (stage name, start, duration) tuples, in seconds.
+ */
+PyObject *get_stats_p() {
+  PyObject *dict, *item;
+  const char *name;
+  long count;
+  double seconds, bytes;
+  int i;
+
+  dict = PyDict_New();
+  for (i = 0; i < get_nstats(); i++) {
+    name = get_stat(i,&count,&seconds,&bytes);
+    item = Py_BuildValue("(ldd)",count,seconds,bytes);
+    PyDict_SetItemString(dict,name,item);
+    Py_DECREF(item);
+  }
+  return dict;
+}
+
+PyObject *get_trace_p() {
+  PyObject *list;
+  const char *name;
+  double start, duration;
+  int i, n;
+
+  n = get_ntrace_events();
+  list = PyList_New(n);
+  for (i = 0; i < n; i++) {
+    name = get_trace_event(i,&start,&duration);
+    PyList_SET_ITEM(list,i,Py_BuildValue("(sdd)",name,start,duration));
+  }
+  return list;
+}
+
+/*
+ *  Memory that a resource list refers to. The NhlRLSet* functions
+ *  don't copy the values they are given, so the arrays and strings
+ *  created while converting a dictionary have to be kept until the
+ *  resource list has been used, and are freed after that.
+ */
+typedef struct _nglRLTemps {
+  int       nptrs, maxptrs;
+  void      **ptrs;
+  int       nobjs, maxobjs;
+  PyObject  **objs;
+} nglRLTemps;
+
+static void *rl_keep(nglRLTemps *temps, void *ptr) {
+  if (temps->nptrs == temps->maxptrs) {
+    temps->maxptrs = temps->maxptrs ? 2*temps->maxptrs : 16;
+    temps->ptrs = (void **) realloc(temps->ptrs,
+                                    temps->maxptrs*sizeof(void *));
+  }
+  temps->ptrs[temps->nptrs++] = ptr;
+  return(ptr);
+}
+
+static PyObject *rl_keep_obj(nglRLTemps *temps, PyObject *obj) {
+  if (temps->nobjs == temps->maxobjs) {
+    temps->maxobjs = temps->maxobjs ? 2*temps->maxobjs : 8;
+    temps->objs = (PyObject **) realloc(temps->objs,
+                                        temps->maxobjs*sizeof(PyObject *));
+  }
+  temps->objs[temps->nobjs++] = obj;
+  return(obj);
+}
+
+/*
+ *  Destroys a resource list created by dict_to_rlist and frees
+ *  everything it refers to. Lists that weren't created here (their
+ *  temps field is NULL) are left alone.
+ */
+static void free_resinfo(ResInfo *info) {
+  int i;
+  nglRLTemps *temps;
+
+  if (info == NULL || info->temps == NULL) return;
+  temps = (nglRLTemps *) info->temps;
+
+  NhlRLDestroy(info->id);
+  for (i = 0; i < temps->nptrs; i++) free(temps->ptrs[i]);
+  for (i = 0; i < temps->nobjs; i++) Py_XDECREF(temps->objs[i]);
+  free(temps->ptrs);
+  free(temps->objs);
+  free(temps);
+  if (info->strings != NULL) {
+    for (i = 0; i < info->nstrings; i++) free(info->strings[i]);
+    free(info->strings);
+  }
+  info->temps   = NULL;
+  info->strings = NULL;
+}
+
+/*
+ *  Sets the items of a tuple or list value in the resource list.
+ *  The items must be all strings, or all ints and floats; a float
+ *  anywhere makes it an array of doubles.
+ */
+static int rl_set_sequence(int rlist, char *name, PyObject *value,
+                           nglRLTemps *temps) {
+  int i, list_type, is_tuple;
+  ng_size_t list_len;
+  PyObject *item;
+  char **strings;
+  double *dvals;
+  int *ivals;
+
+  is_tuple = PyTuple_Check(value);
+  list_len = is_tuple ? (ng_size_t)PyTuple_Size(value) :
+                        (ng_size_t)PyList_Size(value);
+  item = is_tuple ? PyTuple_GetItem(value,0) : PyList_GetItem(value,0);
+  if (item == NULL) {
+    PyErr_Clear();
+    printf("The %s value for resource %s is empty.\n",
+           is_tuple ? "tuple" : "list", name);
+    return(0);
+  }
+  if (PyList_Check(item) || PyTuple_Check(item)) {
+    if (is_tuple) {
+      printf("Tuple values are not allowed to have list or tuple items.\n");
+    }
+    else {
+      printf("Use NumPy arrays for multiple dimension arrays.\n");
+    }
+    return(0);
+  }
+/*
+ *    list_type = 2 (int)
+ *              = 0 (string)
+ *              = 1 (float)
+ */
+  list_type = is_string_type(item) ? 0 : 2;
+  for (i = 0; i < list_len ; i++) {
+    item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+    if (list_type == 0) {
+      if (!is_string_type(item)) {
+        printf("All items in the %s value for resource %s must be strings\n",
+               is_tuple ? "tuple" : "list", name);
+        return(0);
+      }
+    }
+    else if (PyFloat_Check(item)) {
+      list_type = 1;
+    }
+    else if (!PyInt_Check(item)) {
+      printf("All items in the %s value for resource %s must be ints or floats.\n",
+             is_tuple ? "tuple" : "list", name);
+      return(0);
+    }
+  }
+
+  switch (list_type) {
+    case 0:
+      strings = (char **) rl_keep(temps,malloc(list_len*sizeof(char *)));
+      for (i = 0; i < list_len ; i++) {
+        item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+        strings[i] = (char *) rl_keep(temps,(void *) as_utf8_char(item));
+      }
+      NhlRLSetStringArray(rlist,name,strings,list_len);
+      break;
+    case 1:
+      dvals = (double *) rl_keep(temps,malloc(list_len*sizeof(double)));
+      for (i = 0; i < list_len ; i++) {
+        item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+        dvals[i] = PyFloat_AsDouble(item);
+      }
+      NhlRLSetDoubleArray(rlist,name,dvals,list_len);
+      break;
+    case 2:
+      ivals = (int *) rl_keep(temps,malloc(list_len*sizeof(int)));
+      for (i = 0; i < list_len ; i++) {
+        item = is_tuple ? PyTuple_GetItem(value,i) : PyList_GetItem(value,i);
+        ivals[i] = (int) PyInt_AsLong(item);
+      }
+      NhlRLSetIntegerArray(rlist,name,ivals,list_len);
+      break;
+  }
+  return(1);
+}
+
+/*
+ *  Converts a dictionary of resources to a new HLU resource list,
+ *  filling in info. If copy is set, array values are copied rather
+ *  than referenced, so that the list doesn't change if the arrays
+ *  do. Returns 0 (after printing a message) if a value can't be
+ *  converted, or with a TypeError set if dict isn't a dictionary.
+ *  Use free_resinfo to release the list.
+ */
+static int dict_to_rlist(PyObject *dict, ResInfo *info, int copy) {
+  int i, count, array_type, ndims, rlist;
+  Py_ssize_t pos = 0;
+  PyObject *key, *value;
+  PyArrayObject *arr, *tarr;
+  ng_size_t *len_dims;
+  nglRLTemps *temps;
+  char *name, *svalue;
+  double t0, nbytes = 0.;
+
+  t0 = stats_begin();
+  rlist = NhlRLCreate(NhlSETRL);
+  NhlRLClear(rlist);
+  temps = (nglRLTemps *) calloc(1,sizeof(nglRLTemps));
+
+  info->id       = rlist;
+  info->nstrings = 0;
+  info->strings  = NULL;
+  info->temps    = (void *) temps;
+
+  if (!PyDict_Check(dict)) {
+    PyErr_SetString(PyExc_TypeError,"Resource lists must be dictionaries");
+    free_resinfo(info);
+    stats_end("rlist",t0,nbytes);
+    return(0);
+  }
+
+  info->nstrings = PyDict_Size(dict);
+  info->strings  = (char **) calloc(info->nstrings ? info->nstrings : 1,
+                                    sizeof(char *));
+  count = 0;
+/*
+ *  Loop over the keyword/value pairs in the dictionary.
+ *  The values must be one of: tuple, int, float, long,
+ *  list, string, or array.
+ */
+  while (PyDict_Next(dict, &pos, &key, &value)) {
+    name = (char *) as_utf8_char(key);
+    info->strings[count++] = name;
+
+    if (PyTuple_Check(value) || PyList_Check(value)) {
+      if (!rl_set_sequence(rlist,name,value,temps)) {
+        free_resinfo(info);
+        stats_end("rlist",t0,nbytes);
+        return(0);
+      }
+    }
+/*
+ *  Python and NumPy scalars.
+ */
+    else if (PyArray_IsAnyScalar(value)) {
+      if (PyInt_Check(value) || PyLong_Check(value) ||
+          PyArray_IsScalar(value,Int) || PyArray_IsScalar(value,Long)) {
+        NhlRLSetInteger(rlist,name,(int) PyInt_AsLong(value));
+      }
+      else if (PyFloat_Check(value) || PyArray_IsScalar(value,Float)) {
+        NhlRLSetDouble(rlist,name,PyFloat_AsDouble(value));
+      }
+      else if (is_string_type(value) || PyArray_IsScalar(value,String)) {
+        svalue = (char *) rl_keep(temps,(void *) as_utf8_char(value));
+        NhlRLSetString(rlist,name,svalue);
+      }
+    }
+/*
+ *  value is an array.
+ */
+    else if (PyArray_Check(value)) {
+      array_type = (int) ((PyArrayObject *)value)->descr->type_num;
+      if (array_type == PyArray_LONG || array_type == PyArray_INT) {
+        array_type = PyArray_LONG;
+      }
+      else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
+        array_type = PyArray_DOUBLE;
+      }
+      else {
+        printf(
+          "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
+        free_resinfo(info);
+        stats_end("rlist",t0,nbytes);
+        return(0);
+      }
+      arr = (PyArrayObject *) PyArray_ContiguousFromAny(value,array_type,0,0);
+      if (copy && arr != NULL) {
+        tarr = (PyArrayObject *) PyArray_Copy(arr);
+        Py_DECREF(arr);
+        arr = tarr;
+      }
+      if (arr == NULL) {
+        PyErr_Clear();
+        printf("  value for keyword %s could not be converted.\n",name);
+        free_resinfo(info);
+        stats_end("rlist",t0,nbytes);
+        return(0);
+      }
+      rl_keep_obj(temps,(PyObject *) arr);
+      nbytes += (double) PyArray_NBYTES(arr);
+      ndims = arr->nd;
+      len_dims = (ng_size_t *) rl_keep(temps,
+                              malloc((ndims ? ndims : 1)*sizeof(ng_size_t)));
+      for(i = 0; i < ndims; i++ ) {
+        len_dims[i] = (ng_size_t)arr->dimensions[i];
+      }
+      if (array_type == PyArray_LONG) {
+        NhlRLSetMDLongArray(rlist,name,(long *)arr->data,ndims,len_dims);
+      }
+      else {
+        NhlRLSetMDDoubleArray(rlist,name,(double *)arr->data,ndims,len_dims);
+      }
+    }
+    else {
+      printf("  value for keyword %s is invalid.\n",name);
+      free_resinfo(info);
+      stats_end("rlist",t0,nbytes);
+      return(0);
+    }
+  }
+  stats_end("rlist",t0,nbytes);
+  return(1);
+}
+
+/*
+ *  A resource list that was converted once, with compile_rlist_p,
+ *  so that it can be applied over and over without going through
+ *  the dictionary again.
+ */
+#define NGL_RLIST_CAPSULE "ngl.ResourceList"
+
+static void free_compiled_rlist(PyObject *capsule) {
+  ResInfo *info;
+
+  info = (ResInfo *) PyCapsule_GetPointer(capsule,NGL_RLIST_CAPSULE);
+  if (info != NULL) {
+    free_resinfo(info);
+    free(info);
+  }
+}
+
+PyObject *compile_rlist_p(PyObject *dict) {
+  ResInfo *info;
+
+  info = (ResInfo *) malloc(sizeof(ResInfo));
+  if (!dict_to_rlist(dict,info,1)) {
+    free(info);
+    if (PyErr_Occurred()) return(NULL);
+    Py_INCREF(Py_None);
+    return(Py_None);
+  }
+  return(PyCapsule_New((void *) info,NGL_RLIST_CAPSULE,free_compiled_rlist));
+}
+
+/*
+ *  Fills in info from either a dictionary or a compiled resource
+ *  list. A compiled list is shared, so its temps field is cleared
+ *  to keep free_resinfo from destroying it.
+ */
+static int rlist_from_object(PyObject *obj, ResInfo *info) {
+  ResInfo *compiled;
+
+  if (PyCapsule_IsValid(obj,NGL_RLIST_CAPSULE)) {
+    compiled = (ResInfo *) PyCapsule_GetPointer(obj,NGL_RLIST_CAPSULE);
+    info->id       = compiled->id;
+    info->nstrings = compiled->nstrings;
+    info->strings  = compiled->strings;
+    info->temps    = NULL;
+    return(1);
+  }
+  return(dict_to_rlist(obj,info,0));
+}
+
+float *d2f(int isize, double *darray) {
+  float *farray;
+  int i;
+  farray = (float *) malloc(isize*sizeof(float));
+  for (i = 0; i < isize; i++) {
+    farray[i] = (float) darray[i];
+  }
+  return (farray);
+}
+
+void gendat (int idim, int m, int n, int mlow, int mhgh, 
+             float dlow, float dhgh, float *data)
+{
+/*
+ * This is a routine to generate test data for two-dimensional graphics
+ * routines.  Given an array "DATA", dimensioned "IDIM x 1", it fills
+ * the sub-array ((DATA(I,J),I=1,M),J=1,N) with a two-dimensional field
+ * of data having approximately "MLOW" lows and "MHGH" highs, a minimum
+ * value of exactly "DLOW" and a maximum value of exactly "DHGH".
+ *
+ * "MLOW" and "MHGH" are each forced to be greater than or equal to 1
+ * and less than or equal to 25.
+ *
+ * The function used is a sum of exponentials.
+ */
+    float ccnt[3][50], fovm, fovn, dmin, dmax, temp;
+    extern float fran();
+    int nlow, nhgh, ncnt, i, j, k, ii;
+
+    fovm=9./(float)m;
+    fovn=9./(float)n;
+
+    nlow=max(1,min(25,mlow));
+    nhgh=max(1,min(25,mhgh));
+    ncnt=nlow+nhgh;
+
+    for( k=1; k <= ncnt; k++ ) {
+        ccnt[0][k-1]=1.+((float)m-1.)*fran();
+        ccnt[1][k-1]=1.+((float)n-1.)*fran();
+        if (k <= nlow) {
+            ccnt[2][k-1]= -1.;
+        }
         else {
             ccnt[2][k-1] = 1.;
         }
@@ -5238,6 +6486,7 @@ SWIGINTERN PyObject *_wrap_NhlSetValues(PyObject *SWIGUNUSEDPARM(self), PyObject
   PyObject *resultobj = 0;
   int arg1 ;
   int arg2 ;
+  ResInfo trname2 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   NhlErrorTypes result;
@@ -5247,285 +6496,18 @@ SWIGINTERN PyObject *_wrap_NhlSetValues(PyObject *SWIGUNUSEDPARM(self), PyObject
     arg1 = (int) PyInt_AsLong (obj0);
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj1)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj1);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj1, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is an int.
-         */
-        else if (PyInt_Check(value)) {
-          NhlRLSetInteger(rlist,as_utf8_char(key),(int) PyInt_AsLong(value));
-        }
-        /*
-         *  value is a float.
-         */
-        else if (PyFloat_Check(value)) {
-          NhlRLSetDouble(rlist,as_utf8_char(key),PyFloat_AsDouble(value));
-        }
-        /*
-         *  value is a long.
-         */
-        else if (PyLong_Check(value)) {
-          NhlRLSetInteger(rlist,as_utf8_char(key),(int) PyInt_AsLong(value));
-        }
-        /*
-         *  value is a string
-         */
-        else if (is_string_type(value)) {
-          NhlRLSetString(rlist,as_utf8_char(key),as_utf8_char(value));
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!rlist_from_object(obj1,&trname2)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
-    arg2 = rlist;
+    arg2 = trname2.id;
   }
   result = (NhlErrorTypes)NhlSetValues(arg1,arg2);
   {
     resultobj = PyInt_FromLong ((long) result);
   }
+  {
+    free_resinfo(&trname2);
+  }
   return resultobj;
 fail:
   return NULL;
@@ -7027,6 +8009,7 @@ SWIGINTERN PyObject *_wrap_NhlGetValues(PyObject *SWIGUNUSEDPARM(self), PyObject
   PyObject *resultobj = 0;
   int arg1 ;
   int arg2 ;
+  ResInfo trname2 ;
   PyObject * obj0 = 0 ;
   PyObject * obj1 = 0 ;
   NhlErrorTypes result;
@@ -7036,285 +8019,18 @@ SWIGINTERN PyObject *_wrap_NhlGetValues(PyObject *SWIGUNUSEDPARM(self), PyObject
     arg1 = (int) PyInt_AsLong (obj0);
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj1)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj1);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj1, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is an int.
-         */
-        else if (PyInt_Check(value)) {
-          NhlRLSetInteger(rlist,as_utf8_char(key),(int) PyInt_AsLong(value));
-        }
-        /*
-         *  value is a float.
-         */
-        else if (PyFloat_Check(value)) {
-          NhlRLSetDouble(rlist,as_utf8_char(key),PyFloat_AsDouble(value));
-        }
-        /*
-         *  value is a long.
-         */
-        else if (PyLong_Check(value)) {
-          NhlRLSetInteger(rlist,as_utf8_char(key),(int) PyInt_AsLong(value));
-        }
-        /*
-         *  value is a string
-         */
-        else if (is_string_type(value)) {
-          NhlRLSetString(rlist,as_utf8_char(key),as_utf8_char(value));
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!rlist_from_object(obj1,&trname2)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
-    arg2 = rlist;
+    arg2 = trname2.id;
   }
   result = (NhlErrorTypes)NhlGetValues(arg1,arg2);
   {
     resultobj = PyInt_FromLong ((long) result);
   }
+  {
+    free_resinfo(&trname2);
+  }
   return resultobj;
 fail:
   return NULL;
@@ -9001,649 +9717,27 @@ SWIGINTERN PyObject *_wrap_open_wks_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   }
   arg2 = (char *)(buf2);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj2)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj2);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj2, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj2,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg3 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj3)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj3);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj3, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj3,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg4 = (ResInfo *) &trname;
   }
   {
@@ -9653,10 +9747,22 @@ SWIGINTERN PyObject *_wrap_open_wks_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   resultobj = SWIG_From_int((int)(result));
   if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
+  {
+    free_resinfo(arg3);
+  }
+  {
+    free_resinfo(arg4);
+  }
   return resultobj;
 fail:
   if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
+  {
+    free_resinfo(arg3);
+  }
+  {
+    free_resinfo(arg4);
+  }
   return NULL;
 }
 
@@ -9750,340 +9856,29 @@ SWIGINTERN PyObject *_wrap_labelbar_ndc_wrap(PyObject *SWIGUNUSEDPARM(self), PyO
   }
   arg8 = (char *)(buf8);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj8)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj8);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj8, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg9 = (ResInfo *) &trname;
-  }
-  {
-    arg10 = (void *) &nglRlist;
-  }
-  result = labelbar_ndc_wrap(arg1,arg2,arg3,arg4,arg5,arg6,(char const *)arg7,(char const *)arg8,arg9,arg10);
-  {
-    PyObject *return_list;
-    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
-    *l_map,       *l_xy      , *l_xydspec, *l_text,
-    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
-    *l_sffield, *l_vffield;
-    nglPlotId pid;
-    int i;
+    if (!dict_to_rlist(obj8,&trname,0)) {
+      SWIG_fail;
+    }
+    arg9 = (ResInfo *) &trname;
+  }
+  {
+    arg10 = (void *) &nglRlist;
+  }
+  result = labelbar_ndc_wrap(arg1,arg2,arg3,arg4,arg5,arg6,(char const *)arg7,(char const *)arg8,arg9,arg10);
+  {
+    PyObject *return_list;
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield, *l_vffield;
+    nglPlotId pid;
+    int i;
     
     pid = result;
     
@@ -10258,10 +10053,16 @@ SWIGINTERN PyObject *_wrap_labelbar_ndc_wrap(PyObject *SWIGUNUSEDPARM(self), PyO
   }
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
+  {
+    free_resinfo(arg9);
+  }
   return resultobj;
 fail:
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
+  {
+    free_resinfo(arg9);
+  }
   return NULL;
 }
 
@@ -10355,326 +10156,15 @@ SWIGINTERN PyObject *_wrap_legend_ndc_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
   }
   arg8 = (char *)(buf8);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj8)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj8);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj8, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj8,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg9 = (ResInfo *) &trname;
   }
   {
@@ -10863,10 +10353,16 @@ SWIGINTERN PyObject *_wrap_legend_ndc_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
   }
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
+  {
+    free_resinfo(arg9);
+  }
   return resultobj;
 fail:
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
+  {
+    free_resinfo(arg9);
+  }
   return NULL;
 }
 
@@ -10886,326 +10382,15 @@ SWIGINTERN PyObject *_wrap_blank_plot_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
     arg1 = (int) PyInt_AsLong (obj0);
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj1)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj1);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj1, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj1,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg2 = (ResInfo *) &trname;
   }
   {
@@ -11392,8 +10577,14 @@ SWIGINTERN PyObject *_wrap_blank_plot_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
     Py_INCREF(return_list); 
     resultobj = return_list;
   }
+  {
+    free_resinfo(arg2);
+  }
   return resultobj;
 fail:
+  {
+    free_resinfo(arg2);
+  }
   return NULL;
 }
 
@@ -11501,972 +10692,39 @@ SWIGINTERN PyObject *_wrap_contour_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject
     SWIG_exception_fail(SWIG_ArgError(res13), "in method '" "contour_wrap" "', argument " "13"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj13,&trname,0)) {
+      SWIG_fail;
+    }
+    arg14 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj13)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj13);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj13, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg14 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj14)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj14);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj14, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj14,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg15 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj15)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj15);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj15, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj15,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg16 = (ResInfo *) &trname;
   }
   {
@@ -12656,11 +10914,29 @@ SWIGINTERN PyObject *_wrap_contour_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
   if (alloc11 == SWIG_NEWOBJ) free((char*)buf11);
+  {
+    free_resinfo(arg14);
+  }
+  {
+    free_resinfo(arg15);
+  }
+  {
+    free_resinfo(arg16);
+  }
   return resultobj;
 fail:
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
   if (alloc11 == SWIG_NEWOBJ) free((char*)buf11);
+  {
+    free_resinfo(arg14);
+  }
+  {
+    free_resinfo(arg15);
+  }
+  {
+    free_resinfo(arg16);
+  }
   return NULL;
 }
 
@@ -12680,326 +10956,15 @@ SWIGINTERN PyObject *_wrap_map_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *ar
     arg1 = (int) PyInt_AsLong (obj0);
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj1)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj1);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj1, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj1,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg2 = (ResInfo *) &trname;
   }
   {
@@ -13186,8 +11151,14 @@ SWIGINTERN PyObject *_wrap_map_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *ar
     Py_INCREF(return_list); 
     resultobj = return_list;
   }
+  {
+    free_resinfo(arg2);
+  }
   return resultobj;
 fail:
+  {
+    free_resinfo(arg2);
+  }
   return NULL;
 }
 
@@ -13295,972 +11266,39 @@ SWIGINTERN PyObject *_wrap_contour_map_wrap(PyObject *SWIGUNUSEDPARM(self), PyOb
     SWIG_exception_fail(SWIG_ArgError(res13), "in method '" "contour_map_wrap" "', argument " "13"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj13,&trname,0)) {
+      SWIG_fail;
+    }
+    arg14 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj13)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj13);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj13, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg14 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj14)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj14);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj14, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj14,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg15 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj15)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj15);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj15, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj15,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg16 = (ResInfo *) &trname;
   }
   {
@@ -14450,11 +11488,29 @@ SWIGINTERN PyObject *_wrap_contour_map_wrap(PyObject *SWIGUNUSEDPARM(self), PyOb
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
   if (alloc11 == SWIG_NEWOBJ) free((char*)buf11);
+  {
+    free_resinfo(arg14);
+  }
+  {
+    free_resinfo(arg15);
+  }
+  {
+    free_resinfo(arg16);
+  }
   return resultobj;
 fail:
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc8 == SWIG_NEWOBJ) free((char*)buf8);
   if (alloc11 == SWIG_NEWOBJ) free((char*)buf11);
+  {
+    free_resinfo(arg14);
+  }
+  {
+    free_resinfo(arg15);
+  }
+  {
+    free_resinfo(arg16);
+  }
   return NULL;
 }
 
@@ -14564,972 +11620,39 @@ SWIGINTERN PyObject *_wrap_xy_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *arg
     SWIG_exception_fail(SWIG_ArgError(res13), "in method '" "xy_wrap" "', argument " "13"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj13,&trname,0)) {
+      SWIG_fail;
+    }
+    arg14 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj13)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj13);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj13, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg14 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj14)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj14);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj14, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj14,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg15 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj15)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj15);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj15, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj15,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg16 = (ResInfo *) &trname;
   }
   {
@@ -15718,10 +11841,28 @@ SWIGINTERN PyObject *_wrap_xy_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *arg
   }
   if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
+  {
+    free_resinfo(arg14);
+  }
+  {
+    free_resinfo(arg15);
+  }
+  {
+    free_resinfo(arg16);
+  }
   return resultobj;
 fail:
   if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
+  {
+    free_resinfo(arg14);
+  }
+  {
+    free_resinfo(arg15);
+  }
+  {
+    free_resinfo(arg16);
+  }
   return NULL;
 }
 
@@ -15788,972 +11929,39 @@ SWIGINTERN PyObject *_wrap_y_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args
     SWIG_exception_fail(SWIG_ArgError(res7), "in method '" "y_wrap" "', argument " "7"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj7)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj7);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj7, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj7,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg8 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj8,&trname,0)) {
+      SWIG_fail;
+    }
+    arg9 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj8)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj8);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj8, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg9 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj9)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj9);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj9, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj9,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg10 = (ResInfo *) &trname;
   }
   {
@@ -16941,9 +12149,27 @@ SWIGINTERN PyObject *_wrap_y_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args
     resultobj = return_list;
   }
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
+  {
+    free_resinfo(arg8);
+  }
+  {
+    free_resinfo(arg9);
+  }
+  {
+    free_resinfo(arg10);
+  }
   return resultobj;
 fail:
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
+  {
+    free_resinfo(arg8);
+  }
+  {
+    free_resinfo(arg9);
+  }
+  {
+    free_resinfo(arg10);
+  }
   return NULL;
 }
 
@@ -17081,972 +12307,39 @@ SWIGINTERN PyObject *_wrap_vector_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject
     SWIG_exception_fail(SWIG_ArgError(res17), "in method '" "vector_wrap" "', argument " "17"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj17)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj17);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj17, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj17,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg18 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj18,&trname,0)) {
+      SWIG_fail;
+    }
+    arg19 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj18)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj18);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj18, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg19 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj19)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj19);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj19, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj19,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg20 = (ResInfo *) &trname;
   }
   {
@@ -18237,12 +12530,30 @@ SWIGINTERN PyObject *_wrap_vector_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return resultobj;
 fail:
   if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return NULL;
 }
 
@@ -18380,986 +12691,53 @@ SWIGINTERN PyObject *_wrap_vector_map_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
     SWIG_exception_fail(SWIG_ArgError(res17), "in method '" "vector_map_wrap" "', argument " "17"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj17)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj17);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj17, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj17,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg18 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj18)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj18);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj18, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj18,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg19 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj19)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj19);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj19, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg20 = (ResInfo *) &trname;
-  }
-  {
-    arg21 = (void *) &nglRlist;
-  }
-  result = vector_map_wrap(arg1,arg2,arg3,(char const *)arg4,(char const *)arg5,arg6,arg7,arg8,arg9,(char const *)arg10,arg11,arg12,(char const *)arg13,arg14,arg15,arg16,arg17,arg18,arg19,arg20,arg21);
-  {
-    PyObject *return_list;
-    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
-    *l_map,       *l_xy      , *l_xydspec, *l_text,
-    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
-    *l_sffield, *l_vffield;
-    nglPlotId pid;
-    int i;
+    if (!dict_to_rlist(obj19,&trname,0)) {
+      SWIG_fail;
+    }
+    arg20 = (ResInfo *) &trname;
+  }
+  {
+    arg21 = (void *) &nglRlist;
+  }
+  result = vector_map_wrap(arg1,arg2,arg3,(char const *)arg4,(char const *)arg5,arg6,arg7,arg8,arg9,(char const *)arg10,arg11,arg12,(char const *)arg13,arg14,arg15,arg16,arg17,arg18,arg19,arg20,arg21);
+  {
+    PyObject *return_list;
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield, *l_vffield;
+    nglPlotId pid;
+    int i;
     
     pid = result;
     
@@ -19536,12 +12914,30 @@ SWIGINTERN PyObject *_wrap_vector_map_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return resultobj;
 fail:
   if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return NULL;
 }
 
@@ -19711,1295 +13107,51 @@ SWIGINTERN PyObject *_wrap_vector_scalar_wrap(PyObject *SWIGUNUSEDPARM(self), Py
     SWIG_exception_fail(SWIG_ArgError(res21), "in method '" "vector_scalar_wrap" "', argument " "21"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj21)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj21);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj21, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj21,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg22 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj22)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj22);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj22, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj22,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg23 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj23,&trname,0)) {
+      SWIG_fail;
+    }
+    arg24 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj23)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj23);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj23, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg24 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj24)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj24);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj24, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj24,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg25 = (ResInfo *) &trname;
   }
   {
@@ -21191,6 +13343,18 @@ SWIGINTERN PyObject *_wrap_vector_scalar_wrap(PyObject *SWIGUNUSEDPARM(self), Py
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return resultobj;
 fail:
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
@@ -21198,6 +13362,18 @@ fail:
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return NULL;
 }
 
@@ -21367,1295 +13543,51 @@ SWIGINTERN PyObject *_wrap_vector_scalar_map_wrap(PyObject *SWIGUNUSEDPARM(self)
     SWIG_exception_fail(SWIG_ArgError(res21), "in method '" "vector_scalar_map_wrap" "', argument " "21"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj21,&trname,0)) {
+      SWIG_fail;
+    }
+    arg22 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj21)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj21);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj21, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj22,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
-    arg22 = (ResInfo *) &trname;
+    arg23 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj23,&trname,0)) {
+      SWIG_fail;
+    }
+    arg24 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj22)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj22);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj22, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg23 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj23)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj23);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj23, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg24 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj24)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj24);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj24, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj24,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg25 = (ResInfo *) &trname;
   }
   {
@@ -22847,6 +13779,18 @@ SWIGINTERN PyObject *_wrap_vector_scalar_map_wrap(PyObject *SWIGUNUSEDPARM(self)
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return resultobj;
 fail:
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
@@ -22854,6 +13798,18 @@ fail:
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return NULL;
 }
 
@@ -22991,972 +13947,39 @@ SWIGINTERN PyObject *_wrap_streamline_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
     SWIG_exception_fail(SWIG_ArgError(res17), "in method '" "streamline_wrap" "', argument " "17"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj17)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj17);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj17, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj17,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg18 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj18,&trname,0)) {
+      SWIG_fail;
+    }
+    arg19 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj18)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj18);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj18, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg19 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj19)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj19);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj19, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj19,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg20 = (ResInfo *) &trname;
   }
   {
@@ -24147,12 +14170,30 @@ SWIGINTERN PyObject *_wrap_streamline_wrap(PyObject *SWIGUNUSEDPARM(self), PyObj
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return resultobj;
 fail:
   if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return NULL;
 }
 
@@ -24290,972 +14331,39 @@ SWIGINTERN PyObject *_wrap_streamline_map_wrap(PyObject *SWIGUNUSEDPARM(self), P
     SWIG_exception_fail(SWIG_ArgError(res17), "in method '" "streamline_map_wrap" "', argument " "17"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj17)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj17);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj17, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj17,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg18 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj18,&trname,0)) {
+      SWIG_fail;
+    }
+    arg19 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj18)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj18);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj18, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg19 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj19)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj19);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj19, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj19,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg20 = (ResInfo *) &trname;
   }
   {
@@ -25446,12 +14554,30 @@ SWIGINTERN PyObject *_wrap_streamline_map_wrap(PyObject *SWIGUNUSEDPARM(self), P
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return resultobj;
 fail:
   if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc10 == SWIG_NEWOBJ) free((char*)buf10);
   if (alloc13 == SWIG_NEWOBJ) free((char*)buf13);
+  {
+    free_resinfo(arg18);
+  }
+  {
+    free_resinfo(arg19);
+  }
+  {
+    free_resinfo(arg20);
+  }
   return NULL;
 }
 
@@ -25621,1295 +14747,51 @@ SWIGINTERN PyObject *_wrap_streamline_scalar_wrap(PyObject *SWIGUNUSEDPARM(self)
     SWIG_exception_fail(SWIG_ArgError(res21), "in method '" "streamline_scalar_wrap" "', argument " "21"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj21)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj21);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj21, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj21,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg22 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj22)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj22);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj22, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj22,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg23 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj23,&trname,0)) {
+      SWIG_fail;
+    }
+    arg24 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj23)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj23);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj23, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg24 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj24)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj24);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj24, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj24,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg25 = (ResInfo *) &trname;
   }
   {
@@ -27101,6 +14983,18 @@ SWIGINTERN PyObject *_wrap_streamline_scalar_wrap(PyObject *SWIGUNUSEDPARM(self)
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return resultobj;
 fail:
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
@@ -27108,6 +15002,18 @@ fail:
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return NULL;
 }
 
@@ -27277,1295 +15183,51 @@ SWIGINTERN PyObject *_wrap_streamline_scalar_map_wrap(PyObject *SWIGUNUSEDPARM(s
     SWIG_exception_fail(SWIG_ArgError(res21), "in method '" "streamline_scalar_map_wrap" "', argument " "21"" of type '" "void *""'"); 
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj21,&trname,0)) {
+      SWIG_fail;
+    }
+    arg22 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj21)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj21);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj21, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj22,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg22 = (ResInfo *) &trname;
+    arg23 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
+    if (!dict_to_rlist(obj23,&trname,0)) {
+      SWIG_fail;
+    }
+    arg24 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj22)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj22);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj22, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg23 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj23)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj23);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj23, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg24 = (ResInfo *) &trname;
-  }
-  {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
-    static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj24)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj24);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj24, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj24,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg25 = (ResInfo *) &trname;
   }
   {
@@ -28757,6 +15419,18 @@ SWIGINTERN PyObject *_wrap_streamline_scalar_map_wrap(PyObject *SWIGUNUSEDPARM(s
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return resultobj;
 fail:
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
@@ -28764,6 +15438,18 @@ fail:
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
   if (alloc12 == SWIG_NEWOBJ) free((char*)buf12);
   if (alloc15 == SWIG_NEWOBJ) free((char*)buf15);
+  {
+    free_resinfo(arg22);
+  }
+  {
+    free_resinfo(arg23);
+  }
+  {
+    free_resinfo(arg24);
+  }
+  {
+    free_resinfo(arg25);
+  }
   return NULL;
 }
 
@@ -28829,340 +15515,29 @@ SWIGINTERN PyObject *_wrap_text_ndc_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   }
   arg6 = (char *)(buf6);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj6)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj6);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj6, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
-    arg7 = (ResInfo *) &trname;
-  }
-  {
-    arg8 = (void *) &nglRlist;
-  }
-  result = text_ndc_wrap(arg1,arg2,arg3,arg4,(char const *)arg5,(char const *)arg6,arg7,arg8);
-  {
-    PyObject *return_list;
-    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
-    *l_map,       *l_xy      , *l_xydspec, *l_text,
-    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
-    *l_sffield, *l_vffield;
-    nglPlotId pid;
-    int i;
+    if (!dict_to_rlist(obj6,&trname,0)) {
+      SWIG_fail;
+    }
+    arg7 = (ResInfo *) &trname;
+  }
+  {
+    arg8 = (void *) &nglRlist;
+  }
+  result = text_ndc_wrap(arg1,arg2,arg3,arg4,(char const *)arg5,(char const *)arg6,arg7,arg8);
+  {
+    PyObject *return_list;
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield, *l_vffield;
+    nglPlotId pid;
+    int i;
     
     pid = result;
     
@@ -29338,11 +15713,17 @@ SWIGINTERN PyObject *_wrap_text_ndc_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg7);
+  }
   return resultobj;
 fail:
   if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg7);
+  }
   return NULL;
 }
 
@@ -29697,326 +16078,15 @@ SWIGINTERN PyObject *_wrap_text_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *a
   }
   arg7 = (char *)(buf7);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj7)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj7);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj7, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj7,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg8 = (ResInfo *) &trname;
   }
   {
@@ -30206,11 +16276,17 @@ SWIGINTERN PyObject *_wrap_text_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *a
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
+  {
+    free_resinfo(arg8);
+  }
   return resultobj;
 fail:
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
+  {
+    free_resinfo(arg8);
+  }
   return NULL;
 }
 
@@ -30567,649 +16643,27 @@ SWIGINTERN PyObject *_wrap_add_text_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   }
   arg7 = (char *)(buf7);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj7)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj7);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj7, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj7,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg8 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj8)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj8);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj8, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj8,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg9 = (ResInfo *) &trname;
   }
   {
@@ -31399,11 +16853,23 @@ SWIGINTERN PyObject *_wrap_add_text_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
+  {
+    free_resinfo(arg8);
+  }
+  {
+    free_resinfo(arg9);
+  }
   return resultobj;
 fail:
   if (alloc3 == SWIG_NEWOBJ) free((char*)buf3);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
   if (alloc7 == SWIG_NEWOBJ) free((char*)buf7);
+  {
+    free_resinfo(arg8);
+  }
+  {
+    free_resinfo(arg9);
+  }
   return NULL;
 }
 
@@ -32108,326 +17574,15 @@ SWIGINTERN PyObject *_wrap_poly_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *a
   } 
   arg12 = (NhlPolyType)(val12);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj12)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj12);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj12, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj12,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg13 = (ResInfo *) &trname;
   }
   {
@@ -32437,10 +17592,16 @@ SWIGINTERN PyObject *_wrap_poly_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *a
   resultobj = SWIG_Py_Void();
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg13);
+  }
   return resultobj;
 fail:
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg13);
+  }
   return NULL;
 }
 
@@ -32830,326 +17991,15 @@ SWIGINTERN PyObject *_wrap_add_poly_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   } 
   arg13 = (NhlPolyType)(val13);
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj13)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj13);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj13, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj13,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg14 = (ResInfo *) &trname;
   }
   {
@@ -33338,10 +18188,16 @@ SWIGINTERN PyObject *_wrap_add_poly_wrap(PyObject *SWIGUNUSEDPARM(self), PyObjec
   }
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg14);
+  }
   return resultobj;
 fail:
   if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
   if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg14);
+  }
   return NULL;
 }
 
@@ -33675,649 +18531,27 @@ SWIGINTERN PyObject *_wrap_panel_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *
     arg5 = (int) PyInt_AsLong (obj4);
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
     
     /*
-     *  Clear the resource list.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
-    
-    /*
-     *  Check on the type of the argument - it must be a dictionary.
-     */
-    if (PyDict_Check(obj5)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj5);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj5, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
+    if (!dict_to_rlist(obj5,&trname,0)) {
+      SWIG_fail;
     }
-    else {
-      printf("Resource lists must be dictionaries\n");
-    }
-    trname.id = rlist;
     arg6 = (ResInfo *) &trname;
   }
   {
-    int i,list_type,count;
-    ng_size_t list_len;
-    Py_ssize_t pos=0;
-    PyObject *key,*value;
-    PyArrayObject *arr;
-    char **strings;
-    double *dvals;
-    int *ivals,array_type,rlist,ndims;
-    ng_size_t *len_dims;
-    long *lvals;
     static ResInfo trname;
-    char **trnames;
-    
-    /*
-     *  Clear the resource list.
-     */
-    rlist = NhlRLCreate(NhlSETRL);
-    NhlRLClear(rlist);
     
     /*
-     *  Check on the type of the argument - it must be a dictionary.
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
      */
-    if (PyDict_Check(obj6)) {
-      count = 0;
-      trname.nstrings = PyDict_Size(obj6);
-      trnames = (char **) malloc(trname.nstrings*sizeof(char *));
-      pos = 0;
-      /*
-       *  Loop over the keyword/value pairs in the dictionary.
-       *  The values must be one of: tuple, int, float, long,
-       *  list, string, or array.
-       */
-      while (PyDict_Next(obj6, &pos, &key, &value)) {
-        trnames[count] = as_utf8_char(key);
-        count++;
-        
-        /*
-         *  value is a tuple.
-         */
-        if (PyTuple_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a tuple value.
-           */
-          if (PyList_Check(PyTuple_GetItem(value,0)) ||
-            PyTuple_Check(PyTuple_GetItem(value,0))) {
-            printf("Tuple values are not allowed to have list or tuple items.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyTuple_Size(value);
-          /*
-           *  Determine if the tuple is a tuple of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyTuple_GetItem(value,0))) {
-            /*
-             *  Check that all items in the tuple are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyTuple_GetItem(value,i))) {
-                printf("All items in the tuple value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the tuple value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyTuple_GetItem(value,i))) &&
-                (!PyInt_Check(PyTuple_GetItem(value,i))) ) {
-                printf("All items in the tuple value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            /*
-             *  Check to see if the tuple has all ints and, if not, type it as
-             *  a tuple of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyTuple_GetItem(value,i))) {
-                list_type = 1;
-                break;
-              }
-            }
-          }
-          
-          /*
-           *  Make the appropriate NhlRLSet calls based on the type of
-           *  tuple elements.
-           */
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyTuple_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  value is a list.
-         */
-        else if (PyList_Check(value)) {
-          /*
-           *  Lists and tuples are not allowed as items in a list value.
-           */
-          if (PyList_Check(PyList_GetItem(value,0)) ||
-            PyList_Check(PyList_GetItem(value,0))) {
-            printf("Use NumPy arrays for multiple dimension arrays.\n");
-            return NULL;
-          }
-          list_len = (ng_size_t)PyList_Size(value);
-          /*
-           *  Determine if the list is a list of strings, ints, or floats.
-           *  
-           *    list_type = 2 (int)
-           *              = 0 (string)
-           *              = 1 (float)
-           */
-          list_type = 2;
-          if (is_string_type(PyList_GetItem(value,0))) {
-            /*
-             *  Check that all items in the list are strings.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (!is_string_type(PyList_GetItem(value,i))) {
-                printf("All items in the list value for resource %s must be strings\n",as_utf8_char(key));
-                return NULL;
-                break;
-              }
-            }
-            list_type = 0;
-          }
-          else {
-            /*
-             *  If the items in the list value are not strings, then
-             *  they must all be ints or floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if ( (!PyFloat_Check(PyList_GetItem(value,i))) &&
-                (!PyInt_Check(PyList_GetItem(value,i))) ) {
-                printf("All items in the list value for resource %s must be ints or floats.\n",as_utf8_char(key));
-                return NULL;
-              }
-            }
-            /*
-             *  Check to see if the list has all ints and, if not, type it as
-             *  a list of floats.
-             */
-            for (i = 0; i < list_len ; i++) {
-              if (PyFloat_Check(PyList_GetItem(value,i))) {
-                list_type = 1;
-              }
-            }
-          }
-          switch (list_type) {
-          case 0:
-            strings = (char **) malloc(list_len*sizeof(char *));
-            for (i = 0; i < list_len ; i++) {
-              strings[i] = as_utf8_char(PyList_GetItem(value,i));
-            }
-            NhlRLSetStringArray(rlist,as_utf8_char(key),strings,list_len);
-            break;
-          case 1:
-            dvals = (double *) malloc(list_len*sizeof(double));
-            for (i = 0; i < list_len ; i++) {
-              dvals[i] = PyFloat_AsDouble(PyList_GetItem(value,i));
-            }
-            NhlRLSetDoubleArray(rlist,as_utf8_char(key),dvals,list_len);
-            break;
-          case 2:
-            ivals = (int *) malloc(list_len*sizeof(int));
-            for (i = 0; i < list_len ; i++) {
-              ivals[i] = (int) PyInt_AsLong(PyList_GetItem(value,i));
-            }
-            NhlRLSetIntegerArray(rlist,as_utf8_char(key),ivals,list_len);
-            break;
-          }
-        }
-        /*
-         *  Check for scalars.
-         */
-        else if (PyArray_IsAnyScalar(value)) {
-          /*
-           *  Check for Python Scalars.
-           */
-          if (PyArray_IsPythonScalar(value)) {
-            /*
-             *  value is a Python int.
-             */
-            if (PyInt_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python float.
-             */
-            else if (PyFloat_Check(value)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a Python long.
-             */
-            else if (PyLong_Check(value)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a Python string
-             */
-            else if (is_string_type(value)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-          /*
-           *  otherwise we have numpy scalars
-           */
-          else {
-            /*
-             *  value is a numpy int.
-             */
-            if (PyArray_IsScalar(value,Int)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy float.
-             */
-            else if (PyArray_IsScalar(value,Float)) {
-              NhlRLSetDouble(rlist,as_utf8_char(key),
-                PyFloat_AsDouble(value));
-            }
-            /*
-             *  value is a numpy long.
-             */
-            else if (PyArray_IsScalar(value,Long)) {
-              NhlRLSetInteger(rlist,as_utf8_char(key),
-                (int) PyInt_AsLong(value));
-            }
-            /*
-             *  value is a numpy string
-             */
-            else if (PyArray_IsScalar(value,String)) {
-              NhlRLSetString(rlist,as_utf8_char(key),
-                as_utf8_char(value));
-            }
-          }
-        }
-        /*
-         *  value is an array.
-         */
-        else if (PyArray_Check(value)) {
-          array_type = (int) ((PyArrayObject *)value)->descr->type_num;
-          /*
-           *  Process the legal array types.
-           */
-          if (array_type == PyArray_LONG || array_type == PyArray_INT) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_LONG,0,0);
-            lvals = (long *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDLongArray(rlist,as_utf8_char(key),lvals,ndims,len_dims);
-          }
-          else if (array_type == PyArray_FLOAT || array_type == PyArray_DOUBLE) {
-            arr = (PyArrayObject *) PyArray_ContiguousFromAny \
-            ((PyObject *) value,PyArray_DOUBLE,0,0);
-            dvals = (double *)arr->data;
-            ndims = arr->nd;
-            len_dims = (ng_size_t *)malloc(ndims*sizeof(ng_size_t));
-            for(i = 0; i < ndims; i++ ) {
-              len_dims[i] = (ng_size_t)arr->dimensions[i];
-            }
-            NhlRLSetMDDoubleArray(rlist,as_utf8_char(key),dvals,ndims,len_dims);
-          }
-          else {
-            printf(
-              "NumPy arrays must be of type int, int32, float, float0, float32, or float64.\n");
-            return NULL;
-          }
-        }
-        else {
-          printf("  value for keyword %s is invalid.\n",as_utf8_char(key));
-          return NULL;
-        }
-      }
-      trname.strings = trnames;
-    }
-    else {
-      printf("Resource lists must be dictionaries\n");
+    if (!dict_to_rlist(obj6,&trname,0)) {
+      SWIG_fail;
     }
-    trname.id = rlist;
     arg7 = (ResInfo *) &trname;
   }
   {
@@ -34325,8 +18559,20 @@ SWIGINTERN PyObject *_wrap_panel_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *
   }
   panel_wrap(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8);
   resultobj = SWIG_Py_Void();
+  {
+    free_resinfo(arg6);
+  }
+  {
+    free_resinfo(arg7);
+  }
   return resultobj;
 fail:
+  {
+    free_resinfo(arg6);
+  }
+  {
+    free_resinfo(arg7);
+  }
   return NULL;
 }
 
@@ -36144,6 +20390,3016 @@ fail:
 }
 
 
+SWIGINTERN PyObject *_wrap_update_scalar_field_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  nglPlotId *arg2 = (nglPlotId *) 0 ;
+  void *arg3 = (void *) 0 ;
+  char *arg4 = (char *) 0 ;
+  int arg5 ;
+  int arg6 ;
+  int arg7 ;
+  ResInfo *arg8 = (ResInfo *) 0 ;
+  ResInfo *arg9 = (ResInfo *) 0 ;
+  nglRes *arg10 = (nglRes *) 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOOO:update_scalar_field_wrap",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    int i;
+    nglPlotId inlist;
+    
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield,   *l_vffield;
+    int      *ibase,       *icontour ,  *ivector,   *istreamline,
+    *imap,        *ixy      ,  *ixydspec,  *itext,
+    *iprimitive,  *ilabelbar,  *ilegend,   *icafield,  
+    *isffield,    *ivffield;
+    
+    if (PyList_Check(obj1) == 0) {
+      printf("PlotIds must be Python lists\n"); 
+    }
+    
+    l_base = PyList_GetItem(obj1,0);
+    if (l_base == Py_None) {
+      inlist.nbase = 0;
+      inlist.base = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_base)) {
+        printf("PlotId base element must be None or a Python list\n");
+      }
+      else {
+        inlist.nbase = PyList_Size(l_base);
+        ibase = (int *) malloc(inlist.nbase*sizeof(int));
+        for (i = 0; i < inlist.nbase; i++) {
+          *(ibase+i) = (int) PyInt_AsLong(PyList_GetItem(l_base,i));
+        }
+        inlist.base = ibase;
+      }
+    }
+    
+    l_contour = PyList_GetItem(obj1,1);
+    if (l_contour == Py_None) {
+      inlist.ncontour = 0;
+      inlist.contour = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_contour)) {
+        printf("PlotId contour element must be None or a Python list\n");
+      }
+      else {
+        inlist.ncontour = PyList_Size(l_contour);
+        icontour = (int *) malloc(inlist.ncontour*sizeof(int));
+        for (i = 0; i < inlist.ncontour; i++) {
+          *(icontour+i) = (int) PyInt_AsLong(PyList_GetItem(l_contour,i));
+        }
+        inlist.contour = icontour;
+      }
+    }
+    
+    l_vector = PyList_GetItem(obj1,2);
+    if (l_vector == Py_None) {
+      inlist.nvector = 0;
+      inlist.vector = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_vector)) {
+        printf("PlotId vector element must be None or a Python list\n");
+      }
+      else {
+        inlist.nvector = PyList_Size(l_vector);
+        ivector = (int *) malloc(inlist.nvector*sizeof(int));
+        for (i = 0; i < inlist.nvector; i++) {
+          *(ivector+i) = (int) PyInt_AsLong(PyList_GetItem(l_vector,i));
+        }
+        inlist.vector = ivector;
+      }
+    }
+    
+    l_streamline = PyList_GetItem(obj1,3);
+    if (l_streamline == Py_None) {
+      inlist.nstreamline = 0;
+      inlist.streamline = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_streamline)) {
+        printf("PlotId streamline element must be None or a Python list\n");
+      }
+      else {
+        inlist.nstreamline = PyList_Size(l_streamline);
+        istreamline = (int *) malloc(inlist.nstreamline*sizeof(int));
+        for (i = 0; i < inlist.nstreamline; i++) {
+          *(istreamline+i) = (int) PyInt_AsLong(PyList_GetItem(l_streamline,i));
+        }
+        inlist.streamline = istreamline;
+      }
+    }
+    
+    l_map = PyList_GetItem(obj1,4);
+    if (l_map == Py_None) {
+      inlist.nmap = 0;
+      inlist.map = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_map)) {
+        printf("PlotId map element must be None or a Python list\n");
+      }
+      else {
+        inlist.nmap = PyList_Size(l_map);
+        imap = (int *) malloc(inlist.nmap*sizeof(int));
+        for (i = 0; i < inlist.nmap; i++) {
+          *(imap+i) = (int) PyInt_AsLong(PyList_GetItem(l_map,i));
+        }
+        inlist.map = imap;
+      }
+    }
+    
+    l_xy = PyList_GetItem(obj1,5);
+    if (l_xy == Py_None) {
+      inlist.nxy = 0;
+      inlist.xy = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_xy)) {
+        printf("PlotId xy element must be None or a Python list\n");
+      }
+      else {
+        inlist.nxy = PyList_Size(l_xy);
+        ixy = (int *) malloc(inlist.nxy*sizeof(int));
+        for (i = 0; i < inlist.nxy; i++) {
+          *(ixy+i) = (int) PyInt_AsLong(PyList_GetItem(l_xy,i));
+        }
+        inlist.xy = ixy;
+      }
+    }
+    
+    l_xydspec = PyList_GetItem(obj1,6);
+    if (l_xydspec == Py_None) {
+      inlist.nxydspec = 0;
+      inlist.xydspec = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_xydspec)) {
+        printf("PlotId xydspec element must be None or a Python list\n");
+      }
+      else {
+        inlist.nxydspec = PyList_Size(l_xydspec);
+        ixydspec = (int *) malloc(inlist.nxydspec*sizeof(int));
+        for (i = 0; i < inlist.nxydspec; i++) {
+          *(ixydspec+i) = (int) PyInt_AsLong(PyList_GetItem(l_xydspec,i));
+        }
+        inlist.xydspec = ixydspec;
+      }
+    }
+    
+    l_text = PyList_GetItem(obj1,7);
+    if (l_text == Py_None) {
+      inlist.ntext = 0;
+      inlist.text = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_text)) {
+        printf("PlotId text element must be None or a Python list\n");
+      }
+      else {
+        inlist.ntext = PyList_Size(l_text);
+        itext = (int *) malloc(inlist.ntext*sizeof(int));
+        for (i = 0; i < inlist.ntext; i++) {
+          *(itext+i) = (int) PyInt_AsLong(PyList_GetItem(l_text,i));
+        }
+        inlist.text = itext;
+      }
+    }
+    
+    l_primitive = PyList_GetItem(obj1,8);
+    if (l_primitive == Py_None) {
+      inlist.nprimitive = 0;
+      inlist.primitive = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_primitive)) {
+        printf("PlotId primitive element must be None or a Python list\n");
+      }
+      else {
+        inlist.nprimitive = PyList_Size(l_primitive);
+        iprimitive = (int *) malloc(inlist.nprimitive*sizeof(int));
+        for (i = 0; i < inlist.nprimitive; i++) {
+          *(iprimitive+i) = (int) PyInt_AsLong(PyList_GetItem(l_primitive,i));
+        }
+        inlist.primitive = iprimitive;
+      }
+    }
+    
+    l_labelbar = PyList_GetItem(obj1,9);
+    if (l_labelbar == Py_None) {
+      inlist.nlabelbar = 0;
+      inlist.labelbar = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_labelbar)) {
+        printf("PlotId labelbar element must be None or a Python list\n");
+      }
+      else {
+        inlist.nlabelbar = PyList_Size(l_labelbar);
+        ilabelbar = (int *) malloc(inlist.nlabelbar*sizeof(int));
+        for (i = 0; i < inlist.nlabelbar; i++) {
+          *(ilabelbar+i) = (int) PyInt_AsLong(PyList_GetItem(l_labelbar,i));
+        }
+        inlist.labelbar = ilabelbar;
+      }
+    }
+    
+    l_legend = PyList_GetItem(obj1,10);
+    if (l_legend == Py_None) {
+      inlist.nlegend = 0;
+      inlist.legend = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_legend)) {
+        printf("PlotId legend element must be None or a Python list\n");
+      }
+      else {
+        inlist.nlegend = PyList_Size(l_legend);
+        ilegend = (int *) malloc(inlist.nlegend*sizeof(int));
+        for (i = 0; i < inlist.nlegend; i++) {
+          *(ilegend+i) = (int) PyInt_AsLong(PyList_GetItem(l_legend,i));
+        }
+        inlist.legend = ilegend;
+      }
+    }
+    
+    l_cafield = PyList_GetItem(obj1,11);
+    if (l_cafield == Py_None) {
+      inlist.ncafield = 0;
+      inlist.cafield = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_cafield)) {
+        printf("PlotId cafield element must be None or a Python list\n");
+      }
+      else {
+        inlist.ncafield = PyList_Size(l_cafield);
+        icafield = (int *) malloc(inlist.ncafield*sizeof(int));
+        for (i = 0; i < inlist.ncafield; i++) {
+          *(icafield+i) = (int) PyInt_AsLong(PyList_GetItem(l_cafield,i));
+        }
+        inlist.cafield = icafield;
+      }
+    }
+    
+    l_sffield = PyList_GetItem(obj1,12);
+    if (l_sffield == Py_None) {
+      inlist.nsffield = 0;
+      inlist.sffield = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_sffield)) {
+        printf("PlotId sffield element must be None or a Python list\n");
+      }
+      else {
+        inlist.nsffield = PyList_Size(l_sffield);
+        isffield = (int *) malloc(inlist.nsffield*sizeof(int));
+        for (i = 0; i < inlist.nsffield; i++) {
+          *(isffield+i) = (int) PyInt_AsLong(PyList_GetItem(l_sffield,i));
+        }
+        inlist.sffield = isffield;
+      }
+    }
+    
+    l_vffield = PyList_GetItem(obj1,13);
+    if (l_vffield == Py_None) {
+      inlist.nvffield = 0;
+      inlist.vffield = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_vffield)) {
+        printf("PlotId vffield element must be None or a Python list\n");
+      }
+      else {
+        inlist.nvffield = PyList_Size(l_vffield);
+        ivffield = (int *) malloc(inlist.nvffield*sizeof(int));
+        for (i = 0; i < inlist.nvffield; i++) {
+          *(ivffield+i) = (int) PyInt_AsLong(PyList_GetItem(l_vffield,i));
+        }
+        inlist.vffield = ivffield;
+      }
+    }
+    
+    arg2 = (nglPlotId *) alloca(sizeof(nglPlotId));
+    memcpy(arg2, &inlist, sizeof(nglPlotId));
+    
+  }
+  {
+    PyArrayObject *arr;
+    arr =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    arg3 = (void *) arr->data;
+  }
+  res4 = SWIG_AsCharPtrAndSize(obj3, &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "update_scalar_field_wrap" "', argument " "4"" of type '" "char const *""'");
+  }
+  arg4 = (char *)(buf4);
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  {
+    arg7 = (int) PyInt_AsLong (obj6);
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj7,&trname,0)) {
+      SWIG_fail;
+    }
+    arg8 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj8,&trname,0)) {
+      SWIG_fail;
+    }
+    arg9 = (ResInfo *) &trname;
+  }
+  {
+    arg10 = (void *) &nglRlist;
+  }
+  update_scalar_field_wrap(arg1,arg2,arg3,(char const *)arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+  resultobj = SWIG_Py_Void();
+  if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
+  {
+    free_resinfo(arg8);
+  }
+  {
+    free_resinfo(arg9);
+  }
+  return resultobj;
+fail:
+  if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
+  {
+    free_resinfo(arg8);
+  }
+  {
+    free_resinfo(arg9);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_update_vector_field_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  nglPlotId *arg2 = (nglPlotId *) 0 ;
+  void *arg3 = (void *) 0 ;
+  void *arg4 = (void *) 0 ;
+  char *arg5 = (char *) 0 ;
+  char *arg6 = (char *) 0 ;
+  int arg7 ;
+  int arg8 ;
+  int arg9 ;
+  ResInfo *arg10 = (ResInfo *) 0 ;
+  ResInfo *arg11 = (ResInfo *) 0 ;
+  nglRes *arg12 = (nglRes *) 0 ;
+  int res5 ;
+  char *buf5 = 0 ;
+  int alloc5 = 0 ;
+  int res6 ;
+  char *buf6 = 0 ;
+  int alloc6 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  PyObject * obj10 = 0 ;
+  PyObject * obj11 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOOOOO:update_vector_field_wrap",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10,&obj11)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    int i;
+    nglPlotId inlist;
+    
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield,   *l_vffield;
+    int      *ibase,       *icontour ,  *ivector,   *istreamline,
+    *imap,        *ixy      ,  *ixydspec,  *itext,
+    *iprimitive,  *ilabelbar,  *ilegend,   *icafield,  
+    *isffield,    *ivffield;
+    
+    if (PyList_Check(obj1) == 0) {
+      printf("PlotIds must be Python lists\n"); 
+    }
+    
+    l_base = PyList_GetItem(obj1,0);
+    if (l_base == Py_None) {
+      inlist.nbase = 0;
+      inlist.base = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_base)) {
+        printf("PlotId base element must be None or a Python list\n");
+      }
+      else {
+        inlist.nbase = PyList_Size(l_base);
+        ibase = (int *) malloc(inlist.nbase*sizeof(int));
+        for (i = 0; i < inlist.nbase; i++) {
+          *(ibase+i) = (int) PyInt_AsLong(PyList_GetItem(l_base,i));
+        }
+        inlist.base = ibase;
+      }
+    }
+    
+    l_contour = PyList_GetItem(obj1,1);
+    if (l_contour == Py_None) {
+      inlist.ncontour = 0;
+      inlist.contour = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_contour)) {
+        printf("PlotId contour element must be None or a Python list\n");
+      }
+      else {
+        inlist.ncontour = PyList_Size(l_contour);
+        icontour = (int *) malloc(inlist.ncontour*sizeof(int));
+        for (i = 0; i < inlist.ncontour; i++) {
+          *(icontour+i) = (int) PyInt_AsLong(PyList_GetItem(l_contour,i));
+        }
+        inlist.contour = icontour;
+      }
+    }
+    
+    l_vector = PyList_GetItem(obj1,2);
+    if (l_vector == Py_None) {
+      inlist.nvector = 0;
+      inlist.vector = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_vector)) {
+        printf("PlotId vector element must be None or a Python list\n");
+      }
+      else {
+        inlist.nvector = PyList_Size(l_vector);
+        ivector = (int *) malloc(inlist.nvector*sizeof(int));
+        for (i = 0; i < inlist.nvector; i++) {
+          *(ivector+i) = (int) PyInt_AsLong(PyList_GetItem(l_vector,i));
+        }
+        inlist.vector = ivector;
+      }
+    }
+    
+    l_streamline = PyList_GetItem(obj1,3);
+    if (l_streamline == Py_None) {
+      inlist.nstreamline = 0;
+      inlist.streamline = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_streamline)) {
+        printf("PlotId streamline element must be None or a Python list\n");
+      }
+      else {
+        inlist.nstreamline = PyList_Size(l_streamline);
+        istreamline = (int *) malloc(inlist.nstreamline*sizeof(int));
+        for (i = 0; i < inlist.nstreamline; i++) {
+          *(istreamline+i) = (int) PyInt_AsLong(PyList_GetItem(l_streamline,i));
+        }
+        inlist.streamline = istreamline;
+      }
+    }
+    
+    l_map = PyList_GetItem(obj1,4);
+    if (l_map == Py_None) {
+      inlist.nmap = 0;
+      inlist.map = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_map)) {
+        printf("PlotId map element must be None or a Python list\n");
+      }
+      else {
+        inlist.nmap = PyList_Size(l_map);
+        imap = (int *) malloc(inlist.nmap*sizeof(int));
+        for (i = 0; i < inlist.nmap; i++) {
+          *(imap+i) = (int) PyInt_AsLong(PyList_GetItem(l_map,i));
+        }
+        inlist.map = imap;
+      }
+    }
+    
+    l_xy = PyList_GetItem(obj1,5);
+    if (l_xy == Py_None) {
+      inlist.nxy = 0;
+      inlist.xy = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_xy)) {
+        printf("PlotId xy element must be None or a Python list\n");
+      }
+      else {
+        inlist.nxy = PyList_Size(l_xy);
+        ixy = (int *) malloc(inlist.nxy*sizeof(int));
+        for (i = 0; i < inlist.nxy; i++) {
+          *(ixy+i) = (int) PyInt_AsLong(PyList_GetItem(l_xy,i));
+        }
+        inlist.xy = ixy;
+      }
+    }
+    
+    l_xydspec = PyList_GetItem(obj1,6);
+    if (l_xydspec == Py_None) {
+      inlist.nxydspec = 0;
+      inlist.xydspec = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_xydspec)) {
+        printf("PlotId xydspec element must be None or a Python list\n");
+      }
+      else {
+        inlist.nxydspec = PyList_Size(l_xydspec);
+        ixydspec = (int *) malloc(inlist.nxydspec*sizeof(int));
+        for (i = 0; i < inlist.nxydspec; i++) {
+          *(ixydspec+i) = (int) PyInt_AsLong(PyList_GetItem(l_xydspec,i));
+        }
+        inlist.xydspec = ixydspec;
+      }
+    }
+    
+    l_text = PyList_GetItem(obj1,7);
+    if (l_text == Py_None) {
+      inlist.ntext = 0;
+      inlist.text = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_text)) {
+        printf("PlotId text element must be None or a Python list\n");
+      }
+      else {
+        inlist.ntext = PyList_Size(l_text);
+        itext = (int *) malloc(inlist.ntext*sizeof(int));
+        for (i = 0; i < inlist.ntext; i++) {
+          *(itext+i) = (int) PyInt_AsLong(PyList_GetItem(l_text,i));
+        }
+        inlist.text = itext;
+      }
+    }
+    
+    l_primitive = PyList_GetItem(obj1,8);
+    if (l_primitive == Py_None) {
+      inlist.nprimitive = 0;
+      inlist.primitive = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_primitive)) {
+        printf("PlotId primitive element must be None or a Python list\n");
+      }
+      else {
+        inlist.nprimitive = PyList_Size(l_primitive);
+        iprimitive = (int *) malloc(inlist.nprimitive*sizeof(int));
+        for (i = 0; i < inlist.nprimitive; i++) {
+          *(iprimitive+i) = (int) PyInt_AsLong(PyList_GetItem(l_primitive,i));
+        }
+        inlist.primitive = iprimitive;
+      }
+    }
+    
+    l_labelbar = PyList_GetItem(obj1,9);
+    if (l_labelbar == Py_None) {
+      inlist.nlabelbar = 0;
+      inlist.labelbar = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_labelbar)) {
+        printf("PlotId labelbar element must be None or a Python list\n");
+      }
+      else {
+        inlist.nlabelbar = PyList_Size(l_labelbar);
+        ilabelbar = (int *) malloc(inlist.nlabelbar*sizeof(int));
+        for (i = 0; i < inlist.nlabelbar; i++) {
+          *(ilabelbar+i) = (int) PyInt_AsLong(PyList_GetItem(l_labelbar,i));
+        }
+        inlist.labelbar = ilabelbar;
+      }
+    }
+    
+    l_legend = PyList_GetItem(obj1,10);
+    if (l_legend == Py_None) {
+      inlist.nlegend = 0;
+      inlist.legend = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_legend)) {
+        printf("PlotId legend element must be None or a Python list\n");
+      }
+      else {
+        inlist.nlegend = PyList_Size(l_legend);
+        ilegend = (int *) malloc(inlist.nlegend*sizeof(int));
+        for (i = 0; i < inlist.nlegend; i++) {
+          *(ilegend+i) = (int) PyInt_AsLong(PyList_GetItem(l_legend,i));
+        }
+        inlist.legend = ilegend;
+      }
+    }
+    
+    l_cafield = PyList_GetItem(obj1,11);
+    if (l_cafield == Py_None) {
+      inlist.ncafield = 0;
+      inlist.cafield = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_cafield)) {
+        printf("PlotId cafield element must be None or a Python list\n");
+      }
+      else {
+        inlist.ncafield = PyList_Size(l_cafield);
+        icafield = (int *) malloc(inlist.ncafield*sizeof(int));
+        for (i = 0; i < inlist.ncafield; i++) {
+          *(icafield+i) = (int) PyInt_AsLong(PyList_GetItem(l_cafield,i));
+        }
+        inlist.cafield = icafield;
+      }
+    }
+    
+    l_sffield = PyList_GetItem(obj1,12);
+    if (l_sffield == Py_None) {
+      inlist.nsffield = 0;
+      inlist.sffield = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_sffield)) {
+        printf("PlotId sffield element must be None or a Python list\n");
+      }
+      else {
+        inlist.nsffield = PyList_Size(l_sffield);
+        isffield = (int *) malloc(inlist.nsffield*sizeof(int));
+        for (i = 0; i < inlist.nsffield; i++) {
+          *(isffield+i) = (int) PyInt_AsLong(PyList_GetItem(l_sffield,i));
+        }
+        inlist.sffield = isffield;
+      }
+    }
+    
+    l_vffield = PyList_GetItem(obj1,13);
+    if (l_vffield == Py_None) {
+      inlist.nvffield = 0;
+      inlist.vffield = (int *) NULL;
+    }
+    else {
+      if (!PyList_Check(l_vffield)) {
+        printf("PlotId vffield element must be None or a Python list\n");
+      }
+      else {
+        inlist.nvffield = PyList_Size(l_vffield);
+        ivffield = (int *) malloc(inlist.nvffield*sizeof(int));
+        for (i = 0; i < inlist.nvffield; i++) {
+          *(ivffield+i) = (int) PyInt_AsLong(PyList_GetItem(l_vffield,i));
+        }
+        inlist.vffield = ivffield;
+      }
+    }
+    
+    arg2 = (nglPlotId *) alloca(sizeof(nglPlotId));
+    memcpy(arg2, &inlist, sizeof(nglPlotId));
+    
+  }
+  {
+    PyArrayObject *arr;
+    arr =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    arg3 = (void *) arr->data;
+  }
+  {
+    PyArrayObject *arr;
+    arr =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    arg4 = (void *) arr->data;
+  }
+  res5 = SWIG_AsCharPtrAndSize(obj4, &buf5, NULL, &alloc5);
+  if (!SWIG_IsOK(res5)) {
+    SWIG_exception_fail(SWIG_ArgError(res5), "in method '" "update_vector_field_wrap" "', argument " "5"" of type '" "char const *""'");
+  }
+  arg5 = (char *)(buf5);
+  res6 = SWIG_AsCharPtrAndSize(obj5, &buf6, NULL, &alloc6);
+  if (!SWIG_IsOK(res6)) {
+    SWIG_exception_fail(SWIG_ArgError(res6), "in method '" "update_vector_field_wrap" "', argument " "6"" of type '" "char const *""'");
+  }
+  arg6 = (char *)(buf6);
+  {
+    arg7 = (int) PyInt_AsLong (obj6);
+  }
+  {
+    arg8 = (int) PyInt_AsLong (obj7);
+  }
+  {
+    arg9 = (int) PyInt_AsLong (obj8);
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj9,&trname,0)) {
+      SWIG_fail;
+    }
+    arg10 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj10,&trname,0)) {
+      SWIG_fail;
+    }
+    arg11 = (ResInfo *) &trname;
+  }
+  {
+    arg12 = (void *) &nglRlist;
+  }
+  update_vector_field_wrap(arg1,arg2,arg3,arg4,(char const *)arg5,(char const *)arg6,arg7,arg8,arg9,arg10,arg11,arg12);
+  resultobj = SWIG_Py_Void();
+  if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
+  if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg10);
+  }
+  {
+    free_resinfo(arg11);
+  }
+  return resultobj;
+fail:
+  if (alloc5 == SWIG_NEWOBJ) free((char*)buf5);
+  if (alloc6 == SWIG_NEWOBJ) free((char*)buf6);
+  {
+    free_resinfo(arg10);
+  }
+  {
+    free_resinfo(arg11);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_panel_layout_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)":panel_layout_p")) SWIG_fail;
+  result = (PyObject *)panel_layout_p();
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_create_mesh(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  double *arg4 = (double *) 0 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  int *arg7 = (int *) 0 ;
+  int arg8 ;
+  int arg9 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyArrayObject *arr5 = NULL ;
+  PyArrayObject *arr7 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOO:create_mesh",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arr5 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj4,PyArray_DOUBLE,0,0);
+    if (arr5 == NULL) SWIG_fail;
+    arg5 = (double *) arr5->data;
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  {
+    arr7 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj6,PyArray_INT,0,0);
+    if (arr7 == NULL) SWIG_fail;
+    arg7 = (int *) arr7->data;
+  }
+  {
+    arg8 = (int) PyInt_AsLong (obj7);
+  }
+  {
+    arg9 = (int) PyInt_AsLong (obj8);
+  }
+  result = (int)create_mesh(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9);
+  resultobj = SWIG_From_int((int)(result));
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  {
+    Py_XDECREF(arr5);
+  }
+  {
+    Py_XDECREF(arr7);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  {
+    Py_XDECREF(arr5);
+  }
+  {
+    Py_XDECREF(arr7);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_destroy_mesh(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:destroy_mesh",&obj0)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  destroy_mesh(arg1);
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_contour_mesh_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  int arg2 ;
+  void *arg3 = (void *) 0 ;
+  char *arg4 = (char *) 0 ;
+  ResInfo *arg5 = (ResInfo *) 0 ;
+  ResInfo *arg6 = (ResInfo *) 0 ;
+  ResInfo *arg7 = (ResInfo *) 0 ;
+  nglRes *arg8 = (nglRes *) 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  nglPlotId result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOO:contour_mesh_wrap",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arg2 = (int) PyInt_AsLong (obj1);
+  }
+  {
+    PyArrayObject *arr;
+    arr =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    arg3 = (void *) arr->data;
+  }
+  res4 = SWIG_AsCharPtrAndSize(obj3, &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "contour_mesh_wrap" "', argument " "4"" of type '" "char const *""'");
+  }
+  arg4 = (char *)(buf4);
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj4,&trname,0)) {
+      SWIG_fail;
+    }
+    arg5 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj5,&trname,0)) {
+      SWIG_fail;
+    }
+    arg6 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj6,&trname,0)) {
+      SWIG_fail;
+    }
+    arg7 = (ResInfo *) &trname;
+  }
+  {
+    arg8 = (void *) &nglRlist;
+  }
+  result = contour_mesh_wrap(arg1,arg2,arg3,(char const *)arg4,arg5,arg6,arg7,arg8);
+  {
+    PyObject *return_list;
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield, *l_vffield;
+    nglPlotId pid;
+    int i;
+    
+    pid = result;
+    
+    return_list = PyList_New(14);
+    
+    if (pid.nbase == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,0,Py_None);
+    }
+    else {
+      l_base = PyList_New(pid.nbase);
+      for (i = 0; i < pid.nbase; i++) {
+        PyList_SetItem(l_base,i,PyInt_FromLong((long) *(pid.base+i)));
+      }
+      PyList_SetItem(return_list,0,l_base);
+    }
+    
+    if (pid.ncontour == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,1,Py_None);
+    }
+    else {
+      l_contour = PyList_New(pid.ncontour);
+      for (i = 0; i < pid.ncontour; i++) {
+        PyList_SetItem(l_contour,i,PyInt_FromLong((long) *(pid.contour+i)));
+      }
+      PyList_SetItem(return_list,1,l_contour);
+    }
+    
+    if (pid.nvector == 0) {
+      PyList_SetItem(return_list,2,Py_None);
+    }
+    else {
+      l_vector = PyList_New(pid.nvector);
+      for (i = 0; i < pid.nvector; i++) {
+        PyList_SetItem(l_vector,i,PyInt_FromLong((long) *(pid.vector+i)));
+      }
+      PyList_SetItem(return_list,2,l_vector);
+    }
+    
+    if (pid.nstreamline == 0) {
+      PyList_SetItem(return_list,3,Py_None);
+    }
+    else {
+      l_streamline = PyList_New(pid.nstreamline);
+      for (i = 0; i < pid.nstreamline; i++) {
+        PyList_SetItem(l_streamline,i,PyInt_FromLong((long) *(pid.streamline+i)));
+      }
+      PyList_SetItem(return_list,3,l_streamline);
+    }
+    
+    if (pid.nmap == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,4,Py_None);
+    }
+    else {
+      l_map = PyList_New(pid.nmap);
+      for (i = 0; i < pid.nmap; i++) {
+        PyList_SetItem(l_map,i,PyInt_FromLong((long) *(pid.map+i)));
+      }
+      PyList_SetItem(return_list,4,l_map);
+    }
+    
+    if (pid.nxy == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,5,Py_None);
+    }
+    else {
+      l_xy = PyList_New(pid.nxy);
+      for (i = 0; i < pid.nxy; i++) {
+        PyList_SetItem(l_xy,i,PyInt_FromLong((long) *(pid.xy+i)));
+      }
+      PyList_SetItem(return_list,5,l_xy);
+    }
+    
+    if (pid.nxydspec == 0) {
+      PyList_SetItem(return_list,6,Py_None);
+    }
+    else {
+      l_xydspec = PyList_New(pid.nxydspec);
+      for (i = 0; i < pid.nxydspec; i++) {
+        PyList_SetItem(l_xydspec,i,PyInt_FromLong((long) *(pid.xydspec+i)));
+      }
+      PyList_SetItem(return_list,6,l_xydspec);
+    }
+    
+    if (pid.ntext == 0) {
+      PyList_SetItem(return_list,7,Py_None);
+    }
+    else {
+      l_text = PyList_New(pid.ntext);
+      for (i = 0; i < pid.ntext; i++) {
+        PyList_SetItem(l_text,i,PyInt_FromLong((long) *(pid.text+i)));
+      }
+      PyList_SetItem(return_list,7,l_text);
+    }
+    
+    if (pid.nprimitive == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,8,Py_None);
+    }
+    else {
+      l_primitive = PyList_New(pid.nprimitive);
+      for (i = 0; i < pid.nprimitive; i++) {
+        PyList_SetItem(l_primitive,i,PyInt_FromLong((long) *(pid.primitive+i)));
+      }
+      PyList_SetItem(return_list,8,l_primitive);
+    }
+    
+    if (pid.nlabelbar == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,9,Py_None);
+    }
+    else {
+      l_labelbar = PyList_New(pid.nlabelbar);
+      for (i = 0; i < pid.nlabelbar; i++) {
+        PyList_SetItem(l_labelbar,i,PyInt_FromLong((long) *(pid.labelbar+i)));
+      }
+      PyList_SetItem(return_list,9,l_labelbar);
+    }
+    
+    if (pid.nlegend == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,10,Py_None);
+    }
+    else {
+      l_legend = PyList_New(pid.nlegend);
+      for (i = 0; i < pid.nlegend; i++) {
+        PyList_SetItem(l_legend,i,PyInt_FromLong((long) *(pid.legend+i)));
+      }
+      PyList_SetItem(return_list,10,l_legend);
+    }
+    
+    if (pid.ncafield == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,11,Py_None);
+    }
+    else {
+      l_cafield = PyList_New(pid.ncafield);
+      for (i = 0; i < pid.ncafield; i++) {
+        PyList_SetItem(l_cafield,i,PyInt_FromLong((long) *(pid.cafield+i)));
+      }
+      PyList_SetItem(return_list,11,l_cafield);
+    }
+    
+    if (pid.nsffield == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,12,Py_None);
+    }
+    else {
+      l_sffield = PyList_New(pid.nsffield);
+      for (i = 0; i < pid.nsffield; i++) {
+        PyList_SetItem(l_sffield,i,PyInt_FromLong((long) *(pid.sffield+i)));
+      }
+      PyList_SetItem(return_list,12,l_sffield);
+    }
+    
+    if (pid.nvffield == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,13,Py_None);
+    }
+    else {
+      l_vffield = PyList_New(pid.nvffield);
+      for (i = 0; i < pid.nvffield; i++) {
+        PyList_SetItem(l_vffield,i,PyInt_FromLong((long) *(pid.vffield+i)));
+      }
+      PyList_SetItem(return_list,13,l_vffield);
+    }
+    
+    Py_INCREF(return_list); 
+    resultobj = return_list;
+  }
+  if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
+  {
+    free_resinfo(arg5);
+  }
+  {
+    free_resinfo(arg6);
+  }
+  {
+    free_resinfo(arg7);
+  }
+  return resultobj;
+fail:
+  if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
+  {
+    free_resinfo(arg5);
+  }
+  {
+    free_resinfo(arg6);
+  }
+  {
+    free_resinfo(arg7);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_contour_map_mesh_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  int arg2 ;
+  void *arg3 = (void *) 0 ;
+  char *arg4 = (char *) 0 ;
+  ResInfo *arg5 = (ResInfo *) 0 ;
+  ResInfo *arg6 = (ResInfo *) 0 ;
+  ResInfo *arg7 = (ResInfo *) 0 ;
+  nglRes *arg8 = (nglRes *) 0 ;
+  int res4 ;
+  char *buf4 = 0 ;
+  int alloc4 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  nglPlotId result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOO:contour_map_mesh_wrap",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arg2 = (int) PyInt_AsLong (obj1);
+  }
+  {
+    PyArrayObject *arr;
+    arr =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    arg3 = (void *) arr->data;
+  }
+  res4 = SWIG_AsCharPtrAndSize(obj3, &buf4, NULL, &alloc4);
+  if (!SWIG_IsOK(res4)) {
+    SWIG_exception_fail(SWIG_ArgError(res4), "in method '" "contour_map_mesh_wrap" "', argument " "4"" of type '" "char const *""'");
+  }
+  arg4 = (char *)(buf4);
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj4,&trname,0)) {
+      SWIG_fail;
+    }
+    arg5 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj5,&trname,0)) {
+      SWIG_fail;
+    }
+    arg6 = (ResInfo *) &trname;
+  }
+  {
+    static ResInfo trname;
+    
+    /*
+     *  Convert the dictionary to a new resource list. It, and the
+     *  memory it refers to, is freed once the call has returned.
+     */
+    if (!dict_to_rlist(obj6,&trname,0)) {
+      SWIG_fail;
+    }
+    arg7 = (ResInfo *) &trname;
+  }
+  {
+    arg8 = (void *) &nglRlist;
+  }
+  result = contour_map_mesh_wrap(arg1,arg2,arg3,(char const *)arg4,arg5,arg6,arg7,arg8);
+  {
+    PyObject *return_list;
+    PyObject *l_base,      *l_contour , *l_vector,  *l_streamline,
+    *l_map,       *l_xy      , *l_xydspec, *l_text,
+    *l_primitive, *l_labelbar, *l_legend,  *l_cafield, 
+    *l_sffield, *l_vffield;
+    nglPlotId pid;
+    int i;
+    
+    pid = result;
+    
+    return_list = PyList_New(14);
+    
+    if (pid.nbase == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,0,Py_None);
+    }
+    else {
+      l_base = PyList_New(pid.nbase);
+      for (i = 0; i < pid.nbase; i++) {
+        PyList_SetItem(l_base,i,PyInt_FromLong((long) *(pid.base+i)));
+      }
+      PyList_SetItem(return_list,0,l_base);
+    }
+    
+    if (pid.ncontour == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,1,Py_None);
+    }
+    else {
+      l_contour = PyList_New(pid.ncontour);
+      for (i = 0; i < pid.ncontour; i++) {
+        PyList_SetItem(l_contour,i,PyInt_FromLong((long) *(pid.contour+i)));
+      }
+      PyList_SetItem(return_list,1,l_contour);
+    }
+    
+    if (pid.nvector == 0) {
+      PyList_SetItem(return_list,2,Py_None);
+    }
+    else {
+      l_vector = PyList_New(pid.nvector);
+      for (i = 0; i < pid.nvector; i++) {
+        PyList_SetItem(l_vector,i,PyInt_FromLong((long) *(pid.vector+i)));
+      }
+      PyList_SetItem(return_list,2,l_vector);
+    }
+    
+    if (pid.nstreamline == 0) {
+      PyList_SetItem(return_list,3,Py_None);
+    }
+    else {
+      l_streamline = PyList_New(pid.nstreamline);
+      for (i = 0; i < pid.nstreamline; i++) {
+        PyList_SetItem(l_streamline,i,PyInt_FromLong((long) *(pid.streamline+i)));
+      }
+      PyList_SetItem(return_list,3,l_streamline);
+    }
+    
+    if (pid.nmap == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,4,Py_None);
+    }
+    else {
+      l_map = PyList_New(pid.nmap);
+      for (i = 0; i < pid.nmap; i++) {
+        PyList_SetItem(l_map,i,PyInt_FromLong((long) *(pid.map+i)));
+      }
+      PyList_SetItem(return_list,4,l_map);
+    }
+    
+    if (pid.nxy == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,5,Py_None);
+    }
+    else {
+      l_xy = PyList_New(pid.nxy);
+      for (i = 0; i < pid.nxy; i++) {
+        PyList_SetItem(l_xy,i,PyInt_FromLong((long) *(pid.xy+i)));
+      }
+      PyList_SetItem(return_list,5,l_xy);
+    }
+    
+    if (pid.nxydspec == 0) {
+      PyList_SetItem(return_list,6,Py_None);
+    }
+    else {
+      l_xydspec = PyList_New(pid.nxydspec);
+      for (i = 0; i < pid.nxydspec; i++) {
+        PyList_SetItem(l_xydspec,i,PyInt_FromLong((long) *(pid.xydspec+i)));
+      }
+      PyList_SetItem(return_list,6,l_xydspec);
+    }
+    
+    if (pid.ntext == 0) {
+      PyList_SetItem(return_list,7,Py_None);
+    }
+    else {
+      l_text = PyList_New(pid.ntext);
+      for (i = 0; i < pid.ntext; i++) {
+        PyList_SetItem(l_text,i,PyInt_FromLong((long) *(pid.text+i)));
+      }
+      PyList_SetItem(return_list,7,l_text);
+    }
+    
+    if (pid.nprimitive == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,8,Py_None);
+    }
+    else {
+      l_primitive = PyList_New(pid.nprimitive);
+      for (i = 0; i < pid.nprimitive; i++) {
+        PyList_SetItem(l_primitive,i,PyInt_FromLong((long) *(pid.primitive+i)));
+      }
+      PyList_SetItem(return_list,8,l_primitive);
+    }
+    
+    if (pid.nlabelbar == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,9,Py_None);
+    }
+    else {
+      l_labelbar = PyList_New(pid.nlabelbar);
+      for (i = 0; i < pid.nlabelbar; i++) {
+        PyList_SetItem(l_labelbar,i,PyInt_FromLong((long) *(pid.labelbar+i)));
+      }
+      PyList_SetItem(return_list,9,l_labelbar);
+    }
+    
+    if (pid.nlegend == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,10,Py_None);
+    }
+    else {
+      l_legend = PyList_New(pid.nlegend);
+      for (i = 0; i < pid.nlegend; i++) {
+        PyList_SetItem(l_legend,i,PyInt_FromLong((long) *(pid.legend+i)));
+      }
+      PyList_SetItem(return_list,10,l_legend);
+    }
+    
+    if (pid.ncafield == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,11,Py_None);
+    }
+    else {
+      l_cafield = PyList_New(pid.ncafield);
+      for (i = 0; i < pid.ncafield; i++) {
+        PyList_SetItem(l_cafield,i,PyInt_FromLong((long) *(pid.cafield+i)));
+      }
+      PyList_SetItem(return_list,11,l_cafield);
+    }
+    
+    if (pid.nsffield == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,12,Py_None);
+    }
+    else {
+      l_sffield = PyList_New(pid.nsffield);
+      for (i = 0; i < pid.nsffield; i++) {
+        PyList_SetItem(l_sffield,i,PyInt_FromLong((long) *(pid.sffield+i)));
+      }
+      PyList_SetItem(return_list,12,l_sffield);
+    }
+    
+    if (pid.nvffield == 0) {
+      Py_INCREF(Py_None); 
+      PyList_SetItem(return_list,13,Py_None);
+    }
+    else {
+      l_vffield = PyList_New(pid.nvffield);
+      for (i = 0; i < pid.nvffield; i++) {
+        PyList_SetItem(l_vffield,i,PyInt_FromLong((long) *(pid.vffield+i)));
+      }
+      PyList_SetItem(return_list,13,l_vffield);
+    }
+    
+    Py_INCREF(return_list); 
+    resultobj = return_list;
+  }
+  if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
+  {
+    free_resinfo(arg5);
+  }
+  {
+    free_resinfo(arg6);
+  }
+  {
+    free_resinfo(arg7);
+  }
+  return resultobj;
+fail:
+  if (alloc4 == SWIG_NEWOBJ) free((char*)buf4);
+  {
+    free_resinfo(arg5);
+  }
+  {
+    free_resinfo(arg6);
+  }
+  {
+    free_resinfo(arg7);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_region_cull_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  int arg4 ;
+  double arg5 ;
+  double arg6 ;
+  double arg7 ;
+  double arg8 ;
+  double arg9 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOO:region_cull_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  {
+    arg5 = PyFloat_AsDouble (obj4);
+  }
+  {
+    arg6 = PyFloat_AsDouble (obj5);
+  }
+  {
+    arg7 = PyFloat_AsDouble (obj6);
+  }
+  {
+    arg8 = PyFloat_AsDouble (obj7);
+  }
+  {
+    arg9 = PyFloat_AsDouble (obj8);
+  }
+  result = (PyObject *)region_cull_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_decimate_xy_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  double arg4 ;
+  double arg5 ;
+  int arg6 ;
+  int arg7 ;
+  int arg8 ;
+  double arg9 ;
+  int arg10 ;
+  double arg11 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  PyObject * obj10 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOOOO:decimate_xy_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  {
+    arg4 = PyFloat_AsDouble (obj3);
+  }
+  {
+    arg5 = PyFloat_AsDouble (obj4);
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  {
+    arg7 = (int) PyInt_AsLong (obj6);
+  }
+  {
+    arg8 = (int) PyInt_AsLong (obj7);
+  }
+  {
+    arg9 = PyFloat_AsDouble (obj8);
+  }
+  {
+    arg10 = (int) PyInt_AsLong (obj9);
+  }
+  {
+    arg11 = PyFloat_AsDouble (obj10);
+  }
+  result = (PyObject *)decimate_xy_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_histogram2d_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  int arg4 ;
+  int arg5 ;
+  double arg6 ;
+  double arg7 ;
+  double arg8 ;
+  double arg9 ;
+  int arg10 ;
+  double arg11 ;
+  int arg12 ;
+  double arg13 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  PyObject * obj10 = 0 ;
+  PyObject * obj11 = 0 ;
+  PyObject * obj12 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOOOOOO:histogram2d_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10,&obj11,&obj12)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arg6 = PyFloat_AsDouble (obj5);
+  }
+  {
+    arg7 = PyFloat_AsDouble (obj6);
+  }
+  {
+    arg8 = PyFloat_AsDouble (obj7);
+  }
+  {
+    arg9 = PyFloat_AsDouble (obj8);
+  }
+  {
+    arg10 = (int) PyInt_AsLong (obj9);
+  }
+  {
+    arg11 = PyFloat_AsDouble (obj10);
+  }
+  {
+    arg12 = (int) PyInt_AsLong (obj11);
+  }
+  {
+    arg13 = PyFloat_AsDouble (obj12);
+  }
+  result = (PyObject *)histogram2d_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_raster_fill_wrap(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  int arg2 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  int arg5 ;
+  double arg6 ;
+  double arg7 ;
+  double arg8 ;
+  double arg9 ;
+  int arg10 ;
+  double *arg11 = (double *) 0 ;
+  int arg12 ;
+  int *arg13 = (int *) 0 ;
+  int arg14 ;
+  double arg15 ;
+  int arg16 ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr11 = NULL ;
+  PyArrayObject *arr13 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  PyObject * obj10 = 0 ;
+  PyObject * obj11 = 0 ;
+  PyObject * obj12 = 0 ;
+  PyObject * obj13 = 0 ;
+  PyObject * obj14 = 0 ;
+  PyObject * obj15 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOOOOOOOOO:raster_fill_wrap",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9,&obj10,&obj11,&obj12,&obj13,&obj14,&obj15)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arg2 = (int) PyInt_AsLong (obj1);
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arg6 = PyFloat_AsDouble (obj5);
+  }
+  {
+    arg7 = PyFloat_AsDouble (obj6);
+  }
+  {
+    arg8 = PyFloat_AsDouble (obj7);
+  }
+  {
+    arg9 = PyFloat_AsDouble (obj8);
+  }
+  {
+    arg10 = (int) PyInt_AsLong (obj9);
+  }
+  {
+    arr11 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj10,PyArray_DOUBLE,0,0);
+    if (arr11 == NULL) SWIG_fail;
+    arg11 = (double *) arr11->data;
+  }
+  {
+    arg12 = (int) PyInt_AsLong (obj11);
+  }
+  {
+    arr13 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj12,PyArray_INT,0,0);
+    if (arr13 == NULL) SWIG_fail;
+    arg13 = (int *) arr13->data;
+  }
+  {
+    arg14 = (int) PyInt_AsLong (obj13);
+  }
+  {
+    arg15 = PyFloat_AsDouble (obj14);
+  }
+  {
+    arg16 = (int) PyInt_AsLong (obj15);
+  }
+  result = (int)raster_fill_wrap(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10,arg11,arg12,arg13,arg14,arg15,arg16);
+  resultobj = SWIG_From_int((int)(result));
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr11);
+  }
+  {
+    Py_XDECREF(arr13);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr11);
+  }
+  {
+    Py_XDECREF(arr13);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_png_to_rgba_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:png_to_rgba_p",&obj0)) SWIG_fail;
+  arg1 = obj0;
+  result = (PyObject *)png_to_rgba_p(arg1);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_load_colormap_files(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)":load_colormap_files")) SWIG_fail;
+  result = (int)load_colormap_files();
+  resultobj = SWIG_From_int((int)(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_compile_rlist_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:compile_rlist_p",&obj0)) SWIG_fail;
+  arg1 = obj0;
+  result = (PyObject *)compile_rlist_p(arg1);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_set_nglRes_defaults(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:set_nglRes_defaults",&obj0)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  set_nglRes_defaults(arg1);
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_set_nglRes_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject * obj0 = 0 ;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:set_nglRes_p",&obj0)) SWIG_fail;
+  arg1 = obj0;
+  result = (int)set_nglRes_p(arg1);
+  resultobj = SWIG_From_int((int)(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_set_stats(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  PyObject * obj0 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"O:set_stats",&obj0)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  set_stats(arg1);
+  resultobj = SWIG_Py_Void();
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_get_stats_level(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int result;
+  
+  if (!PyArg_ParseTuple(args,(char *)":get_stats_level")) SWIG_fail;
+  result = (int)get_stats_level();
+  resultobj = SWIG_From_int((int)(result));
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_get_stats_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)":get_stats_p")) SWIG_fail;
+  result = (PyObject *)get_stats_p();
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_get_trace_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)":get_trace_p")) SWIG_fail;
+  result = (PyObject *)get_trace_p();
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_gc_dist_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  int arg6 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOO:gc_dist_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  result = (PyObject *)gc_dist_p(arg1,arg2,arg3,arg4,arg5,arg6);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_gc_azim_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:gc_azim_p",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  result = (PyObject *)gc_azim_p(arg1,arg2,arg3,arg4,arg5);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_gc_dest_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  int arg6 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOO:gc_dest_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  result = (PyObject *)gc_dest_p(arg1,arg2,arg3,arg4,arg5,arg6);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_gc_dist_pairs_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  double *arg2 = (double *) 0 ;
+  int arg3 ;
+  double *arg4 = (double *) 0 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  int arg7 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyArrayObject *arr5 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOO:gc_dist_pairs_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arr5 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj4,PyArray_DOUBLE,0,0);
+    if (arr5 == NULL) SWIG_fail;
+    arg5 = (double *) arr5->data;
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  {
+    arg7 = (int) PyInt_AsLong (obj6);
+  }
+  result = (PyObject *)gc_dist_pairs_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  {
+    Py_XDECREF(arr5);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  {
+    Py_XDECREF(arr5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_c_wmbarbs(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  double *arg4 = (double *) 0 ;
+  double *arg5 = (double *) 0 ;
+  int arg6 ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyArrayObject *arr5 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOO:c_wmbarbs",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arr5 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj4,PyArray_DOUBLE,0,0);
+    if (arr5 == NULL) SWIG_fail;
+    arg5 = (double *) arr5->data;
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  c_wmbarbs(arg1,arg2,arg3,arg4,arg5,arg6);
+  resultobj = SWIG_Py_Void();
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  {
+    Py_XDECREF(arr5);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  {
+    Py_XDECREF(arr5);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_wmstnms_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  PyObject *arg5 = (PyObject *) 0 ;
+  double arg6 ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyObject *result = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOO:wmstnms_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  arg5 = obj4;
+  {
+    arg6 = PyFloat_AsDouble (obj5);
+  }
+  result = (PyObject *)wmstnms_p(arg1,arg2,arg3,arg4,arg5,arg6);
+  resultobj = result;
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_dcapethermo_cols_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  double *arg1 = (double *) 0 ;
+  int arg2 ;
+  double *arg3 = (double *) 0 ;
+  double *arg4 = (double *) 0 ;
+  int arg5 ;
+  int arg6 ;
+  double arg7 ;
+  PyArrayObject *arr1 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr4 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOO:dcapethermo_cols_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6)) SWIG_fail;
+  {
+    arr1 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj0,PyArray_DOUBLE,0,0);
+    if (arr1 == NULL) SWIG_fail;
+    arg1 = (double *) arr1->data;
+  }
+  {
+    arg2 = (int) PyInt_AsLong (obj1);
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arr4 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj3,PyArray_DOUBLE,0,0);
+    if (arr4 == NULL) SWIG_fail;
+    arg4 = (double *) arr4->data;
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  {
+    arg7 = PyFloat_AsDouble (obj6);
+  }
+  result = (PyObject *)dcapethermo_cols_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  resultobj = result;
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr1);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr4);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_skewt_thermo_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:skewt_thermo_p",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  result = (PyObject *)skewt_thermo_p(arg1,arg2,arg3,arg4);
+  resultobj = result;
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_nn_weights_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  int arg4 ;
+  int arg5 ;
+  double *arg6 = (double *) 0 ;
+  double *arg7 = (double *) 0 ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyArrayObject *arr6 = NULL ;
+  PyArrayObject *arr7 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOO:nn_weights_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  {
+    arr6 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj5,PyArray_DOUBLE,0,0);
+    if (arr6 == NULL) SWIG_fail;
+    arg6 = (double *) arr6->data;
+  }
+  {
+    arr7 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj6,PyArray_DOUBLE,0,0);
+    if (arr7 == NULL) SWIG_fail;
+    arg7 = (double *) arr7->data;
+  }
+  result = (PyObject *)nn_weights_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7);
+  resultobj = result;
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr6);
+  }
+  {
+    Py_XDECREF(arr7);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  {
+    Py_XDECREF(arr6);
+  }
+  {
+    Py_XDECREF(arr7);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_nn_apply_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  int arg3 ;
+  double arg4 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOO:nn_apply_p",&obj0,&obj1,&obj2,&obj3)) SWIG_fail;
+  arg1 = obj0;
+  arg2 = obj1;
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  {
+    arg4 = PyFloat_AsDouble (obj3);
+  }
+  result = (PyObject *)nn_apply_p(arg1,arg2,arg3,arg4);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_css_fit_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  double *arg2 = (double *) 0 ;
+  double *arg3 = (double *) 0 ;
+  PyArrayObject *arr2 = NULL ;
+  PyArrayObject *arr3 = NULL ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:css_fit_p",&obj0,&obj1,&obj2)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arr2 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj1,PyArray_DOUBLE,0,0);
+    if (arr2 == NULL) SWIG_fail;
+    arg2 = (double *) arr2->data;
+  }
+  {
+    arr3 =
+    (PyArrayObject *) PyArray_ContiguousFromAny(obj2,PyArray_DOUBLE,0,0);
+    if (arr3 == NULL) SWIG_fail;
+    arg3 = (double *) arr3->data;
+  }
+  result = (PyObject *)css_fit_p(arg1,arg2,arg3);
+  resultobj = result;
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  return resultobj;
+fail:
+  {
+    Py_XDECREF(arr2);
+  }
+  {
+    Py_XDECREF(arr3);
+  }
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_css_grads_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  int arg3 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOO:css_grads_p",&obj0,&obj1,&obj2)) SWIG_fail;
+  arg1 = obj0;
+  arg2 = obj1;
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  result = (PyObject *)css_grads_p(arg1,arg2,arg3);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_css_eval_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  PyObject *arg1 = (PyObject *) 0 ;
+  PyObject *arg2 = (PyObject *) 0 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  int arg4 ;
+  PyObject *arg5 = (PyObject *) 0 ;
+  PyObject *arg6 = (PyObject *) 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOO:css_eval_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5)) SWIG_fail;
+  arg1 = obj0;
+  arg2 = obj1;
+  arg3 = obj2;
+  {
+    arg4 = (int) PyInt_AsLong (obj3);
+  }
+  arg5 = obj4;
+  arg6 = obj5;
+  result = (PyObject *)css_eval_p(arg1,arg2,arg3,arg4,arg5,arg6);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_ftcurv_n_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  int arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
+  PyObject *arg5 = (PyObject *) 0 ;
+  int arg6 ;
+  double arg7 ;
+  double arg8 ;
+  int arg9 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOO:ftcurv_n_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arg2 = (int) PyInt_AsLong (obj1);
+  }
+  arg3 = obj2;
+  arg4 = obj3;
+  arg5 = obj4;
+  {
+    arg6 = (int) PyInt_AsLong (obj5);
+  }
+  {
+    arg7 = PyFloat_AsDouble (obj6);
+  }
+  {
+    arg8 = PyFloat_AsDouble (obj7);
+  }
+  {
+    arg9 = (int) PyInt_AsLong (obj8);
+  }
+  result = (PyObject *)ftcurv_n_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_ndc_transform_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  int arg1 ;
+  int arg2 ;
+  PyObject *arg3 = (PyObject *) 0 ;
+  PyObject *arg4 = (PyObject *) 0 ;
+  PyObject *arg5 = (PyObject *) 0 ;
+  PyObject *arg6 = (PyObject *) 0 ;
+  double arg7 ;
+  double arg8 ;
+  int arg9 ;
+  int arg10 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject * obj5 = 0 ;
+  PyObject * obj6 = 0 ;
+  PyObject * obj7 = 0 ;
+  PyObject * obj8 = 0 ;
+  PyObject * obj9 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOOOOOOO:ndc_transform_p",&obj0,&obj1,&obj2,&obj3,&obj4,&obj5,&obj6,&obj7,&obj8,&obj9)) SWIG_fail;
+  {
+    arg1 = (int) PyInt_AsLong (obj0);
+  }
+  {
+    arg2 = (int) PyInt_AsLong (obj1);
+  }
+  arg3 = obj2;
+  arg4 = obj3;
+  arg5 = obj4;
+  arg6 = obj5;
+  {
+    arg7 = PyFloat_AsDouble (obj6);
+  }
+  {
+    arg8 = PyFloat_AsDouble (obj7);
+  }
+  {
+    arg9 = (int) PyInt_AsLong (obj8);
+  }
+  {
+    arg10 = (int) PyInt_AsLong (obj9);
+  }
+  result = (PyObject *)ndc_transform_p(arg1,arg2,arg3,arg4,arg5,arg6,arg7,arg8,arg9,arg10);
+  resultobj = result;
+  return resultobj;
+fail:
+  return NULL;
+}
+
+
+SWIGINTERN PyObject *_wrap_asciiread_p(PyObject *SWIGUNUSEDPARM(self), PyObject *args) {
+  PyObject *resultobj = 0;
+  char *arg1 = (char *) 0 ;
+  char *arg2 = (char *) 0 ;
+  int arg3 ;
+  PyObject *arg4 = (PyObject *) 0 ;
+  int arg5 ;
+  int res1 ;
+  char *buf1 = 0 ;
+  int alloc1 = 0 ;
+  int res2 ;
+  char *buf2 = 0 ;
+  int alloc2 = 0 ;
+  PyObject * obj0 = 0 ;
+  PyObject * obj1 = 0 ;
+  PyObject * obj2 = 0 ;
+  PyObject * obj3 = 0 ;
+  PyObject * obj4 = 0 ;
+  PyObject *result = 0 ;
+  
+  if (!PyArg_ParseTuple(args,(char *)"OOOOO:asciiread_p",&obj0,&obj1,&obj2,&obj3,&obj4)) SWIG_fail;
+  res1 = SWIG_AsCharPtrAndSize(obj0, &buf1, NULL, &alloc1);
+  if (!SWIG_IsOK(res1)) {
+    SWIG_exception_fail(SWIG_ArgError(res1), "in method '" "asciiread_p" "', argument " "1"" of type '" "char *""'");
+  }
+  arg1 = (char *)(buf1);
+  res2 = SWIG_AsCharPtrAndSize(obj1, &buf2, NULL, &alloc2);
+  if (!SWIG_IsOK(res2)) {
+    SWIG_exception_fail(SWIG_ArgError(res2), "in method '" "asciiread_p" "', argument " "2"" of type '" "char *""'");
+  }
+  arg2 = (char *)(buf2);
+  {
+    arg3 = (int) PyInt_AsLong (obj2);
+  }
+  arg4 = obj3;
+  {
+    arg5 = (int) PyInt_AsLong (obj4);
+  }
+  result = (PyObject *)asciiread_p(arg1,arg2,arg3,arg4,arg5);
+  resultobj = result;
+  if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
+  if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
+  return resultobj;
+fail:
+  if (alloc1 == SWIG_NEWOBJ) free((char*)buf1);
+  if (alloc2 == SWIG_NEWOBJ) free((char*)buf2);
+  return NULL;
+}
+
+
 static PyMethodDef SwigMethods[] = {
 	 { (char *)"SWIG_PyInstanceMethod_New", (PyCFunction)SWIG_PyInstanceMethod_New, METH_O, NULL},
 	 { (char *)"new_intp", _wrap_new_intp, METH_VARARGS, NULL},
@@ -36338,6 +23594,42 @@ static PyMethodDef SwigMethods[] = {
 	 { (char *)"set_nglRes_s", _wrap_set_nglRes_s, METH_VARARGS, NULL},
 	 { (char *)"get_nglRes_s", _wrap_get_nglRes_s, METH_VARARGS, NULL},
 	 { (char *)"NglGaus_p", _wrap_NglGaus_p, METH_VARARGS, NULL},
+	 { (char *)"update_scalar_field_wrap", _wrap_update_scalar_field_wrap, METH_VARARGS, NULL},
+	 { (char *)"update_vector_field_wrap", _wrap_update_vector_field_wrap, METH_VARARGS, NULL},
+	 { (char *)"panel_layout_p", _wrap_panel_layout_p, METH_VARARGS, NULL},
+	 { (char *)"create_mesh", _wrap_create_mesh, METH_VARARGS, NULL},
+	 { (char *)"destroy_mesh", _wrap_destroy_mesh, METH_VARARGS, NULL},
+	 { (char *)"contour_mesh_wrap", _wrap_contour_mesh_wrap, METH_VARARGS, NULL},
+	 { (char *)"contour_map_mesh_wrap", _wrap_contour_map_mesh_wrap, METH_VARARGS, NULL},
+	 { (char *)"region_cull_p", _wrap_region_cull_p, METH_VARARGS, NULL},
+	 { (char *)"decimate_xy_p", _wrap_decimate_xy_p, METH_VARARGS, NULL},
+	 { (char *)"histogram2d_p", _wrap_histogram2d_p, METH_VARARGS, NULL},
+	 { (char *)"raster_fill_wrap", _wrap_raster_fill_wrap, METH_VARARGS, NULL},
+	 { (char *)"png_to_rgba_p", _wrap_png_to_rgba_p, METH_VARARGS, NULL},
+	 { (char *)"load_colormap_files", _wrap_load_colormap_files, METH_VARARGS, NULL},
+	 { (char *)"compile_rlist_p", _wrap_compile_rlist_p, METH_VARARGS, NULL},
+	 { (char *)"set_nglRes_defaults", _wrap_set_nglRes_defaults, METH_VARARGS, NULL},
+	 { (char *)"set_nglRes_p", _wrap_set_nglRes_p, METH_VARARGS, NULL},
+	 { (char *)"set_stats", _wrap_set_stats, METH_VARARGS, NULL},
+	 { (char *)"get_stats_level", _wrap_get_stats_level, METH_VARARGS, NULL},
+	 { (char *)"get_stats_p", _wrap_get_stats_p, METH_VARARGS, NULL},
+	 { (char *)"get_trace_p", _wrap_get_trace_p, METH_VARARGS, NULL},
+	 { (char *)"gc_dist_p", _wrap_gc_dist_p, METH_VARARGS, NULL},
+	 { (char *)"gc_azim_p", _wrap_gc_azim_p, METH_VARARGS, NULL},
+	 { (char *)"gc_dest_p", _wrap_gc_dest_p, METH_VARARGS, NULL},
+	 { (char *)"gc_dist_pairs_p", _wrap_gc_dist_pairs_p, METH_VARARGS, NULL},
+	 { (char *)"c_wmbarbs", _wrap_c_wmbarbs, METH_VARARGS, NULL},
+	 { (char *)"wmstnms_p", _wrap_wmstnms_p, METH_VARARGS, NULL},
+	 { (char *)"dcapethermo_cols_p", _wrap_dcapethermo_cols_p, METH_VARARGS, NULL},
+	 { (char *)"skewt_thermo_p", _wrap_skewt_thermo_p, METH_VARARGS, NULL},
+	 { (char *)"nn_weights_p", _wrap_nn_weights_p, METH_VARARGS, NULL},
+	 { (char *)"nn_apply_p", _wrap_nn_apply_p, METH_VARARGS, NULL},
+	 { (char *)"css_fit_p", _wrap_css_fit_p, METH_VARARGS, NULL},
+	 { (char *)"css_grads_p", _wrap_css_grads_p, METH_VARARGS, NULL},
+	 { (char *)"css_eval_p", _wrap_css_eval_p, METH_VARARGS, NULL},
+	 { (char *)"ftcurv_n_p", _wrap_ftcurv_n_p, METH_VARARGS, NULL},
+	 { (char *)"ndc_transform_p", _wrap_ndc_transform_p, METH_VARARGS, NULL},
+	 { (char *)"asciiread_p", _wrap_asciiread_p, METH_VARARGS, NULL},
 	 { NULL, NULL, 0, NULL }
 };
 
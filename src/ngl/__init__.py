@@ -8,39 +8,46 @@ NCL Graphics Libraries," and it is pronounced "pingle."
 
 __all__ = ['add_annotation', 'add_cyclic', 'add_new_coord_limits', \
            'add_lat_90','add_polygon', 'add_polyline', 'add_polymarker', \
-           'add_text', 'asciiread', 'betainc', 'blank_plot', \
+           'add_text', 'asciiread', 'betainc', 'blank_plot', 'cape_thermo', \
            'change_workstation', 'chiinv', 'clear_workstation', 'contour', \
            'contour_map', 'datatondc', 'define_colormap', 'delete_wks', \
            'destroy', 'dim_gbits', 'draw', 'draw_colormap', \
-           'draw_color_palette', 'draw_ndc_grid', \
-           'end', 'frame', 'free_color', 'fspan', 'ftcurv', 'ftcurvp', \
-           'ftcurvpi', 'gaus', 'gc_convert', 'gc_dist', 'gc_inout', \
+           'draw_color_palette', 'draw_ndc_grid', 'enable_stats', \
+           'end', 'frame', 'free_color', 'fspan', 'ftcurv', 'ftcurv_n', \
+           'ftcurvp', 'ftcurvp_n', 'ftcurvpi', 'ftcurvpi_n', 'gaus', \
+           'gc_azimuth', 'gc_convert', 'gc_destination', \
+           'gc_dist', 'gc_dist_matrix', 'gc_inout', \
            'gc_interp', 'gc_qarea', 'gc_tarea', 'generate_2d_array', \
            'get_MDfloat_array', 'get_MDinteger_array', \
            'get_bounding_box', 'get_float', 'get_float_array', \
-           'get_integer', 'get_integer_array', 'get_named_color_index', \
-           'get_string', 'get_string_array', 'get_workspace_id', \
+           'get_images', 'get_integer', 'get_integer_array', 'get_named_color_index', \
+           'get_stats', 'get_string', 'get_string_array', 'get_workspace_id', \
            'hlsrgb', 'hsvrgb', 'ind', 'int2p', 'labelbar_ndc', 'legend_ndc', \
-           'linmsg', 'map', 'maximize_plot', 'merge_colormaps', \
-           'natgrid', 'ndctodata', 'nearlyequal', 'new_color', \
+           'linmsg', 'map', 'maximize_plot', 'merge_colormaps', 'mesh', \
+           'natgrid', 'natgrid_interpolator', 'ndctodata', 'nearlyequal', 'new_color', \
            'new_dash_pattern', \
            'new_marker', 'nice_cntr_levels','nngetp', 'nnsetp', \
-           'normalize_angle', 'open_wks', 'overlay', 'panel', 'polygon', \
+           'normalize_angle', 'open_wks', 'overlay', 'panel', 'plot_transform', \
+           'polygon', \
            'polygon_ndc', 'polyline', 'polyline_ndc', 'polymarker', \
            'polymarker_ndc', 'pynglpath', \
            'read_colormap_file', 'regline', 'remove_annotation', \
+           'render_frames', \
            'remove_overlay', 'retrieve_colormap', 'rgbhls', 'rgbhsv', \
            'rgbyiq', 'set_color', 'set_values', 'skewt_bkg', \
-           'skewt_plt', 'streamline', 'streamline_map', \
+           'skewt_plt', 'sphere_surface', 'streamline', 'streamline_map', \
            'streamline_scalar', 'streamline_scalar_map', 'taylor_diagram', \
            'text', \
-           'text_ndc', 'update_workstation', 'vector', 'vector_map', \
+           'text_ndc', 'update_contour_data', 'update_streamline_data', \
+           'update_vector_data', 'update_workstation', 'vector', 'vector_map', \
            'vector_scalar', 'vector_scalar_map', 'vinth2p', 'wmbarb', \
-           'wmbarbmap', 'wmgetp', 'wmsetp', 'wmstnm', 'wrf_avo', \
+           'wmbarbmap', 'wmgetp', 'wmsetp', 'wmstnm', 'wmstnm_encode', \
+           'wrf_avo', \
            'wrf_dbz', 'wrf_ij_to_ll', 'wrf_ll_to_ij', \
            'wrf_map_resources', 'wrf_pvo', 'wrf_rh', 'wrf_slp', \
            'wrf_td', 'wrf_tk', 'xy', 'y', 'yiqrgb', \
-           'PlotIds', 'Resources', '__version__']
+           'Mesh', 'PlotIds', 'RenderPool', 'ResourceList', 'Resources', \
+           'WorkstationPool', '__version__']
 
 # So we can get path to PyNGL ancillary files
 from distutils.sysconfig import get_python_lib
@@ -422,12 +429,439 @@ if (not (os.path.exists(pkgs_pth)) and os.environ.get("PYNGL_NCARG") is None):
 
 first_call_to_open_wks = 0
 
+#
+#  Temporary directories of the workstations opened with
+#  nglImageInMemory, keyed by workstation id. Any that are left when
+#  Python exits are removed then. The PNG driver only writes files,
+#  so the directories go in the RAM-backed _image_shm_dir if it can
+#  be written to, and in the system temporary directory otherwise.
+#
+_image_wks_dirs = {}
+_image_shm_dir  = "/dev/shm"
+
+def _remove_image_dir(image_dir):
+  import shutil
+  shutil.rmtree(image_dir,ignore_errors=True)
+
+def _remove_image_dirs():
+  for image_dir in list(_image_wks_dirs.values()):
+    _remove_image_dir(image_dir)
+  _image_wks_dirs.clear()
+
+import atexit
+atexit.register(_remove_image_dirs)
+
+#
+#  All the colormap files are loaded into the HLU palette when the
+#  first workstation is opened, unless PYNGL_LAZY_COLORMAPS is set.
+#  Then NCARG_COLORMAPS is pointed, once, at a private directory of
+#  this process, and a colormap file is linked into it and loaded only
+#  when a resource passed to PyNGL first refers to its colormap by
+#  name. _cmap_files maps each colormap name to its file, found in the
+#  directories NCARG_COLORMAPS named before (_cmap_env), and is built
+#  the first time it's needed. The directory is removed and
+#  NCARG_COLORMAPS restored when Python exits.
+#
+_lazy_colormaps = os.environ.get("PYNGL_LAZY_COLORMAPS") is not None
+_cmap_files     = None
+_cmaps_loaded   = set()
+_cmap_dir       = None     # (process id, directory)
+_cmap_env       = None
+_hlu_started    = False
+
+def _colormap_dir():
+#
+#  Return this process's colormap directory, creating it and pointing
+#  NCARG_COLORMAPS at it the first time. A process forked from this
+#  one, like a RenderPool worker, makes a directory of its own.
+#
+  global _cmap_dir, _cmap_env
+  if (_cmap_dir is None or _cmap_dir[0] != os.getpid()):
+    import tempfile
+    if (_cmap_dir is None):
+      _cmap_env = os.environ.get("NCARG_COLORMAPS")
+    _cmap_dir = (os.getpid(),tempfile.mkdtemp(prefix="pyngl_cmap"))
+    os.environ["NCARG_COLORMAPS"] = _cmap_dir[1]
+  return _cmap_dir[1]
+
+def _clear_colormap_dir():
+#
+#  Remove the links to colormap files that have been loaded, so the
+#  next load doesn't read them again.
+#
+  if (_cmap_dir is not None and _cmap_dir[0] == os.getpid()):
+    for fname in os.listdir(_cmap_dir[1]):
+      os.remove(os.path.join(_cmap_dir[1],fname))
+
+def _remove_colormap_dir():
+  global _cmap_dir
+  if (_cmap_dir is not None and _cmap_dir[0] == os.getpid()):
+    _remove_image_dir(_cmap_dir[1])
+    _cmap_dir = None
+    if (_cmap_env is None):
+      os.environ.pop("NCARG_COLORMAPS",None)
+    else:
+      os.environ["NCARG_COLORMAPS"] = _cmap_env
+
+atexit.register(_remove_colormap_dir)
+
+#
+#  Turn on the plotting call statistics (see enable_stats) if asked
+#  for in the environment.
+#
+if (not os.environ.get("PYNGL_STATS") is None):
+  if (os.environ["PYNGL_STATS"].lower() == "trace"):
+    set_stats(2)
+  else:
+    set_stats(1)
+
 class Resources:
   pass
 
+class ResourceList:
+  """
+A snapshot of a Resources object. Ngl.set_values converts it to an
+HLU resource list the first time it is used and reuses that list on
+every later call. The plotting functions accept it in place of a
+Resources object, but they still convert the resources on each call;
+they only skip reading them back out of the object's attributes.
+
+rlist = Ngl.ResourceList(res)
+
+res -- An instance of the Resources class. Changes made to res after
+       the ResourceList is created are not seen by it.
+  """
+  def __init__(self,res=None):
+    self._dict = {}
+    if (res is not None):
+      for t in dir(res):
+        if (t[0:2] != '__'):
+          self._dict[t] = getattr(res,t)
+    self._compiled = None
+
+  def __getattr__(self,name):
+#
+#  Resources can still be read as attributes, as they are from a
+#  Resources object.
+#
+    try:
+      return self.__dict__["_dict"][name]
+    except KeyError:
+      raise AttributeError(name)
+
+  def _set_values_rlist(self):
+#
+#  The HLU resource list for set_values is built the first time it's
+#  needed (the HLU library has to be initialized by then) and kept.
+#
+    if (self._compiled is None):
+      self._compiled = compile_rlist_p(self._dict)
+    return self._compiled
+
 class PlotIds:
   pass
 
+class Mesh:
+  """
+An unstructured mesh, created with Ngl.mesh, that can be shared by
+any number of contour plots of 1D data on it.
+  """
+  def __init__(self,id,npts):
+    self.id   = id
+    self.npts = npts
+
+  def destroy(self):
+    if (self.id >= 0):
+      destroy_mesh(self.id)
+      self.id = -1
+
+class NatgridInterpolator:
+  """
+Natural neighbor weights from scattered points to an output grid,
+created with Ngl.natgrid_interpolator, that can be applied to any
+number of fields at those points. Its outside attribute is the number
+of output points outside the convex hull of the input points, which
+get the fill value.
+  """
+  def __init__(self,weights,npts,nxo,nyo,fill):
+    self.weights = weights
+    self.npts    = npts
+    self.nxo     = nxo
+    self.nyo     = nyo
+    self.fill    = fill
+    self.outside = 0
+
+  def interpolate(self,z):
+    """
+Interpolates one or more fields to the output grid.
+
+zo = interp.interpolate(z)
+
+z -- An array whose last dimension is the number of input points,
+     holding one field or a stack of them. The result has the same
+     leading dimensions, followed by numxout x numyout. It is
+     float32 if z is float32, and float64 otherwise.
+    """
+    z2 = numpy.asarray(z)
+    if (len(z2.shape) == 0 or z2.shape[-1] != self.npts):
+      print("interpolate: the last dimension of z must be %d" % (self.npts))
+      return None
+    nfld = z2.size//self.npts
+    zo = nn_apply_p(self.weights,z2,nfld,self.fill)
+    if (zo is None):
+      return None
+    zo = zo.reshape(z2.shape[:-1] + (self.nxo,self.nyo))
+    if (z2.dtype == numpy.float32):
+      return zo.astype(numpy.float32)
+    return zo
+
+class SphereSurface:
+  """
+A smooth surface through randomly spaced points on the sphere,
+created with Ngl.sphere_surface, that can be given new values at
+those points and evaluated anywhere without triangulating them again.
+  """
+  def __init__(self,surf,npts,f=None):
+    self.surf  = surf
+    self.npts  = npts
+    self.shape = None
+    if (f is not None):
+      self.set_values(f)
+
+  def set_values(self,f):
+    """
+Gives the surface new values at its points, and estimates their
+gradients.
+
+surf.set_values(f)
+
+f -- An array whose last dimension is the number of input points,
+     holding one field or a stack of them.
+    """
+    f2 = numpy.asarray(f)
+    if (len(f2.shape) == 0 or f2.shape[-1] != self.npts):
+      print("set_values: the last dimension of f must be %d" % (self.npts))
+      return
+    nfld = f2.size//self.npts
+    g = css_grads_p(self.surf,f2,nfld)
+    if (g is None):
+      return
+    self.f     = numpy.ascontiguousarray(f2,dtype=numpy.float64)
+    self.g     = g
+    self.nfld  = nfld
+    self.shape = f2.shape[:-1]
+    self.dtype = f2.dtype
+
+  def points(self,plat,plon):
+    """
+Evaluates the fields at any number of points.
+
+fo = surf.points(plat, plon)
+
+plat, plon -- Arrays of the same shape with the latitudes and
+              longitudes, in degrees, of the output points. The
+              result has the leading dimensions of the values given
+              to set_values, followed by the shape of plat. It is
+              float32 if the values were float32, and float64
+              otherwise.
+    """
+    if (self.shape is None):
+      print("points: the surface has no values; use set_values first")
+      return None
+    plat2 = numpy.asarray(plat,dtype=numpy.float64)
+    plon2 = numpy.asarray(plon,dtype=numpy.float64)
+    if (plat2.shape != plon2.shape):
+      print("points: plat and plon must be the same shape")
+      return None
+    fo = css_eval_p(self.surf,self.f,self.g,self.nfld,plat2,plon2)
+    if (fo is None):
+      return None
+    fo = fo.reshape(self.shape + plat2.shape)
+    if (self.dtype == numpy.float32):
+      return fo.astype(numpy.float32)
+    return fo
+
+  def grid(self,plat,plon):
+    """
+Evaluates the fields on a latitude/longitude grid.
+
+fo = surf.grid(plat, plon)
+
+plat, plon -- One-dimensional arrays (of length numlat and numlon)
+              with the latitudes and longitudes, in degrees, of the
+              output grid. The result has the leading dimensions of
+              the values given to set_values, followed by numlat x
+              numlon.
+    """
+    plat2 = numpy.ravel(numpy.asarray(plat,dtype=numpy.float64))
+    plon2 = numpy.ravel(numpy.asarray(plon,dtype=numpy.float64))
+    lat2d = numpy.repeat(plat2[:,numpy.newaxis],len(plon2),axis=1)
+    lon2d = numpy.repeat(plon2[numpy.newaxis,:],len(plat2),axis=0)
+    return self.points(lat2d,lon2d)
+
+class PlotTransform:
+  """
+The transformation between data and NDC space of a plot, created with
+Ngl.plot_transform, for converting many points at once or the same
+plot's points over and over.
+  """
+  _linear_classes = ("xyPlotClass", "contourPlotClass", "vectorPlotClass",
+                     "streamlinePlotClass", "logLinPlotClass")
+
+  def __init__(self,plot):
+    self.plot = _int_id(plot)
+    self.refresh()
+
+  def refresh(self):
+    """
+Gets the transformation again, after the plot's viewport or data
+limits have changed (as they do when a plot is maximized or drawn
+in a panel).
+
+trans.refresh()
+    """
+    xo = numpy.empty(1,numpy.float32)
+    yo = numpy.empty(1,numpy.float32)
+    far = numpy.array([1.e6],numpy.float32)
+    error,status,self.out_of_range = \
+       ndc_transform_p(self.plot,1,far,far,xo,yo,0.,0.,0,0)
+    self.linear = None
+    if (NhlClassName(self.plot) in self._linear_classes):
+      self.linear = self._linear_params()
+
+  def _linear_params(self):
+#
+# A plot with a linear or logarithmic transformation is done here
+# in double precision, from its viewport and data limits, if that
+# agrees with the HLU transformation.
+#
+    vpx,vpy,vpw,vph = [get_float(self.plot,r) for r in \
+                       ("vpXF","vpYF","vpWidthF","vpHeightF")]
+    lims = [get_float(self.plot,r) for r in \
+            ("trXMinF","trXMaxF","trYMinF","trYMaxF")]
+    xlog,ylog,xrev,yrev = [get_integer(self.plot,r) for r in \
+                           ("trXLog","trYLog","trXReverse","trYReverse")]
+    params = []
+    for amin,amax,log,rev,org,size in \
+        ((lims[0],lims[1],xlog,xrev,vpx,vpw),
+         (lims[2],lims[3],ylog,yrev,vpy-vph,vph)):
+      if (log and (amin <= 0. or amax <= 0.)) or (amax <= amin):
+        return None
+      fmin,fmax = (math.log10(amin),math.log10(amax)) if log else (amin,amax)
+      if rev:
+        scale = -size/(fmax-fmin)
+        params.append((org - scale*fmax,scale,log,amin,amax))
+      else:
+        scale = size/(fmax-fmin)
+        params.append((org - scale*fmin,scale,log,amin,amax))
+    self.linear = params
+#
+# Check it against the HLU transformation at a few points.
+#
+    f = numpy.array([0.1,0.5,0.9])
+    px,py = [p[3] + f*(p[4]-p[3]) if not p[2] else \
+             10.**(math.log10(p[3]) + f*(math.log10(p[4])-math.log10(p[3]))) \
+             for p in params]
+    px,py = numpy.meshgrid(px,py)
+    xh = numpy.empty(px.shape,numpy.float32)
+    yh = numpy.empty(px.shape,numpy.float32)
+    ndc_transform_p(self.plot,0,px,py,xh,yh,0.,0.,0,0)
+    xl,yl = self._linear(0,px,py,None,None)
+    if (numpy.abs(xl-xh).max() > 1.e-4 or numpy.abs(yl-yh).max() > 1.e-4):
+      return None
+    return params
+
+  def _linear(self,todata,x,y,fvx,fvy):
+    out = []
+    bad = numpy.zeros(x.shape,bool)
+    with numpy.errstate(divide="ignore",invalid="ignore",over="ignore"):
+      for v,fv,(off,scale,log,amin,amax) in ((x,fvx,self.linear[0]),
+                                             (y,fvy,self.linear[1])):
+        v = numpy.asarray(v,dtype=numpy.float64)
+        if todata:
+          r = (v - off)/scale
+          if log:
+            r = 10.**r
+          d = r
+        else:
+          d = v
+          r = off + scale*(numpy.log10(v) if log else v)
+        bad |= ~((d >= amin) & (d <= amax))
+        if fv is not None:
+          bad |= (v == fv)
+        out.append(r)
+    for r in out:
+      r[bad] = self.out_of_range
+    return out
+
+  def _convert(self,name,todata,x,y,xout,yout):
+    x2,fvx = _get_arr_and_fv(x)
+    y2,fvy = _get_arr_and_fv(y)
+    x2 = numpy.asarray(x2)
+    y2 = numpy.asarray(y2)
+    if (x2.shape != y2.shape):
+      print("%s: x and y must be the same shape" % (name))
+      return None
+    if (x2.dtype == numpy.float32):
+      dtype = numpy.float32
+    else:
+      dtype = numpy.float64
+    if (xout is None):
+      xout = numpy.empty(x2.shape,dtype)
+    if (yout is None):
+      yout = numpy.empty(x2.shape,dtype)
+    for a in (xout,yout):
+      if (not _is_numpy_array(a) or not a.flags.c_contiguous or \
+          not a.flags.writeable or a.size != x2.size or \
+          a.dtype not in (numpy.float32,numpy.float64)):
+        print("%s: xout and yout must be contiguous float32 or float64 arrays with %d elements" % (name,x2.size))
+        return None
+
+    if (self.linear is not None):
+      xl,yl = self._linear(todata,x2,y2,fvx,fvy)
+      xout.reshape(-1)[...] = xl.ravel()
+      yout.reshape(-1)[...] = yl.ravel()
+    else:
+      fvx,ismx = _set_default_msg(fvx)
+      fvy,ismy = _set_default_msg(fvy)
+      ndc_transform_p(self.plot,todata,x2,y2,xout,yout,fvx,fvy,ismx,ismy)
+    return xout,yout
+
+  def datatondc(self,x,y,xout=None,yout=None):
+    """
+Converts coordinates in data space to coordinates in NDC space.
+
+xndc,yndc = trans.datatondc(xdata, ydata, xout=None, yout=None)
+
+xdata,ydata -- (Masked) arrays of any shape, both the same, containing
+               the values to be converted.
+
+xout,yout -- Optional contiguous float32 or float64 arrays with as
+             many elements as xdata, to hold the results. If not
+             given, arrays of the same shape as xdata are created,
+             float32 if xdata is float32, and float64 otherwise.
+
+Missing values (the fill values of masked arrays) and points outside
+the plot's data space are set to trans.out_of_range in both outputs.
+    """
+    return self._convert("datatondc",0,x,y,xout,yout)
+
+  def ndctodata(self,x,y,xout=None,yout=None):
+    """
+Converts coordinates in NDC space to coordinates in data space.
+
+xdata,ydata = trans.ndctodata(xndc, yndc, xout=None, yout=None)
+
+xndc,yndc -- (Masked) arrays of any shape, both the same, containing
+             the values to be converted.
+
+xout,yout -- As for trans.datatondc.
+
+Missing values and points outside the plot are set to
+trans.out_of_range in both outputs.
+    """
+    return self._convert("ndctodata",1,x,y,xout,yout)
+
 def _inputt(a,b):
 #
 # Promote a and b to numpy arrays that have at least a dimension of 1.
@@ -1081,6 +1515,27 @@ def _mask_lambert_conformal(wks, maplc, mask_list, mlcres):
 
   return(maplc)
 
+def _gc_broadcast(*args):
+#
+#  Broadcasts the arguments of the array great circle functions
+#  against each other. Returns the broadcast shape and the arguments
+#  as contiguous 1D float64 arrays for the native routines.
+#
+  arrs = numpy.broadcast_arrays(*[numpy.atleast_1d(numpy.asarray(arg, \
+                                  dtype=numpy.float64)) for arg in args])
+  return arrs[0].shape, \
+         [numpy.ascontiguousarray(arr).ravel() for arr in arrs]
+
+def _gc_result(arr,shape,*args):
+#
+#  Gives the result of an array great circle function its broadcast
+#  shape, or returns a scalar if all of the arguments were scalars.
+#
+  for arg in args:
+    if (not _is_scalar(arg)):
+      return arr.reshape(shape)
+  return arr[0]
+
 #
 # Special function to deal with values that may come in as
 # a scalar (as defined by the "_is_scalar" function above)
@@ -1297,173 +1752,118 @@ def _set_default_msg(fv,default_msg=1.e20):
   else:
     return fv,1
 
-def _set_spc_res(resource_name,value):
 #
-#  Change True and False values to 1 and 0 and leave all other
-#  values unchaged.
+#  Positions of the special resources in the C nglRes structure, as
+#  used by the set_nglRes_* functions in hlu.i.
 #
-  lval = value
-  if (value == True):
-    lval = 1
-  elif (value == False):
-    lval = 0
+#  These resources must stay in this order!
+#  If you add new resources, add them at the
+#  end of the list. See also set_nglRes_defaults in hlu.i.
+#
+_spc_res_pos = {
+  "Maximize"                              :  0,
+  "Draw"                                  :  1,
+  "Frame"                                 :  2,
+  "Scale"                                 :  3,
+  "Debug"                                 :  4,
+  "PaperOrientation"                      :  5,
+  "PaperWidth"                            :  6,
+  "PaperHeight"                           :  7,
+  "PaperMargin"                           :  8,
+  "PanelCenter"                           :  9,
+  "PanelRowSpec"                          : 10,
+  "PanelXWhiteSpacePercent"               : 11,
+  "PanelYWhiteSpacePercent"               : 12,
+  "PanelBoxes"                            : 13,
+  "PanelLeft"                             : 14,
+  "PanelRight"                            : 15,
+  "PanelBottom"                           : 16,
+  "PanelTop"                              : 17,
+  "PanelInvsblTop"                        : 18,
+  "PanelInvsblLeft"                       : 19,
+  "PanelInvsblRight"                      : 20,
+  "PanelInvsblBottom"                     : 21,
+  "PanelSave"                             : 22,
+  "SpreadColors"                          : 23,
+  "SpreadColorStart"                      : 24,
+  "SpreadColorEnd"                        : 25,
+  "PanelLabelBarOrientation"              : 26,
+  "PanelLabelBar"                         : 27,
+  "PanelLabelBarXF"                       : 28,
+  "PanelLabelBarYF"                       : 29,
+  "PanelLabelBarLabelFontHeightF"         : 30,
+  "PanelLabelBarWidthF"                   : 31,
+  "PanelLabelBarHeightF"                  : 32,
+  "PanelLabelBarOrthogonalPosF"           : 33,
+  "PanelLabelBarParallelPosF"             : 34,
+  "PanelLabelBarPerimOn"                  : 35,
+  "PanelLabelBarAlignment"                : 36,
+  "PanelLabelBarLabelAutoStride"          : 37,
+  "PanelFigureStrings"                    : 38,
+  "PanelFigureStringsCount"               : 39,
+  "PanelFigureStringsJust"                : 40,
+  "PanelFigureStringsOrthogonalPosF"      : 41,
+  "PanelFigureStringsParallelPosF"        : 42,
+  "PanelFigureStringsPerimOn"             : 43,
+  "PanelFigureStringsBackgroundFillColor" : 44,
+  "PanelFigureStringsFontHeightF"         : 45,
+  "AppResFileName"                        : 46,
+  "XAxisType"                             : 47,
+  "YAxisType"                             : 48,
+  "PointTickmarksOutward"                 : 49,
+  "XRefLine"                              : 50,
+  "YRefLine"                              : 51,
+  "XRefLineThicknessF"                    : 52,
+  "YRefLineThicknessF"                    : 53,
+  "XRefLineColor"                         : 54,
+  "YRefLineColor"                         : 55,
+  "MaskLambertConformal"                  : 56,
+  "MaskLambertConformalOutlineOn"         : 57,
+  "PanelLayoutOnly"                       : 58,
+}
+
+#
+#  Special resources that can also be given as strings.
+#
+_spc_res_strings = {
+  "PaperOrientation" : {"portrait" : 0, "landscape" : 6, "auto" : 3},
+  "XAxisType"        : {"irregularaxis" : 0, "linearaxis" : 1, "logaxis" : 2},
+  "YAxisType"        : {"irregularaxis" : 0, "linearaxis" : 1, "logaxis" : 2},
+}
 
+def _set_spc_res(resource_name,value):
+  _set_spc_res_list({resource_name : value})
+
+def _set_spc_res_list(spc_res):
 #
-#  Set the special resource values.
+#  Set the special resources in spc_res, a dictionary whose keys are
+#  the resource names without the "ngl" prefix, with one call into
+#  the C code.
 #
-#  These resources must stay in this order!
-#  If you add new resources, add them at the
-#  end of the list. See also _set_spc_defaults.
-#
-  if (resource_name   == "Maximize"):
-    set_nglRes_i(0, lval)
-  elif (resource_name == "Draw"):
-    set_nglRes_i(1, lval)
-  elif (resource_name == "Frame"):
-    set_nglRes_i(2, lval)
-  elif (resource_name == "Scale"):
-    set_nglRes_i(3, lval)
-  elif (resource_name == "Debug"):
-    set_nglRes_i(4, lval)
-  elif (resource_name == "PaperOrientation"):
-    if(isinstance(lval, str)):
-      if(lval.lower() == "portrait"):
-        set_nglRes_i(5, 0)
-      elif(lval.lower() == "landscape"):
-        set_nglRes_i(5, 6)
-      elif(lval.lower() == "auto"):
-        set_nglRes_i(5, 3)
-      else:
-        print("_set_spc_res: Unknown value for " + resource_name)
-    else:
-      set_nglRes_i(5, lval)
-  elif (resource_name == "PaperWidth"):
-    set_nglRes_f(6, lval)
-  elif (resource_name == "PaperHeight"):
-    set_nglRes_f(7, lval)
-  elif (resource_name == "PaperMargin"):
-    set_nglRes_f(8, lval)
-  elif (resource_name == "PanelCenter"):
-    set_nglRes_i(9, lval)
-  elif (resource_name == "PanelRowSpec"):
-    set_nglRes_i(10, lval)
-  elif (resource_name == "PanelXWhiteSpacePercent"):
-    set_nglRes_f(11, lval)
-  elif (resource_name == "PanelYWhiteSpacePercent"):
-    set_nglRes_f(12, lval)
-  elif (resource_name == "PanelBoxes"):
-    set_nglRes_i(13, lval)
-  elif (resource_name == "PanelLeft"):
-    set_nglRes_f(14, lval)
-  elif (resource_name == "PanelRight"):
-    set_nglRes_f(15, lval)
-  elif (resource_name == "PanelBottom"):
-    set_nglRes_f(16, lval)
-  elif (resource_name == "PanelTop"):
-    set_nglRes_f(17, lval)
-  elif (resource_name == "PanelInvsblTop"):
-    set_nglRes_f(18, lval)
-  elif (resource_name == "PanelInvsblLeft"):
-    set_nglRes_f(19, lval)
-  elif (resource_name == "PanelInvsblRight"):
-    set_nglRes_f(20, lval)
-  elif (resource_name == "PanelInvsblBottom"):
-    set_nglRes_f(21, lval)
-  elif (resource_name == "PanelSave"):
-    set_nglRes_i(22, lval)
-  elif (resource_name == "SpreadColors"):
-    set_nglRes_i(23, lval)
-  elif (resource_name == "SpreadColorStart"):
-    set_nglRes_i(24, lval)
-  elif (resource_name == "SpreadColorEnd"):
-    set_nglRes_i(25, lval)
-  elif (resource_name == "PanelLabelBarOrientation"):
-    set_nglRes_i(26, lval)
-  elif (resource_name == "PanelLabelBar" and len(resource_name) == 13):
-    set_nglRes_i(27, lval)
-  elif (resource_name == "PanelLabelBarXF"):
-    set_nglRes_f(28, lval)
-  elif (resource_name == "PanelLabelBarYF"):
-    set_nglRes_f(29, lval)
-  elif (resource_name == "PanelLabelBarLabelFontHeightF"):
-    set_nglRes_f(30, lval)
-  elif (resource_name == "PanelLabelBarWidthF"):
-    set_nglRes_f(31, lval)
-  elif (resource_name == "PanelLabelBarHeightF"):
-    set_nglRes_f(32, lval)
-  elif (resource_name == "PanelLabelBarOrthogonalPosF"):
-    set_nglRes_f(33, lval)
-  elif (resource_name == "PanelLabelBarParallelPosF"):
-    set_nglRes_f(34, lval)
-  elif (resource_name == "PanelLabelBarPerimOn"):
-    set_nglRes_i(35, lval)
-  elif (resource_name == "PanelLabelBarAlignment"):
-    set_nglRes_i(36, lval)
-  elif (resource_name == "PanelLabelBarLabelAutoStride"):
-    set_nglRes_i(37, lval)
-  elif (resource_name == "PanelFigureStrings" and len(resource_name) == 18):
-    set_nglRes_c(38, lval)
-  elif (resource_name == "PanelFigureStringsCount"):
-    set_nglRes_i(39, lval)
-  elif (resource_name == "PanelFigureStringsJust"):
-    set_nglRes_i(40, lval)
-  elif (resource_name == "PanelFigureStringsOrthogonalPosF"):
-    set_nglRes_f(41, lval)
-  elif (resource_name == "PanelFigureStringsParallelPosF"):
-    set_nglRes_f(42, lval)
-  elif (resource_name == "PanelFigureStringsPerimOn"):
-    set_nglRes_i(43, lval)
-  elif (resource_name == "PanelFigureStringsBackgroundFillColor"):
-    set_nglRes_i(44, lval)
-  elif (resource_name == "PanelFigureStringsFontHeightF"):
-    set_nglRes_f(45, lval)
-  elif (resource_name == "AppResFileName"):
-    set_nglRes_s(46, lval)
-  elif (resource_name == "XAxisType"):
-    if(isinstance(lval, str)):
-      if(lval.lower() == "irregularaxis"):
-        set_nglRes_i(47, 0)
-      elif(lval.lower() == "linearaxis"):
-        set_nglRes_i(47, 1)
-      elif(lval.lower() == "logaxis"):
-        set_nglRes_i(47, 2)
-      else:
-        print("_set_spc_res: Unknown value for " + resource_name)
-    else:
-      set_nglRes_i(47, lval)
-  elif (resource_name == "YAxisType"):
-    if(isinstance(lval, str)):
-      if(lval.lower() == "irregularaxis"):
-        set_nglRes_i(48, 0)
-      elif(lval.lower() == "linearaxis"):
-        set_nglRes_i(48, 1)
-      elif(lval.lower() == "logaxis"):
-        set_nglRes_i(48, 2)
-      else:
+  values = {}
+  for resource_name in spc_res.keys():
+    value = spc_res[resource_name]
+#
+#  Change True and False values to 1 and 0 and leave all other
+#  values unchaged.
+#
+    lval = value
+    if (value == True):
+      lval = 1
+    elif (value == False):
+      lval = 0
+
+    if (not resource_name in _spc_res_pos):
+      print("_set_spc_res: Unknown special resource ngl" + resource_name)
+      continue
+    if (resource_name in _spc_res_strings and isinstance(lval, str)):
+      if (not lval.lower() in _spc_res_strings[resource_name]):
         print("_set_spc_res: Unknown value for " + resource_name)
-    else:
-      set_nglRes_i(48, lval)
-  elif (resource_name == "PointTickmarksOutward"):
-    set_nglRes_i(49, lval)
-  elif (resource_name == "XRefLine"):
-    set_nglRes_f(50, lval)
-  elif (resource_name == "YRefLine"):
-    set_nglRes_f(51, lval)
-  elif (resource_name == "XRefLineThicknessF"):
-    set_nglRes_f(52, lval)
-  elif (resource_name == "YRefLineThicknessF"):
-    set_nglRes_f(53, lval)
-  elif (resource_name == "XRefLineColor"):
-    set_nglRes_i(54, lval)
-  elif (resource_name == "YRefLineColor"):
-    set_nglRes_i(55, lval)
-  elif (resource_name == "MaskLambertConformal"):
-    set_nglRes_i(56, lval)
-  elif (resource_name == "MaskLambertConformalOutlineOn"):
-    set_nglRes_i(57, lval)
-
-  else:
-    print("_set_spc_res: Unknown special resource ngl" + resource_name)
+        continue
+      lval = _spc_res_strings[resource_name][lval.lower()]
+    values[_spc_res_pos[resource_name]] = lval
+  if (len(values) > 0):
+    set_nglRes_p(values)
 
 def _check_res_value(resvalue,strvalue,intvalue):
 #
@@ -1635,6 +2035,337 @@ def _set_streamline_res(reslist,reslist1):
 #
   _set_tickmark_res(reslist,reslist1)
 
+def _region_cull(arr,rlist):
+#
+# If nglRegionCull is True, drop the points (or cells) of unstructured
+# or curvilinear data that can't be visible within the map's lat/lon
+# limits (widened by nglRegionCullHaloF degrees), so that HLU doesn't
+# have to triangulate or grid them. The sf* coordinate resources in
+# rlist are replaced by the culled ones, and the culled data array
+# is returned.
+#
+  cull = rlist.pop("nglRegionCull",False)
+  halo = float(rlist.pop("nglRegionCullHaloF",2.))
+  if (not cull or not ("sfXArray" in rlist and "sfYArray" in rlist)):
+    return arr
+#
+# Only the lat/lon limit mode defines the visible area directly.
+#
+  limits = ["mpMinLatF","mpMaxLatF","mpMinLonF","mpMaxLonF"]
+  if ("mpLimitMode" in rlist):
+    if (not _check_res_value(rlist["mpLimitMode"],"LatLon",1)):
+      return arr
+  elif (not any(key in rlist for key in limits)):
+    return arr
+  minlat = rlist.get("mpMinLatF",-90.)
+  maxlat = rlist.get("mpMaxLatF", 90.)
+  minlon = rlist.get("mpMinLonF",-180.)
+  maxlon = rlist.get("mpMaxLonF", 180.)
+
+  lon = numpy.asarray(_convert_from_ma(rlist["sfXArray"]),dtype=numpy.float64)
+  lat = numpy.asarray(_convert_from_ma(rlist["sfYArray"]),dtype=numpy.float64)
+  if (lon.shape != arr.shape or lat.shape != arr.shape or 
+      len(arr.shape) > 2):
+    return arr
+  ncells = arr.size
+
+  keep = region_cull_p(lat,lon,ncells,1,minlat,maxlat,minlon,maxlon,halo)
+  if (len(arr.shape) == 1 and \
+      "sfXCellBounds" in rlist and "sfYCellBounds" in rlist):
+    xb = numpy.asarray(_convert_from_ma(rlist["sfXCellBounds"]), \
+                       dtype=numpy.float64)
+    yb = numpy.asarray(_convert_from_ma(rlist["sfYCellBounds"]), \
+                       dtype=numpy.float64)
+    if (len(xb.shape) == 2 and xb.shape == yb.shape and xb.shape[0] == ncells):
+      keep = numpy.union1d(keep,region_cull_p(yb,xb,ncells,xb.shape[1], \
+                                   minlat,maxlat,minlon,maxlon,halo))
+  if (len(keep) == 0 or len(keep) == ncells):
+    return arr
+
+  if (len(arr.shape) == 1):
+#
+# Unstructured: keep just the visible points and their cells.
+#
+    for key in ["sfXArray","sfYArray","sfXCellBounds","sfYCellBounds"]:
+      if (key in rlist):
+        val = numpy.asarray(_convert_from_ma(rlist[key]))
+        if (val.shape[0] == ncells):
+          rlist[key] = val[keep]
+    if ("sfElementNodes" in rlist):
+#
+# Renumber the triangles, and drop the ones that lost a vertex.
+#
+      first = rlist.get("sfFirstNodeIndex",0)
+      nodes = numpy.asarray(rlist["sfElementNodes"]) - first
+      newindex = numpy.zeros(ncells,dtype=numpy.int32) - 1
+      newindex[keep] = numpy.arange(len(keep),dtype=numpy.int32)
+      nodes = newindex[nodes]
+      rlist["sfElementNodes"] = nodes[numpy.all(nodes >= 0,axis=1)] + first
+    return arr[keep]
+  else:
+#
+# Curvilinear: keep the smallest index rectangle that holds all of
+# the visible points (plus one more row/column on each side), so the
+# grid stays structured.
+#
+    ny,nx = arr.shape
+    rows  = keep // nx
+    cols  = keep % nx
+    j0 = max(rows.min()-1,0)
+    j1 = min(rows.max()+2,ny)
+    i0 = max(cols.min()-1,0)
+    i1 = min(cols.max()+2,nx)
+    rlist["sfXArray"] = lon[j0:j1,i0:i1]
+    rlist["sfYArray"] = lat[j0:j1,i0:i1]
+    return arr[j0:j1,i0:i1]
+
+def _wks_pixel_width(wks):
+#
+# Return the number of device pixels across NDC space on the given
+# workstation. PS and PDF output is taken to be 300 dpi on a letter
+# page.
+#
+  name = NhlClassName(wks)
+  if (name in ["psWorkstationClass","pdfWorkstationClass", \
+               "cairoDocumentWorkstationClass"]):
+    return 8.5 * 300
+  elif (name in ["cairoImageWorkstationClass","imageWorkstationClass", \
+                 "xWorkstationClass","cairoWindowWorkstationClass"]):
+    return get_integer(wks,"wkWidth")
+  else:
+    return 1024
+
+def _decimate_xy(wks,x,y,xfv,yfv,rlist):
+#
+# If nglXYDecimate is True, reduce each curve to at most four points
+# (first, min, max, last) per column of pixels that the plot covers,
+# which leaves it looking the same. nglXYDecimateColumns overrides
+# the number of columns, which is otherwise taken from the width of
+# the viewport and of the workstation. Returns the new x and y arrays
+# and their missing values.
+#
+  decimate = rlist.pop("nglXYDecimate",False)
+  ncols    = rlist.pop("nglXYDecimateColumns",0)
+  if (not decimate):
+    return x,y,xfv,yfv
+
+  x = numpy.asarray(x,dtype=numpy.float64)
+  y = numpy.asarray(y,dtype=numpy.float64)
+  if (len(x.shape) > 2 or len(y.shape) > 2 or x.shape[-1] != y.shape[-1] or \
+      (len(x.shape) == 2 and x.shape != y.shape)):
+    return x,y,xfv,yfv
+  npts = y.shape[-1]
+
+  if (ncols <= 0):
+#
+# Use twice as many columns as there are pixels, so that rounding
+# to pixels can't make any difference.
+#
+    ncols = int(2 * rlist.get("vpWidthF",0.6) * _wks_pixel_width(wks))
+  if (npts <= 4*ncols):
+    return x,y,xfv,yfv
+
+  xmsg = rlist.get("caXMissingV",xfv)
+  ymsg = rlist.get("caYMissingV",yfv)
+  ismx = int(xmsg is not None)
+  ismy = int(ymsg is not None)
+  if (not ismx):
+    xmsg = 0.
+  if (not ismy):
+    ymsg = 0.
+
+  xs = x
+  if (ismx):
+    xs = x[x != xmsg]
+  if ("trXMinF" in rlist):
+    xmin = float(rlist["trXMinF"])
+  else:
+    xmin = float(numpy.min(xs))
+  if ("trXMaxF" in rlist):
+    xmax = float(rlist["trXMaxF"])
+  else:
+    xmax = float(numpy.max(xs))
+  xlog = int(("trXLog" in rlist and rlist["trXLog"]) or \
+             ("xyXStyle" in rlist and _check_res_value(rlist["xyXStyle"],"Log",1)))
+
+  if (len(y.shape) == 1):
+    xo,yo = decimate_xy_p(x,y,npts,xmin,xmax,ncols,xlog, \
+                          ismx,xmsg,ismy,ymsg)
+    return xo,yo,xfv,yfv
+#
+# Each curve keeps different points, so X has to become 2D too, and
+# the shorter curves get padded with missing values.
+#
+  curves = []
+  for i in range(y.shape[0]):
+    if (len(x.shape) == 2):
+      xi = x[i]
+    else:
+      xi = x
+    curves.append(decimate_xy_p(xi,y[i],npts,xmin,xmax,ncols,xlog, \
+                                ismx,xmsg,ismy,ymsg))
+  if (not ismx):
+    xmsg = 1.e20
+    xfv  = xmsg
+  if (not ismy):
+    ymsg = 1.e20
+    yfv  = ymsg
+  nmax = max([len(c[0]) for c in curves])
+  xo = numpy.zeros((y.shape[0],nmax)) + xmsg
+  yo = numpy.zeros((y.shape[0],nmax)) + ymsg
+  for i in range(y.shape[0]):
+    n = len(curves[i][0])
+    xo[i,:n] = curves[i][0]
+    yo[i,:n] = curves[i][1]
+  return xo,yo,xfv,yfv
+
+def _raster_edges(rlist,axis,n):
+#
+# Return the data coordinates of the outer edges of the first and
+# last cells along the given axis ("X" or "Y") of a rectilinear grid
+# with n points, or None if the points aren't evenly spaced.
+#
+  key = "sf%sArray" % axis
+  if (key in rlist):
+    c = numpy.ravel(numpy.asarray(rlist[key],dtype=numpy.float64))
+    if (len(c) != n or n < 2):
+      return None
+    d = numpy.diff(c)
+    if (d[0] == 0. or not numpy.allclose(d,d[0],rtol=1.e-5,atol=0.)):
+      return None
+    first,last = c[0],c[-1]
+  else:
+    if (n < 2):
+      return None
+    first = float(rlist.get("sf%sCStartV" % axis,0.))
+    last  = float(rlist.get("sf%sCEndV" % axis,n-1.))
+  half = 0.5 * (last - first) / (n - 1)
+  return float(first),float(last),float(first - half),float(last + half)
+
+def _raster_fast_setup(arr,fill_value,rlist,is_map):
+#
+# If nglRasterFastPath is True, check whether the raster fill of
+# this rectilinear grid can be drawn natively as a cell array (see
+# raster_fill_wrap in gsun.c) rather than through the contour
+# engine. The grid must be evenly spaced, the axes linear, and a map
+# must be an unrotated cylindrical equidistant projection that the
+# grid's longitudes don't wrap around.
+#
+# If it can, the plot is created from a 2 x 2 stand-in for the data
+# with the same minimum and maximum, so it picks the same levels and
+# colors, and is not drawn until _raster_fast_draw is called. rlist
+# is modified for this, and a dictionary describing the grid is
+# returned. Otherwise None is returned and nothing is changed.
+#
+  if (not rlist.pop("nglRasterFastPath",False)):
+    return None
+  if (len(arr.shape) != 2 or not rlist.get("cnFillOn",False) or \
+      not _check_res_value(rlist.get("cnFillMode",""),"RasterFill",1) or \
+      rlist.get("cnRasterSmoothingOn",False) or \
+      rlist.get("trXLog",False) or rlist.get("trYLog",False) or \
+      "sfXCellBounds" in rlist or "sfYCellBounds" in rlist or \
+      not rlist.get("nglDraw",True)):
+    return None
+  ny,nx = arr.shape
+  xe = _raster_edges(rlist,"X",nx)
+  ye = _raster_edges(rlist,"Y",ny)
+  if (xe is None or ye is None):
+    return None
+
+  if (is_map):
+    if (not _check_res_value(rlist.get("mpProjection", \
+                             "CylindricalEquidistant"), \
+                             "CylindricalEquidistant",-1) or \
+        rlist.get("mpCenterLatF",0.) != 0. or \
+        rlist.get("mpCenterRotF",0.) != 0.):
+      return None
+#
+# The raster is drawn before the map, so a map fill that isn't drawn
+# after the contours would cover it. Use the usual path for those.
+#
+    if (rlist.get("mpFillOn",False) and \
+        not _check_res_value(rlist.get("mpFillDrawOrder",""),"PostDraw",2)):
+      return None
+    clon = rlist.get("mpCenterLonF",0.)
+    if (min(xe[2],xe[3]) < clon - 180.001 or \
+        max(xe[2],xe[3]) > clon + 180.001):
+      return None
+
+  msg = rlist.get("sfMissingValueV",fill_value)
+  valid = numpy.isfinite(arr)
+  if (msg is not None):
+    valid = valid & (arr != msg)
+  if (not numpy.any(valid)):
+    return None
+  dmin = float(numpy.min(arr[valid]))
+  dmax = float(numpy.max(arr[valid]))
+
+  fast = {"data"  : numpy.ascontiguousarray(arr,dtype=numpy.float64),
+          "xedges": xe[2:], "yedges": ye[2:], "msg": msg,
+          "frame" : rlist.get("nglFrame",True),
+          "proxy" : numpy.array([[dmin,dmax],[dmax,dmin]])}
+
+  rlist.pop("sfXArray",None)
+  rlist.pop("sfYArray",None)
+  rlist["sfXCStartV"] = xe[0]
+  rlist["sfXCEndV"]   = xe[1]
+  rlist["sfYCStartV"] = ye[0]
+  rlist["sfYCEndV"]   = ye[1]
+  rlist["nglDraw"]    = False
+  rlist["nglFrame"]   = False
+  return fast
+
+def _raster_fast_draw(wks,plot,fast):
+#
+# Draw a plot set up by _raster_fast_setup: get the levels and fill
+# colors the contour plot picked, color the grid with them natively,
+# then draw the rest of the plot over it with the stand-in data
+# replaced by missing values. If the native drawing fails, the full
+# grid is put into the plot and it's drawn the usual way.
+#
+  cn = plot.contour[0]
+  levels = numpy.asarray(get_float_array(cn,"cnLevels"),dtype=numpy.float64)
+  colors = numpy.asarray(get_integer_array(cn,"cnFillColors"),dtype='i')
+  msg_color = get_integer(cn,"cnMissingValFillColor")
+
+  cnres = Resources()
+  cnres.cnLevelSelectionMode  = "ExplicitLevels"
+  cnres.cnLevels              = levels
+  cnres.cnMissingValFillColor = -1
+  cnres.cnNoDataLabelOn       = False
+  cnres.cnConstFLabelOn       = False
+  set_values(cn,cnres)
+
+  ismsg,msg = int(fast["msg"] is not None),fast["msg"]
+  if (not ismsg):
+    msg = 1.e20
+#
+# Missing values get cnMissingValFillColor; if that's transparent
+# (-1), those cells are left undrawn.
+#
+  ny,nx = fast["data"].shape
+  ier = raster_fill_wrap(wks,_int_id(plot),fast["data"],nx,ny, \
+                         fast["xedges"][0],fast["xedges"][1], \
+                         fast["yedges"][0],fast["yedges"][1], \
+                         int(_wks_pixel_width(wks)),levels,len(levels), \
+                         colors,ismsg,msg,msg_color)
+
+  sfres = Resources()
+  if (ier == 0):
+    sfres.sfDataArray     = numpy.zeros((2,2)) - 999.
+    sfres.sfMissingValueV = -999.
+  else:
+    sfres.sfDataArray     = fast["data"]
+    sfres.sfMissingValueV = msg
+    cnres = Resources()
+    cnres.cnMissingValFillColor = msg_color
+    set_values(cn,cnres)
+  set_values(plot.sffield[0],sfres)
+
+  draw(plot)
+  if (fast["frame"]):
+    frame(wks)
+
 def _set_map_res(reslist,reslist1):
 #
 # Turn on map tickmarks.
@@ -1713,83 +2444,73 @@ def _crt_dict(resource_i):
   dic = {}
   if (resource_i is None):
     return(dic)
-  for t in dir(resource_i):
-    if (t[0:2] != '__'):        # skip any Python-supplied attributes.
-      dic[t] = getattr(resource_i,t)
+  if (isinstance(resource_i,ResourceList)):
+    dic = resource_i._dict.copy()   # callers remove items from it
+  else:
+    for t in dir(resource_i):
+      if (t[0:2] != '__'):        # skip any Python-supplied attributes.
+        dic[t] = getattr(resource_i,t)
+  if (_lazy_colormaps and first_call_to_open_wks > 0):
+    _load_named_colormaps(dic)
   return(dic)
 
+def _load_named_colormaps(rlist):
+#
+#  Load the files of any colormaps that the color map and palette
+#  resources in rlist refer to by name, if they haven't been loaded
+#  yet. Names that don't match a file (like the built-in colormaps)
+#  are left to the HLU library. Before the HLU library is started,
+#  the files are just linked into the colormap directory, and the
+#  first open_wks loads them.
+#
+  global _cmap_files
+  new = False
+  for key in rlist.keys():
+    if (not (key[-8:] == "ColorMap" or key[-7:] == "Palette")):
+      continue
+    name = rlist[key]
+    if (not isinstance(name,str) or name.lower() in _cmaps_loaded):
+      continue
+    if (_cmap_files is None):
+      _cmap_files = {}
+      if (_cmap_dir is None):
+        tmp = os.getenv("NCARG_COLORMAPS")
+      else:
+        tmp = _cmap_env
+      if not tmp is None:
+        paths = tmp.split(":")
+      else:
+        paths = [os.path.join(_pynglpath_ncarg(),"colormaps")]
+      for path in reversed(paths):
+        if (not os.path.isdir(path)):
+          continue
+        for fname in os.listdir(path):
+          base,ext = os.path.splitext(fname)
+          if (ext in [".rgb",".gp",".ncmap"]):
+            _cmap_files[base.lower()] = os.path.abspath(os.path.join(path,fname))
+    if (name.lower() in _cmap_files):
+      path = _cmap_files[name.lower()]
+      link = os.path.join(_colormap_dir(),os.path.basename(path))
+      if (not os.path.lexists(link)):
+        os.symlink(path,link)
+      new = True
+    _cmaps_loaded.add(name.lower())
+  if (new and _hlu_started):
+    load_colormap_files()
+    _clear_colormap_dir()
+
 def _set_spc_defaults(type):
 #
 #  Type = 1 sets the ngl special resources for plotting functions.
 #  Type = 0 sets the ngl special resources for text/poly resources
 #
-#  These resources must stay in this order. 
-#   See also _set_spc_res.
+#  The defaults themselves are kept on the C side, and are all reset
+#  with one call. See also _set_spc_res.
 #
   if (type == 1):
-    set_nglRes_i(0, 1)      # nglMaximize
-    set_nglRes_i(1, 1)      # nglDraw
-    set_nglRes_i(2, 1)      # nglFrame
+    set_nglRes_defaults(0)    # nglPlot
   elif (type == 0):
-    set_nglRes_i(0, 0)      # nglMaximize
-    set_nglRes_i(1, 1)      # nglDraw
-    set_nglRes_i(2, 0)      # nglFrame
-#
-  set_nglRes_i( 3, 1)       # nglScale
-  set_nglRes_i( 4, 0)       # nglDebug
-  set_nglRes_i( 5, -1)      # nglPaperOrientation
-  set_nglRes_f( 6, 8.5)     # nglPaperWidth
-  set_nglRes_f( 7, 11.)     # nglPaperHeight
-  set_nglRes_f( 8, 0.5)     # nglPaperMargin
-  set_nglRes_i( 9, 1)       # nglPanelCenter
-  set_nglRes_i(10, 0)       # nglPanelRowSpec
-  set_nglRes_f(11, 1.)      # nglPanelXWhiteSpacePercent
-  set_nglRes_f(12, 1.)      # nglPanelYWhiteSpacePercent
-  set_nglRes_i(13, 0)       # nglPanelBoxes
-  set_nglRes_f(14, 0.)      # nglPanelLeft
-  set_nglRes_f(15, 1.)      # nglPanelRight
-  set_nglRes_f(16, 0.)      # nglPanelBottom
-  set_nglRes_f(17, 1.)      # nglPanelTop
-  set_nglRes_f(18, -999.)   # nglPanelInvsblTop
-  set_nglRes_f(19, -999.)   # nglPanelInvsblLeft
-  set_nglRes_f(20, -999.)   # nglPanelInvsblRight
-  set_nglRes_f(21, -999.)   # nglPanelInvsblBottom
-  set_nglRes_i(22, 0)       # nglPanelSave
-  set_nglRes_i(23, 0)       # nglSpreadColors
-  set_nglRes_i(24, 2)       # nglSpreadColorStart
-  set_nglRes_i(25, -1)      # nglSpreadColorEnd
-  set_nglRes_i(26, 0)       # nglPanelLabelBarOrientation
-  set_nglRes_i(27, 0)       # nglPanelLabelBar
-  set_nglRes_f(28, -999.)   # nglPanelLabelBarXF
-  set_nglRes_f(29, -999.)   # nglPanelLabelBarYF
-  set_nglRes_f(30, -999.)   # nglPanelLabelBarLabelFontHeightF
-  set_nglRes_f(31, -999.)   # nglPanelLabelBarWidthF
-  set_nglRes_f(32, -999.)   # nglPanelLabelBarHeightF
-  set_nglRes_f(33, -999.)   # nglPanelLabelBarOrthogonalPosF
-  set_nglRes_f(34, -999.)   # nglPanelLabelBarParallelPosF
-  set_nglRes_i(35, 0)       # nglPanelLabelBarPerimOn
-  set_nglRes_i(36, 1)       # nglPanelLabelBarAlignment
-  set_nglRes_i(37, 1)       # nglPanelLabelBarLabelAutoStride
-  set_nglRes_c(38, [])      # nglPanelFigureStrings
-  set_nglRes_i(39, 0)       # nglPanelFigureStringsCount
-  set_nglRes_i(40, 8)       # nglPanelFigureStringsJust
-  set_nglRes_f(41, -999.)   # nglPanelFigureStringsOrthogonalPosF
-  set_nglRes_f(42, -999.)   # nglPanelFigureStringsParallelPosF
-  set_nglRes_i(43, 1)       # nglPanelFigureStringsPerimOn
-  set_nglRes_i(44, 0)       # nglPanelFigureStringsBackgroundFillColor
-  set_nglRes_f(45, -999.)   # nglPanelFigureStringsFontHeightF
-  set_nglRes_s(46, "")      # nglAppResFileName
-  set_nglRes_i(47, 0)       # nglXAxisType - default to irregular
-  set_nglRes_i(48, 0)       # nglYAxisType - default to irregular
-  set_nglRes_i(49, 0)       # nglPointTickmarksOutward
-  set_nglRes_f(50, -999.)   # nglXRefLine
-  set_nglRes_f(51, -999.)   # nglYRefLine
-  set_nglRes_f(52, 1.)      # nglXRefLineThicknessF
-  set_nglRes_f(53, 1.)      # nglYRefLineThicknessF
-  set_nglRes_i(54, 1)       # nglXRefLineColor
-  set_nglRes_i(55, 1)       # nglYRefLineColor
-  set_nglRes_i(56, 0)       # nglMaskLambertConformal
-  set_nglRes_i(57, 1)       # nglMaskLambertConformalOutlineOn
+    set_nglRes_defaults(1)    # nglPrimitive
 
 ################################################################
 #
@@ -1803,6 +2524,105 @@ def _skewty(pres):    # y-coord given pressure (mb)
 def _skewtx(temp,y):  # x-coord given temperature (c)
   return (0.54*temp+0.90692*y)
 
+def _skewt_thermo(which,a,p):
+#
+#  The temperatures of mixing ratio lines (which = 0), dry adiabats (1)
+#  or moist adiabats (2) with values a at pressures p. a and p are
+#  broadcast against each other and passed in one call to c_dskewt_n,
+#  which loops over the points in C, calling the Fortran helper once
+#  for each.
+#
+  a,p = numpy.broadcast_arrays(numpy.asarray(a,dtype=numpy.float64), \
+                               numpy.asarray(p,dtype=numpy.float64))
+  a = numpy.ascontiguousarray(a).ravel()
+  p = numpy.ascontiguousarray(p).ravel()
+  return skewt_thermo_p(which,a,p,len(a))
+
+_skewt_lines = None
+
+def _skewt_bkg_lines(mixrat,theta,lendth,rendth,pseudo):
+#
+#  Computes the x,y points of the mixing ratio lines, dry adiabats and
+#  moist adiabats of the skew-T background, and the positions of
+#  their labels. These are the same for every chart, so they are
+#  computed the first time and kept in _skewt_lines.
+#
+  global _skewt_lines
+  if (_skewt_lines is not None):
+    return _skewt_lines
+  lines = {}
+#
+#  Mixing ratio lines run from 1000 mb to 400 mb (440 mb for the 20
+#  line): (x bottom, x top, y bottom, y top) for each.
+#
+  ptop = numpy.where(mixrat == 20., 440., 400.)
+  ttop = _skewt_thermo(0,mixrat,ptop)
+  tbot = _skewt_thermo(0,mixrat,1000.)
+  ybot = _skewty(1000.)
+  lines["mixrat"] = [(_skewtx(tbot[i],ybot),_skewtx(ttop[i],_skewty(ptop[i])), \
+                      ybot,_skewty(ptop[i])) for i in range(len(mixrat))]
+#
+#  Dry adiabats, every 10 mb from the top end down to the bottom end,
+#  and a label 5 mb below the top end.
+#
+  npts = [int((rendth[i]-lendth[i])//10.)+1 for i in range(len(theta))]
+  p = numpy.concatenate([lendth[i]+10.*numpy.arange(npts[i]) \
+                         for i in range(len(theta))])
+  a = numpy.repeat(numpy.asarray(theta,dtype=numpy.float64),npts)
+  t = _skewt_thermo(1,a,p)
+  tlab = _skewt_thermo(1,theta,numpy.asarray(lendth,dtype=numpy.float64)+5.)
+  lines["dry"] = []
+  k = 0
+  for i in range(len(theta)):
+    y = _skewty(p[k:k+npts[i]])
+    x = _skewtx(t[k:k+npts[i]],y)
+    ylab = _skewty(lendth[i]+5.)
+    lines["dry"].append((x.astype('f'),y.astype('f'), \
+                         _skewtx(tlab[i],ylab),ylab))
+    k = k + npts[i]
+#
+#  Moist adiabats, every 10 mb from 1050 mb up to 240 mb, with a label
+#  just above the top.
+#
+  p = 1050. - 10.*numpy.arange(82)
+  t = _skewt_thermo(2,numpy.repeat(numpy.asarray(pseudo,dtype=numpy.float64), \
+                    len(p)),numpy.tile(p,len(pseudo)))
+  tlab = _skewt_thermo(2,pseudo,227.5)
+  y = _skewty(p)
+  ylab = _skewty(225.)
+  lines["moist"] = []
+  for i in range(len(pseudo)):
+    x = _skewtx(t[i*len(p):(i+1)*len(p)],y)
+    lines["moist"].append((x.astype('f'),y.astype('f'), \
+                           _skewtx(tlab[i],ylab),ylab))
+  _skewt_lines = lines
+  return lines
+
+_skewt_bkg_cache = {}
+
+def _skewt_draw(ops,func,wks,plot,*args):
+#
+#  Draws one piece of a skew-T background with func (polyline, polygon,
+#  polymarker or text), and adds what is needed to draw it again to
+#  ops. The arrays and resources are copied, since skewt_bkg reuses
+#  them; text items are kept and just drawn again.
+#
+  rtn = func(wks,plot,*args)
+  if (func == text):
+    ops.append((lambda wks,plot,txt: draw(txt), (rtn,)))
+  else:
+    saved = []
+    for arg in args:
+      if (isinstance(arg,Resources)):
+        res = Resources()
+        for key,value in _crt_dict(arg).items():
+          setattr(res,key,value)
+        saved.append(res)
+      else:
+        saved.append(numpy.array(arg))
+    ops.append((func,tuple(saved)))
+  return rtn
+
 def _dptlclskewt(p, tc, tdc):
   return c_dptlclskewt(p, tc, tdc)
 
@@ -1885,21 +2705,132 @@ RscConv = {  \
            "sktWindSpeedMissingV":"sktWSPDmissingV",                 \
           }
 
+def _poly_density(wks,plot,x,y,fvx,fvy,is_ndc,rlist):
+#
+# If nglPolymarkerDensity is True and there are at least
+# nglPolymarkerDensityMinN points, bin the points into a 2D histogram
+# and draw the counts as a raster-filled contour plot instead of
+# drawing one marker per point. The bins cover the plot's X/Y axis
+# range (the data range for a map, the unit square in NDC space).
+# nglPolymarkerDensityBins sets the number of bins, either one value
+# for both axes or [nx,ny]. Resources starting with "cn", "lb", "pm"
+# or "sf" are passed on to the contour plot. Bins with no points are
+# left transparent.
+#
+# Returns the PlotId of the contour plot, or None if the markers
+# should be drawn as usual.
+#
+  density = rlist.pop("nglPolymarkerDensity",False)
+  minn    = rlist.pop("nglPolymarkerDensityMinN",100000)
+  bins    = rlist.pop("nglPolymarkerDensityBins",200)
+  if (not density):
+    return None
+
+  x = numpy.ravel(numpy.asarray(x,dtype=numpy.float64))
+  y = numpy.ravel(numpy.asarray(y,dtype=numpy.float64))
+  npts = min(len(x),len(y))
+  if (npts < minn):
+    return None
+
+  try:
+    nx,ny = int(bins[0]),int(bins[1])
+  except TypeError:
+    nx = ny = int(bins)
+
+  fvx,ismx = _set_default_msg(fvx)
+  fvy,ismy = _set_default_msg(fvy)
+
+  if (is_ndc):
+    xmin,xmax,ymin,ymax = 0.,1.,0.,1.
+  elif (NhlClassName(_int_id(plot)) == "mapPlotClass"):
+    keep = numpy.isfinite(x[:npts]) & numpy.isfinite(y[:npts])
+    if (ismx):
+      keep = keep & (x[:npts] != fvx)
+    if (ismy):
+      keep = keep & (y[:npts] != fvy)
+    if (not numpy.any(keep)):
+      return None
+    xmin,xmax = float(numpy.min(x[:npts][keep])),float(numpy.max(x[:npts][keep]))
+    ymin,ymax = float(numpy.min(y[:npts][keep])),float(numpy.max(y[:npts][keep]))
+  else:
+    xmin = get_float(_int_id(plot),"trXMinF")
+    xmax = get_float(_int_id(plot),"trXMaxF")
+    ymin = get_float(_int_id(plot),"trYMinF")
+    ymax = get_float(_int_id(plot),"trYMaxF")
+
+  counts = histogram2d_p(x,y,npts,nx,ny,xmin,xmax,ymin,ymax, \
+                         ismx,fvx,ismy,fvy)
+
+  cres = Resources()
+  cres.nglDraw           = False
+  cres.nglFrame          = False
+  cres.nglMaximize       = False
+  cres.tmXBOn            = False
+  cres.tmXTOn            = False
+  cres.tmYLOn            = False
+  cres.tmYROn            = False
+  cres.tmXBBorderOn      = False
+  cres.tmXTBorderOn      = False
+  cres.tmYLBorderOn      = False
+  cres.tmYRBorderOn      = False
+  cres.cnFillOn          = True
+  cres.cnFillMode        = "RasterFill"
+  cres.cnLinesOn         = False
+  cres.cnLineLabelsOn    = False
+  cres.cnInfoLabelOn     = False
+  cres.lbLabelBarOn      = False
+  cres.sfMissingValueV   = 0.
+  cres.cnMissingValFillColor = -1
+  cres.sfXArray = xmin + (numpy.arange(nx) + 0.5) * (xmax - xmin) / nx
+  cres.sfYArray = ymin + (numpy.arange(ny) + 0.5) * (ymax - ymin) / ny
+  if (is_ndc):
+    cres.vpXF      = 0.
+    cres.vpYF      = 1.
+    cres.vpWidthF  = 1.
+    cres.vpHeightF = 1.
+    cres.trXMinF   = 0.
+    cres.trXMaxF   = 1.
+    cres.trYMinF   = 0.
+    cres.trYMaxF   = 1.
+  for key in list(rlist.keys()):
+    if (key[0:2] in ["cn","lb","pm","sf"]):
+      setattr(cres,key,rlist.pop(key))
+  return contour(wks,counts,cres)
+
 def _poly(wks,plot,x,y,ptype,is_ndc,rlistc=None):
 # Get NumPy array from masked arrays, if necessary.
   x2,fill_value_x = _get_arr_and_fv(x)
   y2,fill_value_y = _get_arr_and_fv(y)
 
-  _set_spc_defaults(0)
   rlist1 = {}
   if (not rlistc is None) and rlistc != False:
     rlist = _crt_dict(rlistc)
+#
+# Draw very large numbers of markers as a density plot, if requested.
+#
+    if (ptype == NhlPOLYMARKER):
+      dplot = _poly_density(wks,plot,x2,y2,fill_value_x,fill_value_y, \
+                            is_ndc,rlist)
+      if (not dplot is None):
+        if (is_ndc):
+          draw(dplot)
+        else:
+          overlay(plot,dplot)
+          draw(dplot)
+          remove_overlay(plot,dplot)
+        destroy(dplot)
+        return None
+
+  _set_spc_defaults(0)
+  if (not rlistc is None) and rlistc != False:
+    spc_res = {}
     for key in list(rlist.keys()):
       rlist[key] = _convert_from_ma(rlist[key])
       if (key[0:3] == "ngl"):
-        _set_spc_res(key[3:],rlist[key])
+        spc_res[key[3:]] = rlist[key]
       else:
         rlist1[key] = rlist[key]
+    _set_spc_res_list(spc_res)
 
 # Set flags indicating whether missing values present.
   fill_value_x,ismx = _set_default_msg(fill_value_x)
@@ -1919,13 +2850,25 @@ def _add_poly(wks,plot,x,y,ptype,rlistc=None,isndc=0):
   y2,fill_value_y = _get_arr_and_fv(y)
 
   rlist = _crt_dict(rlistc)
+
+#
+# Add very large numbers of markers as a density plot, if requested.
+#
+  if (ptype == NhlPOLYMARKER and not isndc):
+    dplot = _poly_density(wks,plot,x2,y2,fill_value_x,fill_value_y,0,rlist)
+    if (not dplot is None):
+      overlay(plot,dplot)
+      return(dplot)
+
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 # Set flags indicating whether missing values present.
   fill_value_x,ismx = _set_default_msg(fill_value_x)
@@ -2447,6 +3390,14 @@ x, y -- One-dimensional (masked) NumPy arrays containing the x, y
 
 res -- An optional instance of the Resources class having GraphicStyle
        resources as attributes.
+
+For very large numbers of points, set res.nglPolymarkerDensity = True
+to bin the points into a 2D histogram and overlay the counts as a
+raster-filled contour plot, whose PlotId is returned instead. This is
+only done when there are at least res.nglPolymarkerDensityMinN points
+(default 100000); res.nglPolymarkerDensityBins sets the number of bins
+as one value or [nx,ny] (default 200). Any "cn", "lb", "pm" and "sf"
+resources are applied to the contour plot.
   """
   return(_add_poly(wks,plot,x,y,NhlPOLYMARKER,rlistc,isndc))
 
@@ -2498,11 +3449,11 @@ res -- An optional instance of the Resources class having TextItem
 
 ################################################################
 
-def asciiread(filename,dims,type="float",sep=","):
+def asciiread(filename,dims,type="float",sep=",",threads=1):
   """
 Reads data from an ASCII file and returns a NumPy array.
 
-array = Ngl.asciiread(filename, dims, type='float')
+array = Ngl.asciiread(filename, dims, type='float', sep=',', threads=1)
 
 filename -- The name of the ASCII file to read.
 
@@ -2512,10 +3463,54 @@ dims -- A list or tuple specifying the dimension sizes (or -1 to read
 type -- An optional argument specifying the type of the data you are
         reading. The legal values are: 'integer', 'float', or
         'double'.
+
+sep -- An optional character that separates values, in addition to
+       white space.
+
+threads -- An optional number of threads to read the file with, for
+           large files (0 for as many as OpenMP allows). This has no
+           effect if PyNGL was built without OpenMP.
+
+Anything in the file that isn't a number of the given type is skipped.
+When sep is a single character, the file is read natively, straight
+into the returned array.
   """
+  if (type == "integer"):
+    itype = 0
+  elif (type == "float"):
+    itype = 1
+  elif (type == "double"):
+    itype = 2
+  else:
+    print('asciiread: type must be one of: "integer", "float", or "double".')
+    sys.exit()
+
+  if (dims == -1):
+    nnum = -1
+  else:
+    if (not (isinstance(dims,list)) and \
+        not (isinstance(dims,tuple))):
+      print('asciiread: dims must be a list or a tuple')
+      return None
+    nnum = 1
+    for m in range(len(dims)):
+      nnum = nnum*dims[m]
+
+  if (len(sep) == 1):
+    ier,ar,count = asciiread_p(filename,sep,itype,nnum,threads)
+    if (ier != 0):
+      return None
+    if (count < nnum and dims != -1):
+      print("asciiread: Warning, fewer data items than specified array size.")
+    if (dims == -1):
+      return ar
+    else:
+      return numpy.reshape(ar,dims)
+
 #
-#  Regular expression special characters that must be escaped if
-#  "sep" is set to one of them.
+#  Longer separators are regular expressions, so the file is read
+#  here. Regular expression special characters that must be escaped
+#  if "sep" is set to one of them.
 #
   schar = [".", "^", "$", "*", "+", "?"]
   if (schar.count(sep) > 0):
@@ -2680,12 +3675,14 @@ res -- An (optional) instance of the Resources class having PyNGL
   if "nglFame" not in rlist:
     rlist["nglFrame"] = False
 
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       bp_rlist[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
   _set_tickmark_res(rlist,bp_rlist)      # Set some addtl tickmark resources
 
@@ -2708,6 +3705,89 @@ res -- An (optional) instance of the Resources class having PyNGL
 
 ################################################################
 
+def cape_thermo(p,tc,tdc,missing=-999.):
+  """
+Computes CAPE, CIN, and the lifting condensation level, level of free
+convection and equilibrium level for every column of gridded
+soundings.
+
+cape,cin,plcl,plfc,pel = Ngl.cape_thermo(p, tc, tdc, missing=-999.)
+
+p -- Pressure (hPa). Either a one-dimensional array of the pressure
+     levels, or an array the same shape as tc.
+
+tc -- Temperature (C), dimensioned (lev,...) or (time,lev,...): lev
+      is the leftmost dimension, or the second one if tc has four or
+      more dimensions.
+
+tdc -- Dew point temperature (C), the same shape as tc.
+
+missing -- The missing value of the input arrays, also used for the
+           values that can't be computed.
+
+As in Ngl.skewt_plt, the parcel is lifted from the first level, which
+should be the lowest one. CAPE and CIN are in J/kg; plcl, plfc and
+pel are pressures (hPa). Each returned array has the shape of tc with
+the lev dimension removed, and is float32 if tc is.
+
+Each column goes through the same DPTLCLSKEWT and DCAPETHERMO calls
+that Ngl.skewt_plt makes for one sounding, one column after another.
+This saves a Python call per column, but is no faster per column than
+those routines. The input is converted to float64 one time step at a
+time.
+  """
+  tc  = numpy.asarray(tc)
+  tdc = numpy.asarray(tdc)
+  p   = numpy.asarray(p)
+  if (tc.shape != tdc.shape or len(tc.shape) < 1):
+    print("cape_thermo: tc and tdc must be the same shape.")
+    return None
+  levdim = 1 if len(tc.shape) >= 4 else 0
+  nlvl   = tc.shape[levdim]
+  p_is_1d = (len(p.shape) == 1 and len(tc.shape) > 1)
+  if ((p_is_1d and len(p) != nlvl) or (not p_is_1d and p.shape != tc.shape)):
+    print("cape_thermo: p must be one-dimensional with one value per level, or the same shape as tc.")
+    return None
+
+  if (tc.dtype == numpy.float32):
+    rtype = numpy.float32
+  else:
+    rtype = numpy.float64
+  if (levdim == 0):
+    ntimes = 1
+    outshape = tc.shape[1:]
+  else:
+    ntimes = tc.shape[0]
+    outshape = (tc.shape[0],) + tc.shape[2:]
+  ncol = int(numpy.prod(tc.shape[levdim+1:]))
+  results = [numpy.zeros((ntimes,ncol),dtype=rtype) for i in range(5)]
+#
+#  Convert and compute one time step at a time, so only one time
+#  step's worth of float64 copies is made.
+#
+  if (p_is_1d):
+    pd = numpy.ascontiguousarray(p,dtype=numpy.float64)
+  for it in range(ntimes):
+    if (levdim == 0):
+      tslice, tdslice = tc, tdc
+      if (not p_is_1d):
+        pslice = p
+    else:
+      tslice, tdslice = tc[it], tdc[it]
+      if (not p_is_1d):
+        pslice = p[it]
+    if (not p_is_1d):
+      pd = numpy.ascontiguousarray(pslice,dtype=numpy.float64).ravel()
+    td  = numpy.ascontiguousarray(tslice,dtype=numpy.float64).ravel()
+    tdd = numpy.ascontiguousarray(tdslice,dtype=numpy.float64).ravel()
+    out = dcapethermo_cols_p(pd,int(p_is_1d),td,tdd,nlvl,ncol,float(missing))
+    for i in range(5):
+      results[i][it] = out[i]
+    del td,tdd,out
+  return tuple([results[i].reshape(outshape) for i in range(5)])
+
+################################################################
+
 def change_workstation(obj,wks):
   """
 Changes the workstation that plots will be drawn to.
@@ -2763,12 +3843,12 @@ wks -- The identifier returned from calling Ngl.open_wks.
 
 ################################################################
 
-def contour(wks,array,rlistc=None):
+def contour(wks,array,rlistc=None,mesh=None):
   """
 Creates and draws a contour plot, and returns a PlotId of the plot
 created.
 
-plot = Ngl.contour(wks, data, res=None)
+plot = Ngl.contour(wks, data, res=None, mesh=None)
 
 wks -- The identifier returned from calling Ngl.open_wks
 
@@ -2776,6 +3856,17 @@ data -- The data to contour. Masked arrays allowed.
 
 res -- An optional instance of the Resources class having PyNGL
        resources as attributes.
+
+mesh -- An optional Mesh object returned from Ngl.mesh. If set, data
+        must be 1D with one value per mesh point, and the coordinates
+        and triangles are taken from the mesh.
+For large rectilinear grids drawn with res.cnFillMode = "RasterFill",
+set res.nglRasterFastPath = True to color the grid natively and draw
+it as a cell array, with about one cell per device pixel, instead of
+passing it through the contour engine. The levels and colors are the
+ones the contour plot picks. This is only done when the plot is drawn
+right away, the grid coordinates are evenly spaced, and the axes are
+linear; otherwise the plot is drawn the usual way.
   """
 
 #
@@ -2784,12 +3875,25 @@ res -- An optional instance of the Resources class having PyNGL
   if (len(array.shape) != 1 and len(array.shape) != 2):
     print("contour - array must be 1D or 2D")
     return None
+  if (mesh is not None and (len(array.shape) != 1 or 
+                            array.shape[0] != mesh.npts)):
+    print("contour - array must be 1D and have one value per mesh point")
+    return None
 
 # Get NumPy array from masked array, if necessary.
   arr2,fill_value = _get_arr_and_fv(array)
   
   _set_spc_defaults(1)
   rlist = _crt_dict(rlistc)
+
+# Set up the native raster fill, if requested.
+  fast = None
+  if (mesh is None):
+    fast = _raster_fast_setup(arr2,fill_value,rlist,0)
+  else:
+    rlist.pop("nglRasterFastPath",None)
+  if (fast is not None):
+    arr2 = fast["proxy"]
  
 #  Separate the resource dictionary into those resources
 #  that apply to ScalarField and those that apply to
@@ -2798,12 +3902,13 @@ res -- An optional instance of the Resources class having PyNGL
   rlist1 = {}
   rlist2 = {}
   rlist3 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "sf"):
       rlist1[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist2[key] = rlist[key]
 #
@@ -2814,6 +3919,7 @@ res -- An optional instance of the Resources class having PyNGL
 #
       if(key[0:2] == "vp" or key[0:2] == "tm" or key[0:6] == "pmTick"):
         rlist3[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 # Set missing value resource, if necessary
   _set_msg_val_res(rlist1,fill_value,"scalar")
@@ -2824,7 +3930,10 @@ res -- An optional instance of the Resources class having PyNGL
 #
 #  Call the wrapped function and return.
 #
-  if (len(arr2.shape) == 2):
+  if (mesh is not None):
+    icn = contour_mesh_wrap(wks,mesh.id,arr2,"double",rlist1,rlist2, \
+                            rlist3,pvoid())
+  elif (len(arr2.shape) == 2):
     icn = contour_wrap(wks,arr2,"double",arr2.shape[0],arr2.shape[1], \
                            0, pvoid(),"",0,pvoid(),"", 0, pvoid(), rlist1, \
                           rlist2,rlist3,pvoid())
@@ -2837,16 +3946,19 @@ res -- An optional instance of the Resources class having PyNGL
   del rlist1
   del rlist2
   del rlist3
-  return(_lst2pobj(icn))
+  pcn = _lst2pobj(icn)
+  if (fast is not None):
+    _raster_fast_draw(wks,pcn,fast)
+  return(pcn)
 
 ################################################################
 
-def contour_map(wks,array,rlistc=None):
+def contour_map(wks,array,rlistc=None,mesh=None):
   """
 Creates and draws contours over a map, and returns a PlotId of the plot
 created.
 
-plot = Ngl.contour_map(wks, data, res=None)
+plot = Ngl.contour_map(wks, data, res=None, mesh=None)
 
 wks -- The identifier returned from calling Ngl.open_wks
 
@@ -2854,6 +3966,28 @@ data -- The data to contour. Masked arrays allowed.
 
 res -- An optional instance of the Resources class having PyNGL
        resources as attributes.
+
+mesh -- An optional Mesh object returned from Ngl.mesh. If set, data
+        must be 1D with one value per mesh point, and the coordinates
+        and triangles are taken from the mesh.
+
+For unstructured or curvilinear data (sfXArray/sfYArray the same shape
+as data) plotted over a region set with mpMinLatF, mpMaxLatF,
+mpMinLonF, and mpMaxLonF, set res.nglRegionCull = True to drop the
+points that can't be visible before they are passed on, which is much
+faster for small regions of global grids. res.nglRegionCullHaloF
+(default 2.) is the extra margin, in degrees, kept around the region;
+make it larger for projections that show more than the lat/lon box.
+
+For large rectilinear grids drawn with res.cnFillMode = "RasterFill",
+set res.nglRasterFastPath = True to color the grid natively and draw
+it as a cell array, with about one cell per device pixel, instead of
+passing it through the contour engine. The levels and colors are the
+ones the contour plot picks. This is only done when the plot is drawn
+right away, the grid coordinates are evenly spaced, the map is an
+unrotated cylindrical equidistant projection whose longitude range
+contains the grid, and mpFillOn is False (or mpFillDrawOrder is
+"PostDraw"); otherwise the plot is drawn the usual way.
   """
 #
 #  Make sure the array is 2D.
@@ -2861,12 +3995,32 @@ res -- An optional instance of the Resources class having PyNGL
   if (len(array.shape) != 1 and len(array.shape) != 2):
     print("contour_map - array must be 1D or 2D")
     return None
+  if (mesh is not None and (len(array.shape) != 1 or 
+                            array.shape[0] != mesh.npts)):
+    print("contour_map - array must be 1D and have one value per mesh point")
+    return None
 
 # Get NumPy array from masked array, if necessary.
   arr2,fill_value = _get_arr_and_fv(array)
     
   _set_spc_defaults(1)
   rlist = _crt_dict(rlistc)
+
+# Drop the data that can't be visible, if requested.
+  if (mesh is None):
+    arr2 = _region_cull(arr2,rlist)
+  else:
+    rlist.pop("nglRegionCull",None)
+    rlist.pop("nglRegionCullHaloF",None)
+
+# Set up the native raster fill, if requested.
+  fast = None
+  if (mesh is None):
+    fast = _raster_fast_setup(arr2,fill_value,rlist,1)
+  else:
+    rlist.pop("nglRasterFastPath",None)
+  if (fast is not None):
+    arr2 = fast["proxy"]
  
 #  Separate the resource dictionary into those resources
 #  that apply to ScalarField, MapPlot, and ContourPlot.
@@ -2875,6 +4029,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist2 = {}
   rlist3 = {}
 
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
 # Now sort resources into correct individual resource lists.
@@ -2885,9 +4040,10 @@ res -- An optional instance of the Resources class having PyNGL
           (key[0:2] == "ti") ):
       rlist2[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist3[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 # Set missing value resource, if necessary
   _set_msg_val_res(rlist1,fill_value,"scalar")
@@ -2904,7 +4060,10 @@ res -- An optional instance of the Resources class having PyNGL
 #
 #  Call the wrapped function and return.
 #
-  if (len(arr2.shape) == 2):
+  if (mesh is not None):
+        icm = contour_map_mesh_wrap(wks,mesh.id,arr2,"double", \
+                                    rlist1,rlist3,rlist2,pvoid())
+  elif (len(arr2.shape) == 2):
         icm = contour_map_wrap(wks,arr2,"double", \
                                 arr2.shape[0],arr2.shape[1],0, \
                                 pvoid(),"",0,pvoid(),"", 0, pvoid(), \
@@ -2920,6 +4079,9 @@ res -- An optional instance of the Resources class having PyNGL
   if mask_list["MaskLC"]:
     licm = _mask_lambert_conformal(wks, licm, mask_list, rlist2)
 
+  if (fast is not None):
+    _raster_fast_draw(wks,licm,fast)
+
   del rlist
   del rlist1
   del rlist2
@@ -2949,9 +4111,12 @@ xdata,ydata -- One dimensional (masked) arrays containing values to be
   fvx,ismx = _set_default_msg(fvx)
   fvy,ismy = _set_default_msg(fvy)
 
-  error,xout,yout,status,range = \
-     NhlPDataToNDC(_int_id(obj),x2,y2,len(_promote_scalar(x2)),
-                   fvx,fvy,ismx,ismy)
+  x2 = numpy.ravel(numpy.asarray(_promote_scalar(x2),dtype=numpy.float32))
+  y2 = numpy.ravel(numpy.asarray(_promote_scalar(y2),dtype=numpy.float32))
+  xout = numpy.empty(len(x2),numpy.float32)
+  yout = numpy.empty(len(x2),numpy.float32)
+  error,status,range = ndc_transform_p(_int_id(obj),0,x2,y2,xout,yout,
+                                       fvx,fvy,ismx,ismy)
 
 # Convert to masked array if input was masked array, or any of the
 # values are outside the plot data space.
@@ -2995,6 +4160,10 @@ Ngl.delete_wks(wks))
 wks -- The identifier returned from calling Ngl.open_wks.
   """
   NhlDestroy(wks)
+  for key in [key for key in _skewt_bkg_cache if key[0] == wks]:
+    del _skewt_bkg_cache[key]
+  if (wks in _image_wks_dirs):
+    _remove_image_dir(_image_wks_dirs.pop(wks))
   return None
 
 ################################################################
@@ -3244,6 +4413,37 @@ wks -- The identifier returned from calling Ngl.open_wks.
 
 ################################################################
 
+def enable_stats(enable=True,trace=False):
+  """
+Turns on (or off) the collection of timing statistics for the plotting
+calls, which are retrieved with Ngl.get_stats.
+
+Ngl.enable_stats(enable=True, trace=False)
+
+enable -- If True, the wall clock time, number of calls, and bytes of
+          data converted are kept for each stage of the plotting calls:
+          resource list conversion ("rlist"), data object creation
+          ("data"), the plotting functions themselves ("contour",
+          "xy", "panel", "open_wks", ...), and "maximize", "draw" and
+          "frame" (which includes writing the image file). Turning
+          statistics on or off clears what has been collected.
+
+trace -- If True, every call is also kept as an event, so that
+         Ngl.get_stats can write a Chrome trace file.
+
+Statistics can also be turned on by setting the PYNGL_STATS
+environment variable, to "trace" to keep trace events as well.
+  """
+  if (not enable):
+    set_stats(0)
+  elif (trace):
+    set_stats(2)
+  else:
+    set_stats(1)
+  return None
+
+################################################################
+
 def end():
   """
 Terminates a PyNGL script, flushes all buffers, and closes all
@@ -3448,6 +4648,145 @@ yi -- An array of any dimensionality, whose rightmost dimension is
 
 ################################################################
 
+def _ftcurv_n(name,x,y,xo,periodic,p,sigma,full):
+#
+# Fits every curve along the last dimension of y with fitgrid, one
+# after another, and evaluates them at xo.
+#
+  y2  = numpy.asarray(y)
+  x2  = numpy.asarray(x,dtype=numpy.float64)
+  xo2 = numpy.ravel(numpy.asarray(xo,dtype=numpy.float64))
+  if (len(y2.shape) == 0 or y2.size == 0):
+    print("%s: yi must have at least one dimension" % (name))
+    return None
+  n = y2.shape[-1]
+  if (x2.shape != (n,) and x2.shape != y2.shape):
+    print("%s: xi must be one-dimensional with length %d, or the same shape as yi" % (name,n))
+    return None
+
+  status,yo,dyo,iyo = ftcurv_n_p(y2.size//n,n,x2,y2,xo2,periodic,p,sigma,full)
+  if (status == 3):
+    return None
+  elif (status == 1):
+    print("%s: input array must have at least three elements." % (name))
+    return None
+  elif (status == 2):
+    if (periodic):
+      print("%s: the abscissae must be strictly increasing, and span no more than the period." % (name))
+    else:
+      print("%s: input array values must be strictly increasing." % (name))
+    return None
+  shape = y2.shape[:-1] + xo2.shape
+  out = [yo.reshape(shape)]
+  if (full and not periodic):
+    out = out + [dyo.reshape(shape)]
+  if (full):
+    out = out + [iyo.reshape(shape)]
+  if (y2.dtype == numpy.float32):
+    out = [a.astype(numpy.float32) for a in out]
+  if (full):
+    return tuple(out)
+  return out[0]
+
+################################################################
+
+def ftcurv_n(x,y,xo,sigma=1.,full=False):
+  """
+Calculates interpolatory splines under tension through any number of
+sequences of functional values at once.
+
+iarray = Ngl.ftcurv_n(xi, yi, xo, sigma=1., full=False)
+iarray, darray, sarray = Ngl.ftcurv_n(xi, yi, xo, full=True)
+
+xi -- A 1D array of length npts containing the abscissae shared by
+      all the curves, or an array the same shape as yi with the
+      abscissae of each one. They must be strictly increasing.
+
+yi -- An array of any dimensionality, whose rightmost dimension is
+      npts, containing the functional values of the curves.
+
+xo -- A 1D array of length nxo containing the abscissae for the
+      interpolated values.
+
+sigma -- The tension factor (the fitgrid "sig" parameter). Values
+         near zero give a cubic spline, and large values a nearly
+         piecewise linear curve. The default, 1., is fitgrid's.
+
+full -- If True, the first derivatives at xo and the integrals from
+        xo[0] to each of xo are returned as well.
+
+The results have the leftmost dimensions of yi, followed by nxo, and
+are float32 if yi is float32, and float64 otherwise.
+
+Each curve is fitted by fitgrid, as Ngl.ftcurv does, one after
+another and in single precision, so with the default sigma the
+values are exactly those of Ngl.ftcurv (float64 results hold them
+converted from float32). sigma is given to fitgrid as its "sig"
+parameter for the duration of the call only. The integrals are
+fitgrid's too, with one call for each of xo.
+  """
+  return _ftcurv_n("ftcurv_n",x,y,xo,0,0.,sigma,full)
+
+################################################################
+
+def ftcurvp_n(x,y,p,xo,sigma=1.,full=False):
+  """
+Calculates interpolatory splines under tension through any number of
+sequences of functional values of periodic functions at once.
+
+iarray = Ngl.ftcurvp_n(xi, yi, p, xo, sigma=1., full=False)
+iarray, sarray = Ngl.ftcurvp_n(xi, yi, p, xo, full=True)
+
+xi -- A 1D array of length npts containing the abscissae shared by
+      all the curves, or an array the same shape as yi with the
+      abscissae of each one.
+
+yi -- An array of any dimensionality, whose rightmost dimension is
+      npts, containing the functional values of the curves.
+
+p -- A scalar value specifying the period of the functions; the
+     value must not be less than xi(npts-1) - xi(0).
+
+xo -- A 1D array of length nxo containing the abscissae for the
+      interpolated values.
+
+sigma -- As for Ngl.ftcurv_n.
+
+full -- If True, the integrals from xo[0] to each of xo are returned
+        as well. They may cover any number of periods. fitgrid has
+        no derivatives of periodic splines, so none are returned.
+
+The results have the leftmost dimensions of yi, followed by nxo, and
+are float32 if yi is float32, and float64 otherwise. With the default
+sigma they are exactly those of Ngl.ftcurvp and Ngl.ftcurvpi.
+  """
+  return _ftcurv_n("ftcurvp_n",x,y,xo,1,p,sigma,full)
+
+################################################################
+
+def ftcurvpi_n(xl,xr,p,x,y,sigma=1.):
+  """
+Calculates integrals of interpolatory splines of any number of
+periodic functions between two specified points.
+
+iarray = Ngl.ftcurvpi_n(xl, xr, p, xi, yi, sigma=1.)
+
+xl, xr -- Scalar values containing the lower and upper limits of the
+          integration.
+
+p, xi, yi, sigma -- As for Ngl.ftcurvp_n.
+
+The result has the leftmost dimensions of yi (it is a scalar if yi
+is one-dimensional), and is float32 if yi is float32, and float64
+otherwise.
+  """
+  iyo = _ftcurv_n("ftcurvpi_n",x,y,[xl,xr],1,p,sigma,True)
+  if (iyo is None):
+    return None
+  return iyo[1][...,1]
+
+################################################################
+
 def gaus(n):
   """
 Computes gaussian latitudes and weights and returns a NumPy array
@@ -3462,6 +4801,29 @@ nlat -- A scalar integer equal to the number of latitude points per
 
 ################################################################
 
+def gc_azimuth(rlat1,rlon1,rlat2,rlon2):
+  """
+Calculates the initial azimuth, in degrees clockwise from north, of
+the great circle going from one point to another.
+
+azim = Ngl.gc_azimuth(lat1, lon1, lat2, lon2)
+
+lat1, lon1 -- Latitude and longitude, in degrees, of the starting
+              points. These can be scalars, lists, or NumPy arrays.
+
+lat2, lon2 -- Latitude and longitude, in degrees, of the end points.
+              These can be scalars, lists, or NumPy arrays.
+
+The arguments are broadcast against each other. The returned azimuths
+are in the interval [0.,360.), as a scalar if all of the arguments are
+scalars or as a NumPy array of the broadcast shape otherwise.
+  """
+  shape,args = _gc_broadcast(rlat1,rlon1,rlat2,rlon2)
+  azim = gc_azim_p(args[0],args[1],args[2],args[3],args[0].size)
+  return _gc_result(azim,shape,rlat1,rlon1,rlat2,rlon2)
+
+################################################################
+
 def gc_convert(angle,ctype):
   """
 Converts degrees along a great circle to radians, meters, feet, or
@@ -3517,6 +4879,33 @@ type -- A string (or integer) indicating the units you want to convert
 
 ################################################################
 
+def gc_destination(rlat,rlon,dist,azim):
+  """
+Calculates the points reached by going a given distance along great
+circles from a set of starting points.
+
+lat2,lon2 = Ngl.gc_destination(lat, lon, dist, azim)
+
+lat, lon -- Latitude and longitude, in degrees, of the starting
+            points. These can be scalars, lists, or NumPy arrays.
+
+dist -- The distance to go, in degrees of arc.
+
+azim -- The direction to start off in, in degrees clockwise from
+        north.
+
+The arguments are broadcast against each other. The returned
+longitudes are in the interval [-180.,180.). Both are scalars if all
+of the arguments are scalars, or NumPy arrays of the broadcast shape
+otherwise.
+  """
+  shape,args = _gc_broadcast(rlat,rlon,dist,azim)
+  lat2,lon2 = gc_dest_p(args[0],args[1],args[2],args[3],args[0].size,2)
+  return _gc_result(lat2,shape,rlat,rlon,dist,azim), \
+         _gc_result(lon2,shape,rlat,rlon,dist,azim)
+
+################################################################
+
 def gc_dist(rlat1,rlon1,rlat2,rlon2):
   """
 Calculates the distance in degrees along a great circle between two
@@ -3527,8 +4916,43 @@ dist = Ngl.gc_dist(lat1, lon1, lat2, lon2)
 lat1, lon1 -- Latitude and longitude of first point on the globe.
 
 lat2, lon2 -- Latitude and longitude of second point on the globe.
+
+The arguments can also be lists or NumPy arrays, which are broadcast
+against each other, in which case a NumPy array of distances of the
+broadcast shape is returned. Use Ngl.gc_dist_matrix for the distances
+between every point of one set and every point of another.
   """
-  return c_dgcdist(rlat1,rlon1,rlat2,rlon2,2)
+  shape,args = _gc_broadcast(rlat1,rlon1,rlat2,rlon2)
+  dist = gc_dist_p(args[0],args[1],args[2],args[3],args[0].size,2)
+  return _gc_result(dist,shape,rlat1,rlon1,rlat2,rlon2)
+
+################################################################
+
+def gc_dist_matrix(lat1,lon1,lat2,lon2):
+  """
+Calculates the distance in degrees along great circles between every
+point of one set and every point of another.
+
+dist = Ngl.gc_dist_matrix(lat1, lon1, lat2, lon2)
+
+lat1, lon1 -- Latitudes and longitudes, in degrees, of the first set
+              of N points.
+
+lat2, lon2 -- Latitudes and longitudes, in degrees, of the second set
+              of M points.
+
+The returned NumPy array has shape (N,M), with dist[i,j] being the
+distance from point i of the first set to point j of the second. Use
+Ngl.gc_convert to get the distances in other units.
+  """
+  lat1t = numpy.ascontiguousarray(lat1,dtype=numpy.float64).ravel()
+  lon1t = numpy.ascontiguousarray(lon1,dtype=numpy.float64).ravel()
+  lat2t = numpy.ascontiguousarray(lat2,dtype=numpy.float64).ravel()
+  lon2t = numpy.ascontiguousarray(lon2,dtype=numpy.float64).ravel()
+  if (lat1t.size != lon1t.size or lat2t.size != lon2t.size):
+    print("gc_dist_matrix: the latitude and longitude arrays of each set must be the same size.")
+    return None
+  return gc_dist_pairs_p(lat1t,lon1t,lat1t.size,lat2t,lon2t,lat2t.size,2)
 
 ################################################################
 
@@ -3637,30 +5061,26 @@ Any area returned is that bounded by the arcs of great circles
 connecting the vertices.
 
   """
-  lat1t = numpy.atleast_1d(numpy.array(lat1)).astype(float)
-  lon1t = numpy.atleast_1d(numpy.array(lon1)).astype(float)
-  lat2t = numpy.atleast_1d(numpy.array(lat2)).astype(float)
-  lon2t = numpy.atleast_1d(numpy.array(lon2)).astype(float)
-  lat3t = numpy.atleast_1d(numpy.array(lat3)).astype(float)
-  lon3t = numpy.atleast_1d(numpy.array(lon3)).astype(float)
-  
-  rtn = numpy.zeros(len(lat1t),'f')
+  shape,args = _gc_broadcast(lat1,lon1,lat2,lon2,lat3,lon3)
+  lat1t,lon1t,lat2t,lon2t,lat3t,lon3t = args
+  n = lat1t.size
+
   pi  = 4.*math.atan(1.)
   d2r = pi/180.
   tol = 1.e-7
-  for i in range(len(lat1t)):
-    a = d2r*gc_dist(lat1t[i], lon1t[i], lat2t[i], lon2t[i])
-    b = d2r*gc_dist(lat2t[i], lon2t[i], lat3t[i], lon3t[i])
-    c = d2r*gc_dist(lat3t[i], lon3t[i], lat1t[i], lon1t[i])
-    sa, sb, sc = math.sin(a), math.sin(b), math.sin(c)
-    if (abs(sa) < tol or abs(sb) < tol or abs(sc) < tol):
-      print("gc_tarea: input vertices must be distinct and not be polar opposites.")
-      sys.exit()
-    ca, cb, cc = math.cos(a), math.cos(b), math.cos(c)
-    sang1 = math.acos( (ca-cb*cc)/(sb*sc) )
-    sang2 = math.acos( (cb-ca*cc)/(sa*sc) )
-    sang3 = math.acos( (cc-ca*cb)/(sa*sb) )
-    rtn[i] = radius*radius*(sang1 + sang2 + sang3 - pi)
+  a = d2r*gc_dist_p(lat1t,lon1t,lat2t,lon2t,n,2)
+  b = d2r*gc_dist_p(lat2t,lon2t,lat3t,lon3t,n,2)
+  c = d2r*gc_dist_p(lat3t,lon3t,lat1t,lon1t,n,2)
+  sa, sb, sc = numpy.sin(a), numpy.sin(b), numpy.sin(c)
+  if (numpy.any(numpy.abs(sa) < tol) or numpy.any(numpy.abs(sb) < tol) or \
+      numpy.any(numpy.abs(sc) < tol)):
+    print("gc_tarea: input vertices must be distinct and not be polar opposites.")
+    sys.exit()
+  ca, cb, cc = numpy.cos(a), numpy.cos(b), numpy.cos(c)
+  sang1 = numpy.arccos( (ca-cb*cc)/(sb*sc) )
+  sang2 = numpy.arccos( (cb-ca*cc)/(sa*sc) )
+  sang3 = numpy.arccos( (cc-ca*cb)/(sa*sb) )
+  rtn = (radius*radius*(sang1 + sang2 + sang3 - pi)).astype('f')
   del lat1t,lon1t,lat2t,lon2t,lat3t,lon3t,a,b,c,sa,sb,sc,ca,cb,cc, \
       sang1,sang2,sang3,tol
   if (_is_scalar(lat1)):
@@ -3890,6 +5310,53 @@ resource_name -- The name of the resource whose value you want to
 
 ################################################################
 
+def get_images(wks,rgba=False):
+  """
+Returns the frames completed on an in-memory image workstation since
+the last call, as a list with one entry per frame. Each frame is read
+back from the PNG file the workstation wrote to its temporary
+directory (on /dev/shm when available), and the file is then deleted;
+see Ngl.open_wks.
+
+images = Ngl.get_images(wks, rgba=False)
+
+wks -- The identifier returned from calling Ngl.open_wks with
+       res.nglImageInMemory set to True.
+
+rgba -- If False, each frame is returned as the bytes of a PNG file.
+        If True, each frame is decoded into a NumPy array of type
+        uint8 and shape (height, width, 4), holding the red, green,
+        blue, and alpha values of each pixel.
+  """
+  if (not wks in _image_wks_dirs):
+    print("get_images: workstation was not opened with nglImageInMemory")
+    return None
+#
+#  Frames are named "frame.png" or "frame.NNNNNN.png", so order them
+#  by frame number.
+#
+  image_dir = _image_wks_dirs[wks]
+  files = []
+  for name in os.listdir(image_dir):
+    m = re.match(r"frame(\.(\d+))?\.png$",name)
+    if (m):
+      files.append((int(m.group(2) or 1),name))
+  files.sort()
+
+  images = []
+  for num,name in files:
+    path = os.path.join(image_dir,name)
+    fp = open(path,"rb")
+    data = fp.read()
+    fp.close()
+    os.remove(path)
+    if (rgba):
+      data = png_to_rgba_p(numpy.frombuffer(data,dtype=numpy.uint8))
+    images.append(data)
+  return images
+
+################################################################
+
 def get_integer(obj,name):
   """
 Retrieves the value of a resource that uses an integer scalar.
@@ -3993,6 +5460,50 @@ def _get_parent_workstation(plot_id):
 
 ################################################################
 
+def get_stats(reset=False,trace_file=None):
+  """
+Returns the timing statistics collected since Ngl.enable_stats was
+called.
+
+stats = Ngl.get_stats(reset=False, trace_file=None)
+
+reset -- If True, the statistics are cleared after they are returned.
+
+trace_file -- The name of a file to write the trace events to, in the
+              Chrome trace event (JSON) format, which can be viewed
+              with chrome://tracing or Perfetto. Trace events are only
+              kept if Ngl.enable_stats was called with trace=True.
+
+The return value is a dictionary keyed by stage name, each value
+being a dictionary with the number of calls ("count"), the total wall
+clock time in seconds ("seconds"), and the number of bytes of data
+converted ("bytes"). Stages are nested: the time for "draw" is also
+counted in the plotting function that called it, for example.
+  """
+  stats = {}
+  raw = get_stats_p()
+  for name in raw.keys():
+    count,seconds,nbytes = raw[name]
+    stats[name] = {"count" : count, "seconds" : seconds, "bytes" : nbytes}
+
+  if (not trace_file is None):
+    import json
+    pid = os.getpid()
+    events = []
+    for name,start,duration in get_trace_p():
+      events.append({"name" : name, "cat" : "ngl", "ph" : "X",
+                     "ts" : start*1.e6, "dur" : duration*1.e6,
+                     "pid" : pid, "tid" : 0})
+    fp = open(trace_file,"w")
+    json.dump({"traceEvents" : events, "displayTimeUnit" : "ms"},fp)
+    fp.close()
+
+  if (reset):
+    set_stats(get_stats_level())
+  return stats
+
+################################################################
+
 def get_string(obj,name):
   """
 Retrieves the value of a resource that uses a string.
@@ -4225,12 +5736,14 @@ res -- An optional instance of the Resources class having Labelbar
   _set_spc_defaults(0)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
   _set_labelbar_res(rlist,rlist1,False) # Set some addtl labelbar resources
 
@@ -4265,12 +5778,14 @@ res -- An optional instance of the Resources class having Labelbar
   _set_spc_defaults(0)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
   _set_legend_res(rlist,rlist1)      # Set some addtl legend resources
 
@@ -4344,12 +5859,14 @@ res -- An optional instance of the Resources class having Map
   _set_spc_defaults(1)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
   _set_map_res(rlist,rlist1)           # Set some addtl map resources
 
@@ -4387,12 +5904,14 @@ res -- An optional optional instance of the Resources class having
   _set_spc_defaults(0)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
   maximize_plots(wks,_pobj2lst(plot),1,0,pvoid())
 
 ################################################################
@@ -4447,6 +5966,72 @@ cmap2 -- A second n x 3 array of RGB triplets, or a predefined colormap name.
 
 ################################################################
 
+def mesh(x,y,xbounds=None,ybounds=None,element_nodes=None,triangulate=True):
+  """
+Creates an unstructured mesh once, so that any number of contour
+plots of 1D data on it can share it, and returns a Mesh object.
+
+m = Ngl.mesh(x, y, xbounds=None, ybounds=None, element_nodes=None,
+             triangulate=True)
+
+x,y -- One-dimensional arrays of the same length, holding the
+       coordinates of the mesh points (usually longitudes and
+       latitudes).
+
+xbounds,ybounds -- Optional two-dimensional arrays, dimensioned
+                   len(x) x nvertices, holding the cell boundaries.
+                   These are needed for cnFillMode = "CellFill".
+
+element_nodes -- An optional array, dimensioned ntriangles x 3,
+                 holding the indices of the triangle vertices. Set
+                 sfFirstNodeIndex in the plot resources if the
+                 indices don't start at zero.
+
+triangulate -- If True (the default) and element_nodes is not set,
+               the points are triangulated once, here, on the sphere.
+               Set this to False if x and y are not longitudes and
+               latitudes.
+
+Pass the returned object to Ngl.contour or Ngl.contour_map with the
+"mesh" keyword; then only the data values are sent with each plot.
+Call its destroy method once it is no longer needed.
+  """
+  x2 = numpy.ravel(numpy.asarray(x,dtype=numpy.float64))
+  y2 = numpy.ravel(numpy.asarray(y,dtype=numpy.float64))
+  if (len(x2) != len(y2)):
+    print("mesh - x and y must be the same length")
+    return None
+
+  if (xbounds is not None and ybounds is not None):
+    xb = numpy.asarray(xbounds,dtype=numpy.float64)
+    yb = numpy.asarray(ybounds,dtype=numpy.float64)
+    if (xb.shape != yb.shape or len(xb.shape) != 2 or 
+        xb.shape[0] != len(x2)):
+      print("mesh - xbounds and ybounds must both be dimensioned len(x) x nvertices")
+      return None
+    nvert = xb.shape[1]
+  else:
+    xb    = numpy.zeros(1)
+    yb    = numpy.zeros(1)
+    nvert = 0
+
+  if (element_nodes is not None):
+    nodes = numpy.asarray(element_nodes,dtype=numpy.int32)
+    if (len(nodes.shape) != 2 or nodes.shape[1] != 3):
+      print("mesh - element_nodes must be dimensioned ntriangles x 3")
+      return None
+    ntri = nodes.shape[0]
+  else:
+    nodes = numpy.zeros(1,dtype=numpy.int32)
+    ntri  = 0
+
+  id = create_mesh(x2,y2,len(x2),xb,yb,nvert,nodes,ntri,int(triangulate))
+  if (id < 0):
+    return None
+  return Mesh(id,len(x2))
+
+################################################################
+
 def natgrid(x,y,z,xo,yo):
   """
 Uses a natural neighbor algorithm to interpolate 2-dimensional
@@ -4499,6 +6084,73 @@ xo, yo -- One-dimensional NumPy float arrays or Python lists (of
   else:
     return zo
 
+################################################################
+
+def natgrid_interpolator(x,y,xo,yo):
+  """
+Triangulates randomly spaced 2-dimensional data points once, and
+finds the natural neighbor weights from them to an output grid, so
+that any number of fields at those points can be interpolated to the
+grid without doing that again. Returns a NatgridInterpolator object.
+
+interp = Ngl.natgrid_interpolator(x, y, xo, yo)
+zo     = interp.interpolate(z)
+
+x, y -- One-dimensional arrays of the X and Y coordinate points of the
+        input data.
+
+xo, yo -- One-dimensional arrays (of length numxout and numyout)
+          containing the coordinate points of the output data grid.
+
+interpolate takes an array whose last dimension is len(x), holding
+one field or a stack of them, and returns an array of the same leading
+dimensions followed by numxout x numyout.
+
+Inside the convex hull of the input points this is the linear natural
+neighbor (Sibson) interpolation that Ngl.natgrid does by default, and
+gives the same values. Outside the hull it is not: Ngl.natgrid
+extrapolates there by default ("ext" = 1), but the interpolator sets
+those output points to the "nul" parameter (see Ngl.nnsetp) as it was
+when the interpolator was created, and a warning is printed if "ext"
+is set. The number of such points is kept in interp.outside. Use
+Ngl.natgrid if extrapolated values are wanted. Output points on the
+hull itself are interpolated. The other natgrid options, such as
+nonlinear interpolation ("igr"), don't apply. Input points with the
+same coordinates as an earlier point are ignored. The output grid is
+done in parallel if PyNGL was built with OpenMP.
+  """
+  x2  = numpy.ravel(numpy.asarray(x,dtype=numpy.float64))
+  y2  = numpy.ravel(numpy.asarray(y,dtype=numpy.float64))
+  xo2 = numpy.ravel(numpy.asarray(xo,dtype=numpy.float64))
+  yo2 = numpy.ravel(numpy.asarray(yo,dtype=numpy.float64))
+  if (len(x2) != len(y2)):
+    print("natgrid_interpolator: x and y must be the same length")
+    return None
+
+  ier,weights = nn_weights_p(len(x2),x2,y2,len(xo2),len(yo2),xo2,yo2)
+  if (ier == 1):
+    print("natgrid_interpolator: at least three input points are needed")
+    return None
+  elif (ier == 2):
+    print("natgrid_interpolator: all of the input points are on one line")
+    return None
+  elif (ier != 0):
+    print("natgrid_interpolator: unable to allocate memory for the weights")
+    return None
+  interp = NatgridInterpolator(weights,len(x2),len(xo2),len(yo2),
+                               c_nngetrd("nul"))
+#
+#  The output points outside the convex hull have no weights. Ngl.natgrid
+#  would extrapolate to them when "ext" is set, so say how many there are.
+#
+  zo = nn_apply_p(weights,numpy.ones(len(x2)),1,numpy.nan)
+  interp.outside = int(numpy.sum(numpy.isnan(zo)))
+  if (interp.outside > 0 and c_nngeti("ext") != 0):
+    print("natgrid_interpolator: warning: " + str(interp.outside) +
+          " output points are outside the convex hull of the input points.")
+    print("  They will get the \"nul\" value, where Ngl.natgrid would extrapolate.")
+  return interp
+
 def _ncargpath(type):
   return pynglpath(type)
 
@@ -4543,9 +6195,12 @@ xndc,yndc -- One dimensional (masked) arrays containing values to be
   fvy,ismy = _set_default_msg(fvy)
 
 
-  error,xout,yout,status,range = \
-     NhlPNDCToData(_int_id(obj),x2,y2,len(_promote_scalar(x2)),fvx,fvy,
-                   ismx,ismy)
+  x2 = numpy.ravel(numpy.asarray(_promote_scalar(x2),dtype=numpy.float32))
+  y2 = numpy.ravel(numpy.asarray(_promote_scalar(y2),dtype=numpy.float32))
+  xout = numpy.empty(len(x2),numpy.float32)
+  yout = numpy.empty(len(x2),numpy.float32)
+  error,status,range = ndc_transform_p(_int_id(obj),1,x2,y2,xout,yout,
+                                       fvx,fvy,ismx,ismy)
 
 # Convert to masked array if input was masked array, or any of the
 # values are outside the plot data space.
@@ -4774,26 +6429,65 @@ name -- The name of the workstation.
 
 res -- An optional instance of the Resources class having Workstation
        resources as attributes.
+
+For a "png" workstation, set res.nglImageInMemory = True to have each
+frame kept for Ngl.get_images instead of being left where name says.
+The frames are not rendered into memory: the PNG driver can only write
+files, so each frame is still written as a PNG file, to a private
+directory in /dev/shm (a RAM-backed file system on Linux) or else in
+the system temporary directory, and name is ignored. Ngl.get_images
+reads each frame back and deletes its file, and the directory is
+removed by Ngl.delete_wks, if the workstation can't be opened, or when
+Python exits.
+
+All the colormap files are read when the first workstation is
+opened. To cut that startup time, set the environment variable
+PYNGL_LAZY_COLORMAPS before importing Ngl: each colormap file is then
+read only when a resource passed to a PyNGL function first names its
+colormap. Colormaps that are only named in resource files, or in
+resources set outside of PyNGL, are not found that way. The files are
+found in the directories NCARG_COLORMAPS names when the first
+workstation is opened; from then on, NCARG_COLORMAPS points to a
+private temporary directory that PyNGL links each file into to load
+it, and which is removed when Python exits.
   """
 #
   _set_spc_defaults(1)
-  global first_call_to_open_wks
+  global first_call_to_open_wks, _hlu_started
   rlist = _crt_dict(wk_rlist)
 
+#
+#  Send the frames of an in-memory image workstation to a private
+#  temporary directory.
+#
+  image_dir = None
+  if (rlist.pop("nglImageInMemory",False)):
+    if (wk_type.lower() in ["png","newpng"]):
+      import tempfile
+      shm_dir = _image_shm_dir
+      if (not (os.path.isdir(shm_dir) and os.access(shm_dir,os.W_OK))):
+        shm_dir = None
+      image_dir = tempfile.mkdtemp(prefix="pyngl",dir=shm_dir)
+      wk_name   = os.path.join(image_dir,"frame")
+    else:
+      print("open_wks: nglImageInMemory is only supported for 'png' workstations")
+
 #
 # Divide out "app" and other resources.
 # 
   rlist1 = {}
   rlist2 = {}
 
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:3] == "app"):
       rlist2[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 # 
 #  Initialize the special resource values, and make sure 
@@ -4851,8 +6545,13 @@ res -- An optional instance of the Resources class having Workstation
     else:
       os.environ["NCARG_SYSAPPRES"] = _pynglpath_ncarg() + "/sysappres"
 
+    if (_lazy_colormaps):
+      _colormap_dir()
     first_call_to_open_wks = first_call_to_open_wks + 1
 
+  if (_lazy_colormaps):
+    _load_named_colormaps(rlist)
+
 #
 #  Lists of triplets for color tables must be numpy arrays.
 #
@@ -4862,12 +6561,27 @@ res -- An optional instance of the Resources class having Workstation
 #
     if type(rlist["wkColorMap"][0]) == type([0]):
       print("opn_wks: lists of triplets for color tables must be NumPy arrays")
+      if (not image_dir is None):
+        _remove_image_dir(image_dir)
       return None
 
 #
 #  Call the wrapped function and return.
 #
-  iopn = open_wks_wrap(wk_type,wk_name,rlist1,rlist2,pvoid())
+  try:
+    iopn = open_wks_wrap(wk_type,wk_name,rlist1,rlist2,pvoid())
+  except:
+    if (not image_dir is None):
+      _remove_image_dir(image_dir)
+    raise
+  if (_lazy_colormaps and not _hlu_started):
+    _clear_colormap_dir()
+  _hlu_started = True
+  if (not image_dir is None):
+    if (iopn > 0):
+      _image_wks_dirs[iopn] = image_dir
+    else:
+      _remove_image_dir(image_dir)
   del rlist
   del rlist1
   del rlist2
@@ -4910,77 +6624,118 @@ dims -- An array of integers indicating the configuration of the plots
  
 res -- An optional instance of the Resources class having PyNGL
        resources as attributes.
+
+If res.nglPanelLayoutOnly is True, nothing is drawn and the plots are
+left untouched. Instead, a NumPy array of shape (len(plots)+1, 4) is
+returned, holding the vpXF, vpYF, vpWidthF, and vpHeightF each plot
+would be given (-999. for missing plots). The last row is the
+position of the common labelbar, if nglPanelLabelBar is True. Since
+the plots are not moved, these positions are estimated by scaling
+each plot's current viewport and bounding box. When the panel is
+drawn, the plots are queried again after they are moved.
   """
   _set_spc_defaults(1)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
   rlist2 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:3] == "ngl"):
       if (len(key) == 21 and key[0:21] == "nglPanelFigureStrings"):
-        _set_spc_res(key[3:],rlist[key])
-        _set_spc_res("PanelFigureStringsCount",len(rlist[key]))
+        spc_res[key[3:]] = rlist[key]
+        spc_res["PanelFigureStringsCount"] = len(rlist[key])
       elif (key[0:25] == "nglPanelFigureStringsJust"):
         if(_check_res_value(rlist[key],"TopLeft",0)):
-          _set_spc_res(key[3:],0)
+          spc_res[key[3:]] = 0
         elif(_check_res_value(rlist[key],"CenterLeft",1)):
-          _set_spc_res(key[3:],1)
+          spc_res[key[3:]] = 1
         elif(_check_res_value(rlist[key],"BottomLeft",2)):
-          _set_spc_res(key[3:],2)
+          spc_res[key[3:]] = 2
         elif(_check_res_value(rlist[key],"TopCenter",3)):
-          _set_spc_res(key[3:],3)
+          spc_res[key[3:]] = 3
         elif(_check_res_value(rlist[key],"CenterCenter",4)):
-          _set_spc_res(key[3:],4)
+          spc_res[key[3:]] = 4
         elif(_check_res_value(rlist[key],"BottomCenter",5)):
-          _set_spc_res(key[3:],5)
+          spc_res[key[3:]] = 5
         elif(_check_res_value(rlist[key],"TopRight",6)):
-          _set_spc_res(key[3:],6)
+          spc_res[key[3:]] = 6
         elif(_check_res_value(rlist[key],"CenterRight",7)):
-          _set_spc_res(key[3:],7)
+          spc_res[key[3:]] = 7
         elif(_check_res_value(rlist[key],"BottomRight",8)):
-          _set_spc_res(key[3:],8)
+          spc_res[key[3:]] = 8
       else:
-        _set_spc_res(key[3:],rlist[key])
+        spc_res[key[3:]] = rlist[key]
     elif (key[0:2] == "lb"):
       if (key == "lbLabelAlignment"):
         if (_check_res_value(rlist[key],"BoxCenters",0)):
-          _set_spc_res("PanelLabelBarAlignment",0)
+          spc_res["PanelLabelBarAlignment"] = 0
         elif (_check_res_value(rlist[key],"InteriorEdges",1)):
-          _set_spc_res("PanelLabelBarAlignment",1)
+          spc_res["PanelLabelBarAlignment"] = 1
         elif (_check_res_value(rlist[key],"ExternalEdges",2)):
-          _set_spc_res("PanelLabelBarAlignment",2)
+          spc_res["PanelLabelBarAlignment"] = 2
         else:
-          _set_spc_res("PanelLabelBarAlignment",rlist[key])
+          spc_res["PanelLabelBarAlignment"] = rlist[key]
       elif (key == "lbPerimOn"):
         if (rlist[key] == 1):
-          _set_spc_res("PanelLabelBarPerimOn",1)
+          spc_res["PanelLabelBarPerimOn"] = 1
         elif (rlist[key] == 0):
-          _set_spc_res("PanelLabelBarPerimOn",0)
+          spc_res["PanelLabelBarPerimOn"] = 0
         else:
-          _set_spc_res("PanelLabelBarPerimOn",rlist[key])
+          spc_res["PanelLabelBarPerimOn"] = rlist[key]
       elif (key == "lbLabelAutoStride"):
         if (rlist[key] == 1):
-          _set_spc_res("PanelLabelBarAutoStride",1)
+          spc_res["PanelLabelBarAutoStride"] = 1
         elif (rlist[key] == 0):
-          _set_spc_res("PanelLabelBarAutoStride",0)
+          spc_res["PanelLabelBarAutoStride"] = 0
         else:
-          _set_spc_res("PanelLabelBarAutoStride",rlist[key])
+          spc_res["PanelLabelBarAutoStride"] = rlist[key]
       elif (key == "lbLabelFontHeightF"):
-        _set_spc_res("PanelLabelBarFontHeightF",rlist[key])
+        spc_res["PanelLabelBarFontHeightF"] = rlist[key]
       elif (key == "lbOrientation"):
         if (_check_res_value(rlist[key],"Vertical",1)):
-          _set_spc_res("PanelLabelBarOrientation",1)
+          spc_res["PanelLabelBarOrientation"] = 1
         elif (_check_res_value(rlist[key],"Horizontal",0)):
-          _set_spc_res("PanelLabelBarOrientation",0)
+          spc_res["PanelLabelBarOrientation"] = 0
         else:
-          _set_spc_res("PanelLabelBarOrientation",rlist[key])
+          spc_res["PanelLabelBarOrientation"] = rlist[key]
         
 
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
   panel_wrap(wks,_pseq2lst(plots),len(plots),dims,len(dims),rlist1,rlist2,pvoid())
   del rlist
   del rlist1
+  if (get_nglRes_i(58)):
+    return panel_layout_p()
+
+################################################################
+
+def plot_transform(plot):
+  """
+Gets the transformation between data and NDC space of a plot, for
+converting large numbers of points, or converting points over and
+over (to follow the mouse, say). Returns a PlotTransform object.
+
+trans = Ngl.plot_transform(plot)
+xndc,yndc   = trans.datatondc(xdata, ydata, xout=None, yout=None)
+xdata,ydata = trans.ndctodata(xndc, yndc, xout=None, yout=None)
+
+plot -- The identifier returned from calling any plot object creation
+        function, like Ngl.xy, Ngl.contour, Ngl.vector_map, etc.
+
+Unlike Ngl.datatondc and Ngl.ndctodata, the arrays can have any
+shape, can be float64, and the results can go in arrays given by the
+caller. For plots with a linear or logarithmic transformation (XY
+plots, and contour, vector and streamline plots that aren't over a
+map), the transformation is taken from the plot's viewport and data
+limits once, checked against the HLU transformation, and then done
+in double precision in NumPy. Other plots go through the HLU
+transformation, in float, without any new arrays other than the
+results. Use trans.refresh() if the plot's viewport or data limits
+change.
+  """
+  return PlotTransform(plot)
 
 ################################################################
 
@@ -5079,6 +6834,9 @@ x, y -- One-dimensional (masked) NumPy arrays or Python lists containing
 
 res -- An optional instance of the Resources class having
        GraphicStyle resources as attributes.
+
+Set res.nglPolymarkerDensity = True to draw very large numbers of
+points as a 2D histogram of counts instead (see Ngl.add_polymarker).
   """
   return(_poly(wks,plot,x,y,NhlPOLYMARKER,0,rlistc))
 
@@ -5097,6 +6855,9 @@ x, y -- One-dimensional (masked) NumPy arrays or Python lists containing
 
 res -- An optional instance of the Resources class having
        GraphicStyle resources as attributes.
+
+Set res.nglPolymarkerDensity = True to draw very large numbers of
+points as a 2D histogram of counts instead (see Ngl.add_polymarker).
   """
   return(_poly(wks,0,x,y,NhlPOLYMARKER,1,rlistc))
 
@@ -5415,6 +7176,269 @@ restore -- An optional logical value. If True and the member plot
   """
   NhlRemoveOverlay(_int_id(plot_id1),_int_id(plot_id2),restore)
 
+################################################################
+#
+#  Process-parallel frame rendering.
+#
+#  The HLU library keeps global state, so a single process can
+#  only draw one frame at a time. RenderPool forks worker processes
+#  that each open their own workstation, hands them the data for
+#  each frame through shared memory, and renames the image each
+#  worker produces to the frame's number in the final sequence.
+#
+################################################################
+
+def _render_put_arrays(frame):
+#
+#  Copy the arrays for one frame into shared memory blocks, and
+#  return the blocks along with a picklable description of them.
+#
+  from multiprocessing import shared_memory
+  if not isinstance(frame,(tuple,list)):
+    frame = (frame,)
+  blocks = []
+  specs  = []
+  for arr in frame:
+    fill_value = None
+    if _is_numpy_ma(arr):
+      fill_value = arr.fill_value
+      arr = arr.filled(fill_value)
+    arr = numpy.ascontiguousarray(arr)
+    shm = shared_memory.SharedMemory(create=True,size=max(arr.nbytes,1))
+    numpy.ndarray(arr.shape,dtype=arr.dtype,buffer=shm.buf)[...] = arr
+    blocks.append(shm)
+    specs.append((shm.name,arr.shape,arr.dtype.str,fill_value))
+  return blocks,specs
+
+def _render_worker(wid,render_func,wk_type,wk_name,wk_rlist,tasks,results):
+  import glob, traceback
+  from multiprocessing import shared_memory
+
+#
+#  The workstation writes "wname.png" or "wname.NNNNNN.png". The "."
+#  after the worker number keeps worker 100 from matching the files
+#  of worker 1000.
+#
+  wname = "%s_w%03d" % (wk_name,wid)
+  pattern = wname + ".*" + wk_type
+  try:
+    wks = open_wks(wk_type,wname,wk_rlist)
+    if wks is None:
+      raise RuntimeError("could not open workstation " + wname)
+  except Exception:
+    results.put((-1,None,traceback.format_exc()))
+    return
+
+  while True:
+    task = tasks.get()
+    if task is None:
+      break
+    index,specs = task
+    blocks = []
+    arrays = []
+    try:
+      for name,shape,dtype,fill_value in specs:
+        shm = shared_memory.SharedMemory(name=name)
+        blocks.append(shm)
+        arr = numpy.ndarray(shape,dtype=dtype,buffer=shm.buf)
+        if not fill_value is None:
+          arr = ma.masked_where(arr == fill_value,arr,copy=False)
+          arr.fill_value = fill_value
+        arrays.append(arr)
+      render_func(wks,index,*arrays)
+#
+#  The render function must have advanced exactly one frame.
+#
+      produced = sorted(glob.glob(pattern))
+      if len(produced) != 1:
+        for f in produced:
+          os.remove(f)
+        raise RuntimeError("render function produced %d frames instead of 1" \
+                           % len(produced))
+      output = "%s.%06d.%s" % (wk_name,index+1,wk_type)
+      os.replace(produced[0],output)
+      results.put((index,output,None))
+    except Exception:
+      results.put((index,None,traceback.format_exc()))
+    finally:
+      del arrays
+      for shm in blocks:
+        try:
+          shm.close()
+        except BufferError:    # render_func kept a view of the data
+          pass
+
+  delete_wks(wks)
+#
+#  The worker leaves with os._exit, so atexit functions don't run.
+#
+  _remove_colormap_dir()
+
+class RenderPool:
+  """
+Renders image frames in parallel with a pool of worker processes,
+each with its own workstation.
+
+pool = Ngl.RenderPool(render_func, wk_name, wk_type="png",
+                      wk_rlist=None, nworkers=None)
+
+render_func -- A function called as render_func(wks, index, *arrays)
+               in a worker process. It must draw the frame with the
+               given data and advance the frame exactly once, for
+               example by calling Ngl.contour_map with the default
+               nglFrame = True.
+
+wk_name -- The base name of the output files. Frame i (counting from
+           0) is written to "wk_name.%06d.png" % (i+1).
+
+wk_type -- The type of workstation. Only "png" is supported, since each
+           frame must be a separate file.
+
+wk_rlist -- An optional instance of the Resources class having
+            Workstation resources as attributes, used for every
+            worker's workstation.
+
+nworkers -- The number of worker processes. Defaults to the number of
+            CPUs.
+
+Use pool.map(frames) to render an iterable of frames, where each frame
+is a NumPy (masked) array or a tuple of them. It returns the output
+file names in frame order as the frames complete. If a frame fails,
+the pool is terminated and a RuntimeError with the worker's traceback
+is raised. Call pool.close() when done, or use the pool in a "with"
+statement.
+
+The workers are forked, so render_func can be any function, but the
+pool should be created before any workstation is opened in the
+calling process, since the workers would otherwise inherit its HLU
+state.
+  """
+  def __init__(self,render_func,wk_name,wk_type="png",wk_rlist=None,
+               nworkers=None):
+    import multiprocessing
+    if wk_type != "png":
+      raise ValueError("RenderPool: wk_type must be 'png'")
+    if first_call_to_open_wks != 0:
+      print("RenderPool: warning - a workstation has already been opened;")
+      print("            workers will inherit this process's HLU state.")
+    if nworkers is None:
+      nworkers = multiprocessing.cpu_count()
+    ctx = multiprocessing.get_context("fork")
+#
+#  Start the shared memory tracker before forking, so the workers
+#  share it rather than each starting their own, which would report
+#  the parent's blocks as leaked when the worker exits.
+#
+    from multiprocessing import resource_tracker
+    resource_tracker.ensure_running()
+    self.nworkers = max(1,int(nworkers))
+    self._tasks   = ctx.Queue()
+    self._results = ctx.Queue()
+    self._procs   = []
+    for wid in range(self.nworkers):
+      p = ctx.Process(target=_render_worker, \
+                      args=(wid,render_func,wk_type,wk_name,wk_rlist, \
+                            self._tasks,self._results))
+      p.daemon = True
+      p.start()
+      self._procs.append(p)
+
+  def _get_result(self):
+    import queue
+    while True:
+      try:
+        return self._results.get(timeout=1.0)
+      except queue.Empty:
+        for p in self._procs:
+          if not p.is_alive() and p.exitcode != 0:
+            self.terminate()
+            raise RuntimeError("RenderPool: worker process died with exit code %d" \
+                               % p.exitcode)
+
+  def map(self,frames):
+    pending = {}       # index -> shared memory blocks
+    done    = {}       # index -> output file name
+    nextout = 0
+    nsent   = 0
+    frames  = iter(frames)
+    exhausted = False
+    try:
+      while True:
+#
+#  Keep a bounded number of frames in flight so shared memory use
+#  doesn't grow with the length of the sequence.
+#
+        while not exhausted and len(pending) < 2*self.nworkers:
+          try:
+            frame = next(frames)
+          except StopIteration:
+            exhausted = True
+            break
+          blocks,specs = _render_put_arrays(frame)
+          pending[nsent] = blocks
+          self._tasks.put((nsent,specs))
+          nsent += 1
+        if not pending:
+          break
+        index,output,err = self._get_result()
+        if not err is None:
+          self.terminate()
+          if index < 0:
+            raise RuntimeError("RenderPool: a worker failed to open its workstation:\n" + err)
+          raise RuntimeError("RenderPool: frame %d failed:\n%s" % (index,err))
+        for shm in pending.pop(index):
+          shm.close()
+          shm.unlink()
+        done[index] = output
+        while nextout in done:
+          yield done.pop(nextout)
+          nextout += 1
+    finally:
+      for blocks in pending.values():
+        for shm in blocks:
+          shm.close()
+          shm.unlink()
+
+  def close(self):
+    for p in self._procs:
+      self._tasks.put(None)
+    for p in self._procs:
+      p.join()
+    self._procs = []
+
+  def terminate(self):
+    for p in self._procs:
+      p.terminate()
+    for p in self._procs:
+      p.join()
+    self._procs = []
+
+  def __enter__(self):
+    return self
+
+  def __exit__(self,exc_type,exc_value,tb):
+    if exc_type is None:
+      self.close()
+    else:
+      self.terminate()
+    return False
+
+def render_frames(render_func,frames,wk_name,wk_type="png",wk_rlist=None,
+                  nworkers=None):
+  """
+Renders a sequence of frames in parallel and returns the list of
+output file names in frame order. See Ngl.RenderPool for details.
+
+files = Ngl.render_frames(render_func, frames, wk_name, wk_type="png",
+                          wk_rlist=None, nworkers=None)
+
+wk_rlist -- An optional instance of the Resources class having
+            Workstation resources as attributes, used for every
+            worker's workstation.
+  """
+  with RenderPool(render_func,wk_name,wk_type,wk_rlist,nworkers) as pool:
+    return list(pool.map(frames))
+
 ################################################################
 
 def retrieve_colormap(wks):
@@ -5616,8 +7640,15 @@ plotid -- The identifier returned from calling any object creation
 
 res -- An optional instance of the Resources class having PyNGL
        resources as attributes containing the resources you want to
-set.
-  """
+set. It can also be an Ngl.ResourceList, which is converted to an
+HLU resource list only once, however many times it is used.
+  """
+  if (isinstance(rlistc,ResourceList)):
+    rlist = rlistc._set_values_rlist()
+    if (rlist is not None):
+      if (_lazy_colormaps and first_call_to_open_wks > 0):
+        _load_named_colormaps(rlistc._dict)
+      return NhlSetValues(_int_id(obj),rlist)
   rlist = _crt_dict(rlistc)
   values = NhlSetValues(_int_id(obj),rlist)
   del rlist
@@ -5636,6 +7667,12 @@ wks -- The identifier returned from calling Ngl.open_wks.
 
 res -- A required instance of the Resources class having special
        "skt" resources as attributes.
+
+When drawing many soundings on the same workstation, set
+res.sktCacheBackground = True. The first call with a given set of
+resources creates the background as usual; later calls with the same
+workstation and resources redraw its lines and labels and return the
+same plot, instead of creating a new one each time.
   """
 #
 #  This program generates a skew-t, log p thermodynamic diagram.  
@@ -5668,6 +7705,7 @@ res -- A required instance of the Resources class having special
   localOpts.sktDrawHeightScale    = False
   localOpts.sktDrawHeightScaleFt  = True  # default is feet [otherwise km]
   localOpts.sktDrawStandardAtmThk = 2.0
+  localOpts.sktCacheBackground    = False
   localOpts.Font                  = "helvetica"
   localOpts.tiMainString          = "   "
   localOpts.vpXF                  = 0.07
@@ -5820,6 +7858,12 @@ res -- A required instance of the Resources class having special
            ],'f')
   nmix  = len(mixrat)           # mixing ratios
 
+#
+#  The points of the curved lines only depend on the values above, so
+#  they are computed once (see _skewt_bkg_lines) and kept.
+#
+  lines = _skewt_bkg_lines(mixrat,theta,lendth,rendth,pseudo)
+
 #
 #  Declare local stuff: arrays/variables for storing x,y positions
 #  during iterations to draw curved line, etc.
@@ -6043,10 +8087,25 @@ res -- A required instance of the Resources class having special
     xyOpts.tmYRValues   = pnice
     xyOpts.tmYRLabels   = znice
 
+#
+#  If asked to, reuse the background already made on this workstation
+#  with the same resources: just draw its lines and labels again.
+#
+  cache_key = None
+  if (localOpts.sktCacheBackground):
+    cache_key = (wks, tuple(sorted([(key,repr(numpy.asarray(value).tolist())) \
+                                    for key,value in OptsAtts.items()])))
+    if (cache_key in _skewt_bkg_cache):
+      xyplot,ops = _skewt_bkg_cache[cache_key]
+      for func,args in ops:
+        func(wks,xyplot,*args)
+      return xyplot
+
 #
 #  Draw outline and the x and y axes.
 #
   xyplot = xy (wks,xc,yc,xyOpts)
+  ops    = []
 
 #
 #  right *label* MUST be added AFTER xy created.
@@ -6058,7 +8117,7 @@ res -- A required instance of the Resources class having special
     txOpts.txFontHeightF     = xyOpts.tmYLLabelFontHeightF
     xlab                     = _skewtx (53., _skewty(1013.))
     ylab                     = _skewty (350.)
-    text (wks,xyplot,zLabel,xlab,ylab,txOpts)
+    _skewt_draw(ops, text, wks, xyplot, zLabel,xlab,ylab,txOpts)
     del txOpts
 
   if (localOpts.sktDrawColAreaFill):
@@ -6124,7 +8183,7 @@ res -- A required instance of the Resources class having special
                      [                                            \
                        15.3523 , 20.7523 , 27.0974, 27.0974, 25.6525  \
                      ],'f')
-      polygon(wks, xyplot, sx[0:nx+1], sy[0:nx+1], gsOpts)
+      _skewt_draw(ops, polygon, wks, xyplot, sx[0:nx+1], sy[0:nx+1], gsOpts)
 #
 #  Upper left triangle.
 #
@@ -6137,7 +8196,7 @@ res -- A required instance of the Resources class having special
                  [                        \
                    -14.04, -18.955, -18.955 \
                  ],'f')
-    polygon(wks, xyplot, sx[0:3], sy[0:3], gsOpts)
+    _skewt_draw(ops, polygon, wks, xyplot, sx[0:3], sy[0:3], gsOpts)
 #
 #  Lower right triangle.
 #
@@ -6150,7 +8209,7 @@ res -- A required instance of the Resources class having special
                  [                        \
                    xmax, xmax, 26.1523    \
                  ],'f')
-    polygon(wks, xyplot, sx[0:3],sy[0:3],gsOpts)
+    _skewt_draw(ops, polygon, wks, xyplot, sx[0:3],sy[0:3],gsOpts)
     del gsOpts
 
 #
@@ -6177,12 +8236,12 @@ res -- A required instance of the Resources class having special
       yy[0] = _skewty(lendt[i])
       xx[0] = _skewtx( temp[i], yy[0])
       #gsOpts.gsLineLabelString  = int(temp[i])
-      polyline(wks, xyplot, xx, yy, gsOpts)
+      _skewt_draw(ops, polyline, wks, xyplot, xx, yy, gsOpts)
 
       xlab  = xx[1] + 0.625
       ylab  = yy[1] + 0.55
       label = int(temp[i])
-      text(wks, xyplot, str(label), xlab, ylab, txOpts)
+      _skewt_draw(ops, text, wks, xyplot, str(label), xlab, ylab, txOpts)
     del gsOpts
     del txOpts
 
@@ -6203,7 +8262,7 @@ res -- A required instance of the Resources class having special
         ypl   = _skewty(pres[i])
         yy[0] = ypl
         yy[1] = ypl
-        polyline(wks, xyplot, xx, yy, gsOpts)
+        _skewt_draw(ops, polyline, wks, xyplot, xx, yy, gsOpts)
       del gsOpts
 
 #
@@ -6228,25 +8287,14 @@ res -- A required instance of the Resources class having special
     txOpts.txFontColor       = colGreen
     txOpts.txFontHeightF     = 0.0100
 
-    yy[1] = _skewty( 400.)    # y at top [right end of slanted line]
-    yy[0] = _skewty(1000.)    # y at bottom of line [was 1050.]
-
     for i in range(0,nmix):
-      if (mixrat[i] == 20.):
-        yy[1] = _skewty(440.)
-        tmix  = _dtmrskewt(mixrat[i],440.)
-      else:
-        yy[1] = _skewty(400.)
-        tmix  = _dtmrskewt(mixrat[i],400.)
-      xx[1] = _skewtx(tmix,yy[1])
-      tmix  = _dtmrskewt(mixrat[i],1000.)   # was 1050
-      xx[0] = _skewtx(tmix,yy[0])
-      polyline (wks,xyplot,xx,yy,gsOpts)   # dashed green
+      xx[0],xx[1],yy[0],yy[1] = lines["mixrat"][i]
+      _skewt_draw(ops, polyline, wks, xyplot, xx,yy,gsOpts)   # dashed green
 
       xlab  = xx[0]-0.25
       ylab  = yy[0]-0.45
       label = int(mixrat[i])
-      text(wks, xyplot, str(label), xlab, ylab, txOpts)
+      _skewt_draw(ops, text, wks, xyplot, str(label), xlab, ylab, txOpts)
     del gsOpts
     del txOpts
 
@@ -6266,30 +8314,14 @@ res -- A required instance of the Resources class having special
     txOpts.txFontHeightF     = 0.01
     txOpts.txFontThicknessF  = 1.0
 
-    pinc = 10.
     for i in range(0,ntheta):
-      p = lendth[i]-pinc
-      for j in range(0,len(sy)):
-        p = p+pinc
-        if (p > rendth[i]):
-          sy[j] = _skewty(rendth[i])
-          t     = _dtdaskewt(theta[i],p)   # get temp on dry adiabat at p
-          sx[j] = _skewtx(t,sy[j])
-          break
-        sy[j] = _skewty(p)
-        t     = _dtdaskewt(theta[i],p)
-        sx[j] = _skewtx(t,sy[j])
-      #polyline (wks,xyplot,sx[:j-1],sy[:j-1],gsOpts)     # whole line  
-
+      sxi,syi,xlab,ylab = lines["dry"][i]
       if (theta[i] < 170.):
-        polyline (wks,xyplot,sx[1:j],sy[1:j],gsOpts)  # label room  
-        ylab  = _skewty(lendth[i]+5.)
-        t     = _dtdaskewt(theta[i],lendth[i]+5.)
-        xlab  = _skewtx(t,ylab)
+        _skewt_draw(ops, polyline, wks, xyplot, sxi[1:],syi[1:],gsOpts)  # label room  
         label = int(theta[i])
-        text(wks,xyplot,str(label),xlab,ylab,txOpts)
+        _skewt_draw(ops, text, wks, xyplot, str(label),xlab,ylab,txOpts)
       else:                                            # no label
-        polyline (wks,xyplot,sx[:j],sy[:j],gsOpts)     # whole line
+        _skewt_draw(ops, polyline, wks, xyplot, sxi,syi,gsOpts)     # whole line
     del gsOpts
     del txOpts
 
@@ -6309,25 +8341,12 @@ res -- A required instance of the Resources class having special
     txOpts.txFontHeightF     = 0.0125
     txOpts.txFontThicknessF  = 1.0
 
-    pinc = 10.
-
     for i in range(0,npseudo):
-      p = 1060.
-      for j in range (0, len (sy)):
-        p = p - pinc
-        if (p < 230.):     # was "250"
-          break
-        sy[j] = _skewty(p)
-        t     = _dsatlftskewt(pseudo[i],p)    # temp on moist adiabat at p.
-        sx[j] = _skewtx(t,sy[j])
-
-      polyline (wks, xyplot, sx[:j-1], sy[:j-1], gsOpts)
+      sxi,syi,xlab,ylab = lines["moist"][i]
+      _skewt_draw(ops, polyline, wks, xyplot, sxi, syi, gsOpts)
 
-      ylab  = _skewty(p + 0.5*pinc)
-      t     = _dsatlftskewt(pseudo[i], p + 0.75*pinc)
-      xlab  = _skewtx(t,ylab)
       label = int(pseudo[i])     # 9 Feb 99 fix
-      text(wks, xyplot, str(label), xlab, ylab, txOpts)
+      _skewt_draw(ops, text, wks, xyplot, str(label), xlab, ylab, txOpts)
 
     del gsOpts
     del txOpts
@@ -6342,7 +8361,7 @@ res -- A required instance of the Resources class having special
          sy[i] = _skewty(psa[i])
          sx[i] = _skewtx(tsa[i], sy[i])
 
-      polyline (wks, xyplot, sx[0:nlvl], sy[0:nlvl], gsOpts)
+      _skewt_draw(ops, polyline, wks, xyplot, sx[0:nlvl], sy[0:nlvl], gsOpts)
       del gsOpts
 
 #
@@ -6364,8 +8383,8 @@ res -- A required instance of the Resources class having special
         sy[0:npres] = _skewty(presWind).astype(numpy.Float0)
       except:
         sy[0:npres] = _skewty(presWind).astype(numpy.float)
-      polyline   (wks, xyplot, sx[0:npres], sy[0:npres], gsOpts)
-      polymarker (wks, xyplot, sx[1:npres], sy[1:npres], gsOpts)
+      _skewt_draw(ops, polyline, wks, xyplot, sx[0:npres], sy[0:npres], gsOpts)
+      _skewt_draw(ops, polymarker, wks, xyplot, sx[1:npres], sy[1:npres], gsOpts)
                                      # zwind => Pibal reports
       zftWind = numpy.array(                                      \
                               [0.,  1.,  2.,  3.,  4.,  5.,  6.,  \
@@ -6385,9 +8404,11 @@ res -- A required instance of the Resources class having special
       gsOpts.gsMarkerIndex      = 16     # "circle_filled" -> Pibal
       gsOpts.gsMarkerSizeF      = 0.0035 # 0.007 is default
       gsOpts.gsMarkerThicknessF = 0.5    # 1.0 is default
-      polymarker (wks, xyplot, sx[0:nzkmW], sy[0:nzkmW], gsOpts)
+      _skewt_draw(ops, polymarker, wks, xyplot, sx[0:nzkmW], sy[0:nzkmW], gsOpts)
       del gsOpts
 
+  if (cache_key is not None):
+    _skewt_bkg_cache[cache_key] = (xyplot,ops)
   return xyplot
 
 ################################################################
@@ -6846,6 +8867,56 @@ dataOpts -- An optional instance of the Resources class having
 
 ################################################################
 
+def sphere_surface(rlat,rlon,f=None):
+  """
+Triangulates randomly spaced points on the sphere once, so that any
+number of fields at those points can be interpolated to any number
+of output points or grids without doing that again. Returns a
+SphereSurface object.
+
+surf = Ngl.sphere_surface(rlat, rlon, f=None)
+surf.set_values(f)
+fo   = surf.grid(plat, plon)
+fo   = surf.points(plat, plon)
+
+rlat, rlon -- One-dimensional arrays with the latitudes and
+              longitudes, in degrees, of the input points.
+
+f -- An optional array of values at the input points (see
+     set_values). The last dimension is len(rlat); any leading
+     dimensions are separate fields, all done at once.
+
+set_values gives the surface new values and estimates the gradients
+at the points; grid and points evaluate it on a latitude/longitude
+grid or at arbitrary points. Output points are done in parallel if
+PyNGL was built with OpenMP.
+
+This is a different interpolant from cssgrid, not a faster way of
+getting cssgrid's results. The surface is a C1 interpolant of the
+kind Renka describes, on the Delaunay triangulation of the points
+(from c_csstri), with no tension. Each gradient at the points is a
+local least squares fit to the point's nearest neighbors, which can
+be set up once for all fields; cssgrid fits the gradients globally,
+for each field separately, with its tension settings. For smooth
+fields on well spread points the two are both close to the field,
+but with few or unevenly spaced points they can differ noticeably.
+Outside the triangulation (when the points don't cover the sphere)
+the surface is extrapolated linearly.
+  """
+  rlat2 = numpy.ravel(numpy.asarray(rlat,dtype=numpy.float64))
+  rlon2 = numpy.ravel(numpy.asarray(rlon,dtype=numpy.float64))
+  if (len(rlat2) != len(rlon2)):
+    print("sphere_surface: rlat and rlon must be the same length")
+    return None
+
+  ier,surf = css_fit_p(len(rlat2),rlat2,rlon2)
+  if (ier != 0):
+    print("sphere_surface: c_csstri returned error %d" % (ier))
+    return None
+  return SphereSurface(surf,len(rlat2),f)
+
+################################################################
+
 def streamline(wks,uarray,varray,rlistc=None):
   """
 Creates and draws streamlines, and returns a PlotId of the plot created.
@@ -6874,12 +8945,13 @@ res -- An optional instance of the Resources class having PyNGL
   rlist1 = {}
   rlist2 = {}
   rlist3 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
       rlist1[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist2[key] = rlist[key]
 
@@ -6891,6 +8963,7 @@ res -- An optional instance of the Resources class having PyNGL
 #
       if(key[0:2] == "vp" or key[0:2] == "tm" or key[0:6] == "pmTick"):
         rlist3[key] = rlist[key]
+  _set_spc_res_list(spc_res)
     
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -6942,6 +9015,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist1 = {}
   rlist2 = {}
   rlist3 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
@@ -6951,9 +9025,10 @@ res -- An optional instance of the Resources class having PyNGL
           (key[0:2] == "ti") ):
       rlist3[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist2[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -7020,6 +9095,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist2 = {}
   rlist3 = {}
   rlist4 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
@@ -7027,7 +9103,7 @@ res -- An optional instance of the Resources class having PyNGL
     elif(key[0:2] == "sf"):
       rlist2[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist3[key] = rlist[key]
 #
@@ -7038,6 +9114,7 @@ res -- An optional instance of the Resources class having PyNGL
 #
       if(key[0:2] == "vp" or key[0:2] == "tm" or key[0:6] == "pmTick"):
         rlist4[key] = rlist[key]
+  _set_spc_res_list(spc_res)
     
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -7099,6 +9176,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist2 = {}
   rlist3 = {}
   rlist4 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
@@ -7110,9 +9188,10 @@ res -- An optional instance of the Resources class having PyNGL
           (key[0:2] == "ti") ):
       rlist4[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist3[key] = rlist[key]
+  _set_spc_res_list(spc_res)
     
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -7631,12 +9710,14 @@ res -- An optional variable containing a list of TextItem resources,
   _set_spc_defaults(0)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
   itxt = text_wrap(wks,_pobj2lst(plot),text,x,y,"double","double",rlist1,pvoid())
   del rlist
   del rlist1
@@ -7664,12 +9745,14 @@ res -- An (optional) instance of the Resources class having TextItem
   _set_spc_defaults(0)
   rlist = _crt_dict(rlistc)
   rlist1 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist1[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
   itxt = text_ndc_wrap(wks,text,x,y,"double","double",rlist1,pvoid())
   del rlist
@@ -7678,6 +9761,180 @@ res -- An (optional) instance of the Resources class having TextItem
 
 ################################################################
 
+def _update_spc_defaults():
+#
+#  The plot being updated was already sized when it was created,
+#  so by default don't maximize it again; just draw and advance
+#  the frame.
+#
+  _set_spc_defaults(1)
+  set_nglRes_i(0, 0)        # nglMaximize
+
+def update_contour_data(wks,plot,array,rlistc=None,keep_levels=True):
+  """
+Replaces the data of an existing contour plot and redraws it. This is
+much faster than calling Ngl.contour or Ngl.contour_map again when
+only the data changes, as in an animation loop, because the plot, its
+map, and any annotations are reused.
+
+Ngl.update_contour_data(wks, plot, data, res=None, keep_levels=True)
+
+wks -- The identifier returned from calling Ngl.open_wks
+
+plot -- The PlotId returned from Ngl.contour, Ngl.contour_map, or any
+        other function that creates a contour plot.
+
+data -- The new data. It must have the same shape as the data the
+        plot was created with. Masked arrays allowed.
+
+res -- An optional instance of the Resources class having PyNGL
+       resources as attributes. "sf" resources are applied to the
+       scalar field, "ngl" resources are applied as usual, and all
+       others are applied to the contour plot. nglMaximize defaults
+       to False here.
+
+keep_levels -- If True (the default), the contour levels currently in
+               use are kept, rather than being recomputed from the
+               new data.
+  """
+  if (len(array.shape) != 1 and len(array.shape) != 2):
+    print("update_contour_data - array must be 1D or 2D")
+    return None
+
+# Get NumPy array from masked array, if necessary.
+  arr2,fill_value = _get_arr_and_fv(array)
+
+  _update_spc_defaults()
+  rlist = _crt_dict(rlistc)
+
+  rlist1 = {}
+  rlist2 = {}
+  spc_res = {}
+  for key in list(rlist.keys()):
+    rlist[key] = _convert_from_ma(rlist[key])
+    if (key[0:2] == "sf"):
+      rlist1[key] = rlist[key]
+    elif(key[0:3] == "ngl"):
+      spc_res[key[3:]] = rlist[key]
+    else:
+      rlist2[key] = rlist[key]
+  _set_spc_res_list(spc_res)
+
+# Set missing value resource, if necessary
+  _set_msg_val_res(rlist1,fill_value,"scalar")
+
+  if (len(arr2.shape) == 2):
+    update_scalar_field_wrap(wks,_pobj2lst(plot),arr2,"double", \
+                             arr2.shape[0],arr2.shape[1],int(keep_levels), \
+                             rlist1,rlist2,pvoid())
+  else:
+    update_scalar_field_wrap(wks,_pobj2lst(plot),arr2,"double", \
+                             arr2.shape[0],-1,int(keep_levels), \
+                             rlist1,rlist2,pvoid())
+
+  del rlist
+  del rlist1
+  del rlist2
+  return None
+
+################################################################
+
+def _update_vector_data(wks,plot,uarray,varray,rlistc,keep_levels,name):
+  if len(uarray.shape) != 2 or len(varray.shape) != 2:
+    print(name + " - arrays must be 2D")
+    return None
+
+# Get NumPy array from masked arrays, if necessary.
+  uar2,uar_fill_value = _get_arr_and_fv(uarray)
+  var2,var_fill_value = _get_arr_and_fv(varray)
+
+  _update_spc_defaults()
+  rlist = _crt_dict(rlistc)
+
+  rlist1 = {}
+  rlist2 = {}
+  spc_res = {}
+  for key in list(rlist.keys()):
+    rlist[key] = _convert_from_ma(rlist[key])
+    if (key[0:2] == "vf"):
+      rlist1[key] = rlist[key]
+    elif(key[0:3] == "ngl"):
+      spc_res[key[3:]] = rlist[key]
+    else:
+      rlist2[key] = rlist[key]
+  _set_spc_res_list(spc_res)
+
+# Set missing value resources, if necessary
+  _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
+  _set_msg_val_res(rlist1,var_fill_value,"vector_v")
+
+  update_vector_field_wrap(wks,_pobj2lst(plot),uar2,var2,"double","double", \
+                           uar2.shape[0],uar2.shape[1],int(keep_levels), \
+                           rlist1,rlist2,pvoid())
+  del rlist
+  del rlist1
+  del rlist2
+  return None
+
+def update_streamline_data(wks,plot,uarray,varray,rlistc=None,
+                           keep_levels=True):
+  """
+Replaces the data of an existing streamline plot and redraws it,
+reusing the plot, its map, and any annotations.
+
+Ngl.update_streamline_data(wks, plot, u, v, res=None, keep_levels=True)
+
+wks -- The identifier returned from calling Ngl.open_wks
+
+plot -- The PlotId returned from Ngl.streamline, Ngl.streamline_map,
+        or any other function that creates a streamline plot.
+
+u,v -- The new vector data. They must have the same shape as the data
+       the plot was created with. Masked arrays allowed.
+
+res -- An optional instance of the Resources class having PyNGL
+       resources as attributes. "vf" resources are applied to the
+       vector field, "ngl" resources are applied as usual, and all
+       others are applied to the streamline plot. nglMaximize
+       defaults to False here.
+
+keep_levels -- If True (the default), the streamline color levels
+               currently in use are kept.
+  """
+  return _update_vector_data(wks,plot,uarray,varray,rlistc,keep_levels, \
+                             "update_streamline_data")
+
+################################################################
+
+def update_vector_data(wks,plot,uarray,varray,rlistc=None,keep_levels=True):
+  """
+Replaces the data of an existing vector plot and redraws it, reusing
+the plot, its map, and any annotations.
+
+Ngl.update_vector_data(wks, plot, u, v, res=None, keep_levels=True)
+
+wks -- The identifier returned from calling Ngl.open_wks
+
+plot -- The PlotId returned from Ngl.vector, Ngl.vector_map, or any
+        other function that creates a vector plot.
+
+u,v -- The new vector data. They must have the same shape as the data
+       the plot was created with. Masked arrays allowed.
+
+res -- An optional instance of the Resources class having PyNGL
+       resources as attributes. "vf" resources are applied to the
+       vector field, "ngl" resources are applied as usual, and all
+       others are applied to the vector plot. nglMaximize defaults
+       to False here.
+
+keep_levels -- If True (the default), the vector color levels
+               currently in use are kept.
+  """
+  return _update_vector_data(wks,plot,uarray,varray,rlistc,keep_levels, \
+                             "update_vector_data")
+
+################################################################
+
 def update_workstation(obj):
   """
 Flushes all output to a specified workstation.
@@ -7724,12 +9981,13 @@ res -- An optional instance of the Resources class having PyNGL
   rlist1 = {}
   rlist2 = {}
   rlist3 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
       rlist1[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist2[key] = rlist[key]
 #
@@ -7740,6 +9998,7 @@ res -- An optional instance of the Resources class having PyNGL
 #
       if(key[0:2] == "vp" or key[0:2] == "tm" or key[0:6] == "pmTick"):
         rlist3[key] = rlist[key]
+  _set_spc_res_list(spc_res)
     
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -7798,6 +10057,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist1 = {}
   rlist2 = {}
   rlist3 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
@@ -7807,9 +10067,10 @@ res -- An optional instance of the Resources class having PyNGL
           (key[0:2] == "ti") ):
       rlist3[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist2[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -7884,6 +10145,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist2 = {}
   rlist3 = {}
   rlist4 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
@@ -7891,7 +10153,7 @@ res -- An optional instance of the Resources class having PyNGL
     elif(key[0:2] == "sf"):
       rlist2[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist3[key] = rlist[key]
 #
@@ -7902,6 +10164,7 @@ res -- An optional instance of the Resources class having PyNGL
 #
       if(key[0:2] == "vp" or key[0:2] == "tm" or key[0:6] == "pmTick"):
         rlist4[key] = rlist[key]
+  _set_spc_res_list(spc_res)
     
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -7971,6 +10234,7 @@ res -- An optional instance of the Resources class having PyNGL
   rlist2 = {}
   rlist3 = {}
   rlist4 = {}
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
     if (key[0:2] == "vf"):
@@ -7982,9 +10246,10 @@ res -- An optional instance of the Resources class having PyNGL
           (key[0:2] == "ti") ):
       rlist4[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       rlist3[key] = rlist[key]
+  _set_spc_res_list(spc_res)
     
 # Set missing value resources, if necessary
   _set_msg_val_res(rlist1,uar_fill_value,"vector_u")
@@ -8101,29 +10366,36 @@ dx, dy -- Scalars, one-dimensional NumPy arrays or Python lists
     if ( (type(y) != t) or (type(u) != t) or (type(v) != t)):
       print("wmbarb: If any argument is a NumPy array, they must all be.")
       return 1
-    rx = numpy.ravel(x)
-    ry = numpy.ravel(y)
-    ru = numpy.ravel(u)
-    rv = numpy.ravel(v)
-    for i in range(len(rx)):
-      c_wmbarbp(gksid,rx[i],ry[i],ru[i],rv[i])
   elif(type(x) == list):
     l = list
     if ( (type(y) != l) or (type(u) != l) or (type(v) != l)):
       print("wmbarb: If any argument is a Python list, they must all be.")
       return 1
-    for i in range(len(x)):
-      c_wmbarbp(gksid,x[i],y[i],u[i],v[i])
   elif(type(x) == tuple):
     l = tuple
     if ( (type(y) != l) or (type(u) != l) or (type(v) != l)):
       print("wmbarb: If any argument is a Python tuple, they must all be.")
       return 1
-    for i in range(len(x)):
-      c_wmbarbp(gksid,x[i],y[i],u[i],v[i])
   elif (isinstance(x, integer_types) or \
         type(x)==float):
     c_wmbarbp(gksid,x,y,u,v)
+    return 0
+  else:
+    return 0
+
+#
+#  Draw all of the barbs in one call.
+#
+  rx = numpy.ravel(numpy.asarray(x,dtype=numpy.float64))
+  ry = numpy.ravel(numpy.asarray(y,dtype=numpy.float64))
+  ru = numpy.ravel(numpy.asarray(u,dtype=numpy.float64))
+  rv = numpy.ravel(numpy.asarray(v,dtype=numpy.float64))
+  n  = len(rx)
+  if (len(ry) != n or len(ru) != n or len(rv) != n):
+    print("wmbarb: x, y, u, and v must all have the same number of values.")
+    return 1
+  if (n > 0):
+    c_wmbarbs(gksid,rx,ry,ru,rv,n)
   return 0
 
 ################################################################
@@ -8233,11 +10505,11 @@ pvalue -- Value of the parameter you want to set.
 
 ################################################################
 
-def wmstnm(wks,x,y,imdat):
+def wmstnm(wks,x,y,imdat,thin=0.):
   """
 Draws station model data at specified locations.
 
-Ngl.wmstnm(wks, x, y, imdat)
+Ngl.wmstnm(wks, x, y, imdat, thin=0.)
 
 wks -- The identifier returned from calling Ngl.open_wks.
 
@@ -8245,7 +10517,13 @@ x, y -- Scalars, one-dimensional NumPy arrays or Python lists
         specifying X and Y coordinate values.
 
 imdat -- A string of 50 characters encoded as per the WMO/NOAA guidelines. 
-         See the online documentation for details.
+         See the online documentation for details. For several
+         stations, a list of such strings, or the NumPy array
+         returned by Ngl.wmstnm_encode.
+
+thin -- If positive, a station is not drawn if it would be closer
+        than thin (in NDC) to a station that comes before it and is
+        drawn, so the stations should be given in order of priority.
   """
 #
 #  Get the GKS workstaton ID.
@@ -8253,23 +10531,236 @@ imdat -- A string of 50 characters encoded as per the WMO/NOAA guidelines.
   gksid = get_integer(wks,"wkGksWorkId")
 
 #
-#  Process depending on whether we have scalar coordinates,
-#  NumPy arrays, or Python lists or tuples.
+#  All of the stations are drawn in one call, from the 50-character
+#  station strings packed one after another.
 # 
-  xa = _arg_with_scalar(numpy.array(x))
-  ya = _arg_with_scalar(numpy.array(y))
-  if (type(imdat) == type('a')):
-    imdata = numpy.array([imdat])
-  else:
-    imdata = numpy.array(imdat)
-  for i in range(len(xa)):
-    c_wmstnmp(gksid,xa[i],ya[i],imdata[i])
+  xa = numpy.ravel(numpy.asarray(x,dtype=numpy.float64))
+  ya = numpy.ravel(numpy.asarray(y,dtype=numpy.float64))
+  if (isinstance(imdat,str) or isinstance(imdat,bytes)):
+    imdat = [imdat]
+  imdata = numpy.ravel(numpy.asarray(imdat))
+  if (imdata.dtype.kind == "U"):
+    imdata = numpy.char.encode(imdata,"ascii")
+  if (imdata.dtype.kind != "S" or \
+      numpy.any(numpy.char.str_len(imdata) != 50)):
+    print("wmstnm: imdat must be 50-character strings.")
+    return None
+  n = len(imdata)
+  if (len(xa) != n or len(ya) != n):
+    print("wmstnm: x, y, and imdat must all have the same number of values.")
+    return None
+  if (n > 0):
+    wmstnms_p(gksid,xa,ya,n,imdata.astype("S50").tobytes(),float(thin))
 
   del xa,ya,imdata
   return None
 
 ################################################################
 
+def wmstnm_encode(cover=0,wdir=0.,wspd=0.,temp=0.,dewpt=0.,pres=0.,slp=0., \
+                  ptend=0,pchange=0.,weather=0,vis=0,cloud_height=0):
+  """
+Encodes arrays of station observations as the 50-character station
+model strings that Ngl.wmstnm draws.
+
+imdat = Ngl.wmstnm_encode(cover=0, wdir=0., wspd=0., temp=0., dewpt=0.,
+                          pres=0., slp=0., ptend=0, pchange=0.,
+                          weather=0, vis=0, cloud_height=0)
+
+cover -- The total cloud cover, in oktas (0-8, or 9 if the sky is
+         obscured).
+
+wdir, wspd -- The wind direction, in degrees (the direction the wind
+              is coming from), and speed, in knots. A direction of 0
+              or 360 is coded as north (36); the direction of a calm
+              wind (a speed that rounds to 0) is coded as 00.
+
+temp, dewpt -- The temperature and dew point, in degrees C.
+
+pres, slp -- The station and sea level pressures, in mb.
+
+ptend, pchange -- The pressure tendency code (0-8), and the amount
+                  of the change over the last three hours, in mb.
+
+weather -- The present weather code (0-99).
+
+vis -- The visibility code (0-99).
+
+cloud_height -- The height of the lowest cloud code (0-9).
+
+Each of the arguments can be a scalar or a NumPy array or list; they
+are broadcast against each other. The returned value is a NumPy array
+of 50-character byte strings, one per station, that can be passed to
+Ngl.wmstnm. The groups not covered by the arguments (precipitation,
+past weather and cloud types) are encoded as zeros.
+  """
+  def ints(val):
+    return numpy.rint(numpy.asarray(val,dtype=numpy.float64)).astype(int)
+
+  def digits(val,ndigits):
+#
+#  The last ndigits decimal digits of the integers in val.
+#
+    val = numpy.abs(val)
+    return [(val // 10**(ndigits-k-1)) % 10 for k in range(ndigits)]
+
+  def signed(val):
+#
+#  The sign digit (0 or 1) and three digits of tenths.
+#
+    val = numpy.asarray(val,dtype=numpy.float64)
+    return [(val < 0).astype(int)] + \
+           digits(numpy.minimum(ints(10.*numpy.abs(val)),999),3)
+
+  args = numpy.broadcast_arrays(*[numpy.atleast_1d(numpy.asarray(arg)) \
+           for arg in [cover,wdir,wspd,temp,dewpt,pres,slp,ptend, \
+                       pchange,weather,vis,cloud_height]])
+  cover,wdir,wspd,temp,dewpt,pres,slp,ptend,pchange,weather,vis, \
+     cloud_height = [numpy.ravel(arg) for arg in args]
+  n = len(cover)
+#
+#  Directions are coded in tens of degrees, with north as 36; 00 is
+#  reserved for calm winds.
+#
+  wdir = ints(wdir/10.) % 36
+  wdir = numpy.where(wdir == 0,36,wdir)
+  wdir = numpy.where(numpy.clip(ints(wspd),0,99) == 0,0,wdir)
+  one  = numpy.ones(n,dtype=int)
+  zero = numpy.zeros(n,dtype=int)
+
+  cols = [one, one] + digits(ints(cloud_height),1) + digits(ints(vis),2) + \
+    digits(ints(cover),1) + digits(wdir,2) + \
+    digits(numpy.clip(ints(wspd),0,99),2) + \
+    [1*one] + signed(temp) + [2*one] + signed(dewpt) + \
+    [3*one] + digits(ints(10.*pres) % 10000,4) + \
+    [4*one] + digits(ints(10.*slp) % 10000,4) + \
+    [5*one] + digits(ints(ptend),1) + \
+    digits(numpy.minimum(ints(10.*numpy.abs(pchange)),999),3) + \
+    [6*one, zero, zero, zero, zero] + \
+    [7*one] + digits(ints(weather),2) + [zero, zero] + \
+    [8*one, zero, zero, zero, zero]
+  chars = (numpy.column_stack(cols) + ord("0")).astype(numpy.uint8)
+  return numpy.ascontiguousarray(chars).view("S50").ravel()
+
+################################################################
+
+class WorkstationPool:
+  """
+Keeps opened image workstations so they can be reused, one product at
+a time, instead of opening and deleting a workstation for each one.
+
+pool = Ngl.WorkstationPool(wk_type="png", wk_rlist=None, size=4)
+
+wk_type -- The type of workstation. Only "png" is supported, since
+           the output of each product must be complete when it is
+           released.
+
+wk_rlist -- An optional instance of the Resources class having
+            Workstation resources as attributes, used for every
+            workstation. If wk_rlist.nglImageInMemory is True, the
+            frames are kept for Ngl.get_images (see Ngl.open_wks).
+
+size -- The largest number of idle workstations kept open.
+
+Call wks = pool.acquire(wk_name) to get a workstation for a product,
+then draw and advance the frames as usual. pool.release(wks, objects)
+destroys the given plot objects, restores the workstation's original
+colormap, and returns the product's output. That output is either the
+list of files written (renamed to "wk_name.png", or to
+"wk_name.%06d.png" for each frame if there are several) or, for
+in-memory workstations, the list returned by Ngl.get_images. Call
+pool.close() when done, or use the pool in a "with" statement.
+
+pool.close() raises a RuntimeError if any workstation is still
+acquired and has not been released, and leaves the pool as it was.
+Use pool.close(force=True) to delete those workstations as well. A
+"with" statement that ends with an exception closes the pool with
+force=True.
+  """
+  def __init__(self,wk_type="png",wk_rlist=None,size=4):
+    if wk_type not in ["png","newpng"]:
+      raise ValueError("WorkstationPool: wk_type must be 'png'")
+    self.wk_type  = wk_type
+    self.wk_rlist = wk_rlist
+    self.size     = max(0,int(size))
+    self._cmap    = getattr(wk_rlist,"wkColorMap","default")
+    self._idle    = []          # (wks, output directory)
+    self._busy    = {}          # wks -> (wk_name, output directory)
+
+  def acquire(self,wk_name=None):
+    if self._idle:
+      wks,out_dir = self._idle.pop()
+    else:
+      import tempfile
+      out_dir = tempfile.mkdtemp(prefix="pyngl_pool")
+      wks = open_wks(self.wk_type,os.path.join(out_dir,"frame"), \
+                     self.wk_rlist)
+      if wks is None:
+        os.rmdir(out_dir)
+        raise RuntimeError("WorkstationPool: could not open workstation")
+    self._busy[wks] = (wk_name,out_dir)
+    return wks
+
+  def release(self,wks,objects=None):
+    import shutil
+    wk_name,out_dir = self._busy.pop(wks)
+    for obj in (objects or []):
+      destroy(obj)
+    cres = Resources()
+    cres.wkColorMap = self._cmap
+    set_values(wks,cres)
+
+    if wks in _image_wks_dirs:
+      output = get_images(wks)
+    else:
+      files = []
+      for name in os.listdir(out_dir):
+        m = re.match(r"frame(\.(\d+))?\.png$",name)
+        if (m):
+          files.append((int(m.group(2) or 1),name))
+      files.sort()
+      output = []
+      for i in range(len(files)):
+        if wk_name is None:
+          os.remove(os.path.join(out_dir,files[i][1]))
+          continue
+        if len(files) == 1:
+          target = wk_name + ".png"
+        else:
+          target = "%s.%06d.png" % (wk_name,i+1)
+        shutil.move(os.path.join(out_dir,files[i][1]),target)
+        output.append(target)
+
+    if len(self._idle) < self.size:
+      self._idle.append((wks,out_dir))
+    else:
+      self._delete(wks,out_dir)
+    return output
+
+  def _delete(self,wks,out_dir):
+    import shutil
+    delete_wks(wks)
+    shutil.rmtree(out_dir,ignore_errors=True)
+
+  def close(self,force=False):
+    if self._busy and not force:
+      raise RuntimeError("WorkstationPool: %d workstation(s) still acquired; release them first" % len(self._busy))
+    for wks,out_dir in self._idle:
+      self._delete(wks,out_dir)
+    for wks,(wk_name,out_dir) in list(self._busy.items()):
+      self._delete(wks,out_dir)
+    self._idle = []
+    self._busy = {}
+
+  def __enter__(self):
+    return self
+
+  def __exit__(self,exc_type,exc_value,tb):
+    self.close(force=exc_type is not None)
+    return False
+
+################################################################
+
 def wrf_avo(u, v, msfu, msfv, msfm, cor, dx, dy, opt=0):
   """
 Calculates absolute vorticity from WRF model output.
@@ -8849,6 +11340,12 @@ x, y -- The X and Y coordinates of the curve(s). These values can be
 
 res -- An (optional) instance of the Resources class having PyNGL
        resources as attributes.
+
+For very long curves, set res.nglXYDecimate = True to keep only the
+first, lowest, highest, and last point of each curve in every column
+of pixels, which draws the same picture from far fewer points. The
+number of columns is taken from the viewport and workstation widths,
+unless res.nglXYDecimateColumns is set.
   """
   _set_spc_defaults(1)
 
@@ -8856,6 +11353,12 @@ res -- An (optional) instance of the Resources class having PyNGL
   xar2,xar_fill_value = _get_arr_and_fv(xar)
   yar2,yar_fill_value = _get_arr_and_fv(yar)
 
+  rlist = _crt_dict(rlistc)
+
+# Reduce the number of points to draw, if requested.
+  xar2,yar2,xar_fill_value,yar_fill_value = \
+     _decimate_xy(wks,xar2,yar2,xar_fill_value,yar_fill_value,rlist)
+
 #
 #  Get input array dimension information.
 #
@@ -8878,8 +11381,6 @@ res -- An (optional) instance of the Resources class having PyNGL
   else:
     print("xy: type of argument 3 must be one of: list, tuple, or NumPy array")
     return None
-
-  rlist = _crt_dict(rlistc)
  
 #
 #  Separate the resource dictionary into those resources
@@ -8899,6 +11400,7 @@ res -- An (optional) instance of the Resources class having PyNGL
                 'nglXYRightFillColors','nglXYLeftFillColors',  \
                 'nglXYFillColors']
   fill_xy = False
+  spc_res = {}
   for key in list(rlist.keys()):
     rlist[key] = _convert_from_ma(rlist[key])
 #---Test for special fill attributes
@@ -8908,8 +11410,8 @@ res -- An (optional) instance of the Resources class having PyNGL
         fill_rlist[key] = [rlist[key]]    # Make sure it's a list.
       else:
         fill_rlist[key] = rlist[key]
-      _set_spc_res('Frame',False)
-      _set_spc_res('Draw',False)
+      spc_res['Frame'] = False
+      spc_res['Draw'] = False
       
     elif (key[0:2] == "ca"):
       ca_rlist[key] = rlist[key]
@@ -8925,9 +11427,10 @@ res -- An (optional) instance of the Resources class having PyNGL
       else:
         xyd_rlist[key] = rlist[key]
     elif(key[0:3] == "ngl"):
-      _set_spc_res(key[3:],rlist[key])
+      spc_res[key[3:]] = rlist[key]
     else:
       xy_rlist[key] = rlist[key]
+  _set_spc_res_list(spc_res)
 
 #
 # Call the wrapped function.
@@ -876,6 +876,150 @@ get_nglRes_s = _hlu.get_nglRes_s
 def NglGaus_p(num, nxir, nyir):
     return _hlu.NglGaus_p(num, nxir, nyir)
 NglGaus_p = _hlu.NglGaus_p
+
+def update_scalar_field_wrap(arg1, plot, sequence_as_void, arg4, arg5, arg6, arg7, arg8, arg9, arg10):
+    return _hlu.update_scalar_field_wrap(arg1, plot, sequence_as_void, arg4, arg5, arg6, arg7, arg8, arg9, arg10)
+update_scalar_field_wrap = _hlu.update_scalar_field_wrap
+
+def update_vector_field_wrap(arg1, plot, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12):
+    return _hlu.update_vector_field_wrap(arg1, plot, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12)
+update_vector_field_wrap = _hlu.update_vector_field_wrap
+
+def panel_layout_p():
+    return _hlu.panel_layout_p()
+panel_layout_p = _hlu.panel_layout_p
+
+def create_mesh(arg1, arg2, arg3, arg4, arg5, arg6, array_as_int, arg8, arg9):
+    return _hlu.create_mesh(arg1, arg2, arg3, arg4, arg5, arg6, array_as_int, arg8, arg9)
+create_mesh = _hlu.create_mesh
+
+def destroy_mesh(arg1):
+    return _hlu.destroy_mesh(arg1)
+destroy_mesh = _hlu.destroy_mesh
+
+def contour_mesh_wrap(arg1, arg2, sequence_as_void, arg4, arg5, arg6, arg7, arg8):
+    return _hlu.contour_mesh_wrap(arg1, arg2, sequence_as_void, arg4, arg5, arg6, arg7, arg8)
+contour_mesh_wrap = _hlu.contour_mesh_wrap
+
+def contour_map_mesh_wrap(arg1, arg2, sequence_as_void, arg4, arg5, arg6, arg7, arg8):
+    return _hlu.contour_map_mesh_wrap(arg1, arg2, sequence_as_void, arg4, arg5, arg6, arg7, arg8)
+contour_map_mesh_wrap = _hlu.contour_map_mesh_wrap
+
+def region_cull_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9):
+    return _hlu.region_cull_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9)
+region_cull_p = _hlu.region_cull_p
+
+def decimate_xy_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11):
+    return _hlu.decimate_xy_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11)
+decimate_xy_p = _hlu.decimate_xy_p
+
+def histogram2d_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13):
+    return _hlu.histogram2d_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, arg13)
+histogram2d_p = _hlu.histogram2d_p
+
+def raster_fill_wrap(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, array_as_int, arg14, arg15, arg16):
+    return _hlu.raster_fill_wrap(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10, arg11, arg12, array_as_int, arg14, arg15, arg16)
+raster_fill_wrap = _hlu.raster_fill_wrap
+
+def png_to_rgba_p(arg1):
+    return _hlu.png_to_rgba_p(arg1)
+png_to_rgba_p = _hlu.png_to_rgba_p
+
+def load_colormap_files():
+    return _hlu.load_colormap_files()
+load_colormap_files = _hlu.load_colormap_files
+
+def compile_rlist_p(arg1):
+    return _hlu.compile_rlist_p(arg1)
+compile_rlist_p = _hlu.compile_rlist_p
+
+def set_nglRes_defaults(arg1):
+    return _hlu.set_nglRes_defaults(arg1)
+set_nglRes_defaults = _hlu.set_nglRes_defaults
+
+def set_nglRes_p(arg1):
+    return _hlu.set_nglRes_p(arg1)
+set_nglRes_p = _hlu.set_nglRes_p
+
+def set_stats(arg1):
+    return _hlu.set_stats(arg1)
+set_stats = _hlu.set_stats
+
+def get_stats_level():
+    return _hlu.get_stats_level()
+get_stats_level = _hlu.get_stats_level
+
+def get_stats_p():
+    return _hlu.get_stats_p()
+get_stats_p = _hlu.get_stats_p
+
+def get_trace_p():
+    return _hlu.get_trace_p()
+get_trace_p = _hlu.get_trace_p
+
+def gc_dist_p(arg1, arg2, arg3, arg4, arg5, arg6):
+    return _hlu.gc_dist_p(arg1, arg2, arg3, arg4, arg5, arg6)
+gc_dist_p = _hlu.gc_dist_p
+
+def gc_azim_p(arg1, arg2, arg3, arg4, arg5):
+    return _hlu.gc_azim_p(arg1, arg2, arg3, arg4, arg5)
+gc_azim_p = _hlu.gc_azim_p
+
+def gc_dest_p(arg1, arg2, arg3, arg4, arg5, arg6):
+    return _hlu.gc_dest_p(arg1, arg2, arg3, arg4, arg5, arg6)
+gc_dest_p = _hlu.gc_dest_p
+
+def gc_dist_pairs_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7):
+    return _hlu.gc_dist_pairs_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7)
+gc_dist_pairs_p = _hlu.gc_dist_pairs_p
+
+def c_wmbarbs(arg1, arg2, arg3, arg4, arg5, arg6):
+    return _hlu.c_wmbarbs(arg1, arg2, arg3, arg4, arg5, arg6)
+c_wmbarbs = _hlu.c_wmbarbs
+
+def wmstnms_p(arg1, arg2, arg3, arg4, arg5, arg6):
+    return _hlu.wmstnms_p(arg1, arg2, arg3, arg4, arg5, arg6)
+wmstnms_p = _hlu.wmstnms_p
+
+def dcapethermo_cols_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7):
+    return _hlu.dcapethermo_cols_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7)
+dcapethermo_cols_p = _hlu.dcapethermo_cols_p
+
+def skewt_thermo_p(arg1, arg2, arg3, arg4):
+    return _hlu.skewt_thermo_p(arg1, arg2, arg3, arg4)
+skewt_thermo_p = _hlu.skewt_thermo_p
+
+def nn_weights_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7):
+    return _hlu.nn_weights_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7)
+nn_weights_p = _hlu.nn_weights_p
+
+def nn_apply_p(arg1, arg2, arg3, arg4):
+    return _hlu.nn_apply_p(arg1, arg2, arg3, arg4)
+nn_apply_p = _hlu.nn_apply_p
+
+def css_fit_p(arg1, arg2, arg3):
+    return _hlu.css_fit_p(arg1, arg2, arg3)
+css_fit_p = _hlu.css_fit_p
+
+def css_grads_p(arg1, arg2, arg3):
+    return _hlu.css_grads_p(arg1, arg2, arg3)
+css_grads_p = _hlu.css_grads_p
+
+def css_eval_p(arg1, arg2, arg3, arg4, arg5, arg6):
+    return _hlu.css_eval_p(arg1, arg2, arg3, arg4, arg5, arg6)
+css_eval_p = _hlu.css_eval_p
+
+def ftcurv_n_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9):
+    return _hlu.ftcurv_n_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9)
+ftcurv_n_p = _hlu.ftcurv_n_p
+
+def ndc_transform_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10):
+    return _hlu.ndc_transform_p(arg1, arg2, arg3, arg4, arg5, arg6, arg7, arg8, arg9, arg10)
+ndc_transform_p = _hlu.ndc_transform_p
+
+def asciiread_p(arg1, arg2, arg3, arg4, arg5):
+    return _hlu.asciiread_p(arg1, arg2, arg3, arg4, arg5)
+asciiread_p = _hlu.asciiread_p
 # This file is compatible with both classic and new-style classes.
 
 
@@ -0,0 +1,59 @@
+import Ngl, numpy, os
+from utils import *
+
+#
+# A file of numbers separated by commas and white space, with some
+# things that aren't numbers mixed in.
+#
+numpy.random.seed(50)
+vals  = numpy.random.uniform(-1000.,1000.,3000)
+ivals = numpy.random.randint(-100000,100000,3000)
+
+fname = "asciiread_test.txt"
+f = open(fname,"w")
+for i in range(0,len(vals),6):
+  f.write(", ".join(["%.7g" % v for v in vals[i:i+6]]) + " ,\n")
+  if (i % 600 == 0):
+    f.write("# header x\n")
+f.close()
+
+#
+# A single-character separator is read natively; a longer one is a
+# regular expression, handled by the Python code. Both give the same
+# values.
+#
+a  = Ngl.asciiread(fname,-1,"double",",")
+ar = Ngl.asciiread(fname,-1,"double","[,]")
+test_value("asciiread: count",len(a),len(vals))
+test_values("asciiread: native vs python",a,ar,1.e-12)
+test_values("asciiread: values",a,vals,1.e-3)
+
+a = Ngl.asciiread(fname,[50,60],"float",",")
+test_value("asciiread: shape",int(a.shape == (50,60)),1)
+test_value("asciiread: float32",int(a.dtype == numpy.float32),1)
+test_values("asciiread: dims",a,vals.reshape(50,60),1.e-3)
+
+#
+# Integers, and a file big enough to be split among threads.
+#
+f = open(fname,"w")
+for k in range(200):
+  f.write(" ".join(["%d" % v for v in ivals]) + "\n")
+f.close()
+a1 = Ngl.asciiread(fname,-1,"integer",",")
+a4 = Ngl.asciiread(fname,-1,"integer",",",threads=4)
+test_value("asciiread: integer count",len(a1),200*len(ivals))
+test_values("asciiread: integers",a1[-len(ivals):],ivals,0.5)
+test_values("asciiread: threads",a4,a1,0.5)
+
+os.remove(fname)
+
+#
+# A file that isn't there raises IOError, as it always has.
+#
+try:
+  Ngl.asciiread("asciiread_test_missing.txt",-1,"float",",")
+  raised = 0
+except IOError:
+  raised = 1
+test_value("asciiread: missing file",raised,1)
@@ -0,0 +1,100 @@
+import Ngl, numpy
+from utils import *
+
+msg = -999.
+
+#
+# Twelve soundings on a 3 x 4 grid, from warm and moist to cool and
+# dry, so that some have CAPE and some don't.
+#
+p   = Ngl.fspan(1000.,200.,17).astype(numpy.float64)
+nlvl = len(p)
+ts  = numpy.array([20.,25.,30.,35.])[numpy.newaxis,numpy.newaxis,:]
+dd0 = numpy.array([1.,5.,15.])[numpy.newaxis,:,numpy.newaxis]
+pp  = p[:,numpy.newaxis,numpy.newaxis]
+tc  = (ts + 273.15)*(pp/1000.)**0.19 - 273.15
+tdc = tc - dd0 - 20.*(1. - pp/1000.)
+
+#
+# The same calls skewt_plt makes for one sounding: the LCL of the
+# lowest level, then DCAPETHERMO. CIN is integrated from the parcel
+# temperatures below the LFC.
+#
+def skewt_cape(p,tc,tdc):
+  p   = numpy.ascontiguousarray(p,dtype=numpy.float64)
+  tc  = numpy.ascontiguousarray(tc,dtype=numpy.float64)
+  plcl,tlcl = Ngl._dptlclskewt(p[0],tc[0],tdc[0])
+  cape,tpar,jlcl,jlfc,jcross = Ngl.dcapethermo(p,tc,len(p),plcl,0,msg)
+  cin = plfc = pel = msg
+  if (cape > 0. and jlfc >= 0 and jlfc < len(p)):
+    plfc = p[jlfc]
+    if (jcross >= jlfc and jcross < len(p)):
+      pel = p[jcross]
+    da = 0.5*((tpar[:jlfc]-tc[:jlfc]) + (tpar[1:jlfc+1]-tc[1:jlfc+1])) * \
+         numpy.log(p[:jlfc]/p[1:jlfc+1])
+    ok = numpy.logical_and(tpar[:jlfc] != msg,tpar[1:jlfc+1] != msg)
+    cin = 287.04*numpy.sum(numpy.minimum(da[ok],0.))
+  return cape,cin,plcl,plfc,pel
+
+ref = numpy.zeros((5,3,4))
+for j in range(3):
+  for i in range(4):
+    ref[:,j,i] = skewt_cape(p,tc[:,j,i],tdc[:,j,i])
+
+names = ["cape","cin","plcl","plfc","pel"]
+out = Ngl.cape_thermo(p,tc,tdc,msg)
+test_value("cape_thermo: some columns with CAPE", \
+           int(numpy.sum(ref[0] > 0.) >= 3),1)
+test_value("cape_thermo: some columns without CAPE", \
+           int(numpy.sum(ref[0] > 0.) < 12),1)
+for n in range(5):
+  test_value("cape_thermo: %s shape" % names[n],int(out[n].shape == (3,4)),1)
+  test_values("cape_thermo: %s" % names[n],out[n],ref[n],1.e-8)
+
+#
+# Levels given top down, and pressure given as a full field, give the
+# same results.
+#
+out_r = Ngl.cape_thermo(p[::-1],tc[::-1],tdc[::-1],msg)
+for n in range(5):
+  test_values("cape_thermo top down: %s" % names[n],out_r[n],ref[n],1.e-8)
+p3d = pp + numpy.zeros(tc.shape)
+out_p = Ngl.cape_thermo(p3d,tc,tdc,msg)
+for n in range(5):
+  test_values("cape_thermo 3D p: %s" % names[n],out_p[n],ref[n],1.e-8)
+
+#
+# A missing value anywhere in a column makes it missing, and only it.
+#
+tcm = tc.copy()
+tcm[5,0,0] = msg
+out_m = Ngl.cape_thermo(p,tcm,tdc,msg)
+for n in range(5):
+  test_value("cape_thermo missing: %s" % names[n],out_m[n][0,0],msg)
+  test_values("cape_thermo missing: other %s" % names[n], \
+              out_m[n].ravel()[1:],ref[n].ravel()[1:],1.e-8)
+
+#
+# A time dimension in front of lev, and float32 input, which gives
+# float32 results of the float32 values.
+#
+tc4  = numpy.array([tc,tc-2.])
+tdc4 = numpy.array([tdc,tdc-2.])
+out_t = Ngl.cape_thermo(p,tc4,tdc4,msg)
+out_2 = Ngl.cape_thermo(p,tc-2.,tdc-2.,msg)
+for n in range(5):
+  test_value("cape_thermo time: %s shape" % names[n], \
+             int(out_t[n].shape == (2,3,4)),1)
+  test_values("cape_thermo time 0: %s" % names[n],out_t[n][0],ref[n],1.e-8)
+  test_values("cape_thermo time 1: %s" % names[n],out_t[n][1],out_2[n],0.)
+
+tc32  = tc.astype(numpy.float32)
+tdc32 = tdc.astype(numpy.float32)
+out_f = Ngl.cape_thermo(p,tc32,tdc32,msg)
+out_d = Ngl.cape_thermo(p,tc32.astype(numpy.float64), \
+                        tdc32.astype(numpy.float64),msg)
+for n in range(5):
+  test_value("cape_thermo float32: %s type" % names[n], \
+             int(out_f[n].dtype == numpy.float32),1)
+  test_values("cape_thermo float32: %s" % names[n],out_f[n], \
+              out_d[n].astype(numpy.float32),0.)
@@ -0,0 +1,81 @@
+import Ngl, numpy
+from utils import *
+
+#
+# A long, noisy curve, with a gap of missing values in it.
+#
+numpy.random.seed(31)
+npts = 1000000
+x = numpy.linspace(0.,100.,npts)
+y = numpy.sin(x) + 0.2*numpy.random.standard_normal(npts)
+y[400000:400100] = -999.
+ncols = 500
+
+wks = Ngl.open_wks("png","decimate_xy")
+
+res = Ngl.Resources()
+res.nglDraw              = False
+res.nglFrame             = False
+res.caYMissingV          = -999.
+res.nglXYDecimate        = True
+res.nglXYDecimateColumns = ncols
+plot = Ngl.xy(wks,x,y,res)
+xo = Ngl.get_float_array(plot.cafield,"caXArray")
+yo = Ngl.get_float_array(plot.cafield,"caYArray")
+
+#
+# At most four points per column, plus the one missing value that
+# marks the gap.
+#
+test_value("decimate_xy: number of points",int(len(yo) <= 4*ncols+1),1)
+test_value("decimate_xy: one missing value",numpy.sum(yo == -999.),1)
+test_value("decimate_xy: x increasing", \
+           int(numpy.all(numpy.diff(xo[yo != -999.]) >= 0.)),1)
+
+#
+# The first and last points are kept, and in every column the lowest
+# and highest values are the same as in the full curve.
+#
+test_value("decimate_xy: first point",yo[0],y[0],1.e-6)
+test_value("decimate_xy: last point",yo[-1],y[-1],1.e-6)
+good  = y != -999.
+goodo = yo != -999.
+col   = numpy.minimum((x*ncols/100.).astype(int),ncols-1)
+colo  = numpy.minimum((xo*ncols/100.).astype(int),ncols-1)
+ymin  = numpy.zeros(ncols) + 1.e30
+ymax  = numpy.zeros(ncols) - 1.e30
+ymino = numpy.zeros(ncols) + 1.e30
+ymaxo = numpy.zeros(ncols) - 1.e30
+numpy.minimum.at(ymin,col[good],y[good])
+numpy.maximum.at(ymax,col[good],y[good])
+numpy.minimum.at(ymino,colo[goodo],yo[goodo])
+numpy.maximum.at(ymaxo,colo[goodo],yo[goodo])
+test_values("decimate_xy: column minimums",ymino,ymin,1.e-6)
+test_values("decimate_xy: column maximums",ymaxo,ymax,1.e-6)
+
+#
+# Several curves keep different points, so they're padded with
+# missing values to the same length.
+#
+y2 = numpy.array([numpy.sin(x),numpy.cos(x)])
+res2 = Ngl.Resources()
+res2.nglDraw              = False
+res2.nglFrame             = False
+res2.nglXYDecimate        = True
+res2.nglXYDecimateColumns = ncols
+plot = Ngl.xy(wks,x,y2,res2)
+yo2 = Ngl.get_MDfloat_array(plot.cafield,"caYArray")
+test_value("decimate_xy: two curves",yo2.shape[0],2)
+test_value("decimate_xy: two curves decimated",int(yo2.shape[1] <= 4*ncols),1)
+test_value("decimate_xy: curve maximums", \
+           numpy.max(numpy.where(yo2 < 1.e19,yo2,-1.e30),axis=1)[1], \
+           numpy.max(y2[1]),1.e-6)
+
+#
+# A curve with fewer than four points per column is left alone.
+#
+plot = Ngl.xy(wks,x[:1000],y2[0,:1000],res2)
+test_value("decimate_xy: short curve", \
+           len(Ngl.get_float_array(plot.cafield,"caYArray")),1000)
+
+Ngl.end()
@@ -0,0 +1,129 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Several curves through the same abscissae, fitted at once and one
+# at a time with Ngl.ftcurv. Both fit each curve with fitgrid in
+# single precision, so the values are identical.
+#
+npts = 21
+x  = Ngl.fspan(0.,10.,npts)**1.2
+y  = numpy.array([numpy.sin(x),numpy.cos(0.5*x),numpy.exp(-0.2*x), \
+                  0.01*x**3,numpy.sqrt(x+1.)])
+xo = Ngl.fspan(x[0]-1.,x[-1]+1.,97)
+
+yo = Ngl.ftcurv_n(x,y,xo)
+test_value("ftcurv_n: shape",int(yo.shape == (5,97)),1)
+for i in range(len(y)):
+  test_values("ftcurv_n vs ftcurv: curve %d" % i,yo[i], \
+              Ngl.ftcurv(x,y[i],xo),0.)
+
+#
+# Abscissae per curve, extra leftmost dimensions, and float32 input.
+#
+x2  = numpy.array([x,2.*x,x+1.,0.5*x,x])
+yo2 = Ngl.ftcurv_n(x2,y,xo)
+for i in range(len(y)):
+  test_values("ftcurv_n vs ftcurv: own abscissae %d" % i,yo2[i], \
+              Ngl.ftcurv(x2[i],y[i],xo),0.)
+
+yo3 = Ngl.ftcurv_n(x,numpy.array([y,2.*y]),xo)
+test_value("ftcurv_n: 3D shape",int(yo3.shape == (2,5,97)),1)
+test_values("ftcurv_n: 3D",yo3[1,3],Ngl.ftcurv(x,2.*y[3],xo),0.)
+
+yo32 = Ngl.ftcurv_n(x,y.astype(numpy.float32),xo)
+test_value("ftcurv_n: float32",int(yo32.dtype == numpy.float32),1)
+test_values("ftcurv_n: float32 values",yo32,yo.astype(numpy.float32),0.)
+
+#
+# The tension is fitgrid's "sig". An explicit 1. is the default, and
+# the parameter is put back afterwards, so Ngl.ftcurv isn't affected.
+# With no tension the curve is a cubic spline; with a lot it is
+# nearly the broken line through the points.
+#
+test_values("ftcurv_n: sigma=1.",Ngl.ftcurv_n(x,y,xo,sigma=1.),yo,0.)
+yo_t = Ngl.ftcurv_n(x,y,xo,sigma=40.)
+test_values("ftcurv_n: sig restored",Ngl.ftcurv(x,y[0],xo),yo[0],0.)
+xi = Ngl.fspan(x[0],x[-1],201)
+yl = Ngl.ftcurv_n(x,y,xi,sigma=40.)
+for i in range(len(y)):
+  test_values("ftcurv_n: large sigma %d" % i,yl[i], \
+              numpy.interp(xi,x,y[i]),0.05*numpy.max(numpy.abs(y[i])))
+test_value("ftcurv_n: tension changes the curve", \
+           int(numpy.max(numpy.abs(yo_t - yo)) > 1.e-4),1)
+
+yc = Ngl.ftcurv_n(x,0.01*x**3,xi,sigma=0.001)
+test_values("ftcurv_n: small sigma, cubic",yc,0.01*xi**3, \
+            1.e-3*numpy.max(0.01*x**3))
+
+#
+# Too few points, and abscissae that aren't increasing, give the same
+# error as Ngl.ftcurv.
+#
+test_value("ftcurv_n: too few points", \
+           int(Ngl.ftcurv_n(x[:1],y[:,:1],xo) is None and \
+               Ngl.ftcurv(x[:1],y[0,:1],xo) is None),1)
+xbad = x.copy()
+xbad[5] = xbad[4]
+test_value("ftcurv_n: not increasing", \
+           int(Ngl.ftcurv_n(xbad,y,xo) is None and \
+               Ngl.ftcurv(xbad,y[0],xo) is None),1)
+
+#
+# Periodic curves, and their integrals, including over more than a
+# period and backwards.
+#
+p  = 2.*numpy.pi
+xp = numpy.linspace(0.,p,25)[:-1]
+yp = numpy.array([numpy.sin(xp),numpy.cos(2.*xp)+0.5*numpy.sin(xp)])
+xo = Ngl.fspan(-7.,15.,121)
+ypo = Ngl.ftcurvp_n(xp,yp,p,xo)
+for i in range(len(yp)):
+  test_values("ftcurvp_n vs ftcurvp: curve %d" % i,ypo[i], \
+              Ngl.ftcurvp(xp,yp[i],p,xo),0.)
+  for xl,xr in [(0.5,9.),(-3.,20.),(9.,0.5),(1.,1.)]:
+    test_values("ftcurvpi_n vs ftcurvpi: curve %d, %g to %g" % (i,xl,xr), \
+                Ngl.ftcurvpi_n(xl,xr,p,xp,yp)[i], \
+                Ngl.ftcurvpi(xl,xr,p,xp,yp[i]),0.)
+
+ypo,iyo = Ngl.ftcurvp_n(xp,yp,p,xo,full=True)
+test_value("ftcurvp_n full: integral shape",int(iyo.shape == ypo.shape),1)
+for k in [0,40,120]:
+  test_values("ftcurvp_n full: integral to %g" % xo[k],iyo[1,k], \
+              Ngl.ftcurvpi(xo[0],xo[k],p,xp,yp[1]),0.)
+
+#
+# Points spread unevenly, with the last one just short of a period
+# after the first, a period longer than the span, and a period shorter
+# than the span (an error for both).
+#
+xu = numpy.array([0.,0.3,1.,1.1,2.5,4.,5.,6.2])
+yu = numpy.cos(xu)
+for pu in [6.2+1.e-4,8.]:
+  test_values("ftcurvp_n vs ftcurvp: period %g" % pu, \
+              Ngl.ftcurvp_n(xu,yu,pu,xo),Ngl.ftcurvp(xu,yu,pu,xo),0.)
+  test_values("ftcurvp_n vs ftcurvp: period %g, sigma=1." % pu, \
+              Ngl.ftcurvp_n(xu,yu,pu,xo,sigma=1.), \
+              Ngl.ftcurvp(xu,yu,pu,xo),0.)
+test_value("ftcurvp_n: period shorter than the span", \
+           int(Ngl.ftcurvp_n(xu,yu,6.,xo) is None and \
+               Ngl.ftcurvp(xu,yu,6.,xo) is None),1)
+test_value("ftcurvp_n: sigma changes the curve", \
+           int(numpy.max(numpy.abs(Ngl.ftcurvp_n(xu,yu,8.,xo,sigma=30.) - \
+                                   Ngl.ftcurvp(xu,yu,8.,xo))) > 1.e-4),1)
+
+#
+# The derivatives and integrals returned with full=True agree with the
+# values: differences of the integrals are integrals of the values,
+# and differences of the values are integrals of the derivatives, to
+# about single precision.
+#
+xo = Ngl.fspan(x[0],x[-1],4001)
+yo,dyo,iyo = Ngl.ftcurv_n(x,y,xo,sigma=2.5,full=True)
+dx = xo[1] - xo[0]
+test_values("ftcurv_n: integrals", numpy.diff(iyo,axis=-1), \
+            0.5*dx*(yo[:,1:] + yo[:,:-1]),1.e-4)
+test_values("ftcurv_n: derivatives", numpy.diff(yo,axis=-1), \
+            0.5*dx*(dyo[:,1:] + dyo[:,:-1]),1.e-4)
+test_values("ftcurv_n: interpolates",Ngl.ftcurv_n(x,y,x,sigma=2.5),y,1.e-4)
+test_values("ftcurv_n: integral from xo[0]",iyo[:,0],numpy.zeros(len(y)),0.)
@@ -0,0 +1,30 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Gaussian latitudes and weights for a few grid sizes, checked against
+# the Gauss-Legendre nodes and weights from numpy.
+#
+for nlat in [1,2,32,64,640]:
+  ginfo = Ngl.gaus(nlat)
+  title = "gaus(%d): " % nlat
+  test_value(title + "shape",int(ginfo.shape == (2*nlat,2)),1)
+
+  x,w = numpy.polynomial.legendre.leggauss(2*nlat)
+  test_values(title + "latitudes",ginfo[:,0], \
+              numpy.degrees(numpy.arcsin(x)),1.e-10)
+  test_values(title + "weights",ginfo[:,1],w,1.e-12)
+
+  test_value(title + "sum of weights",numpy.sum(ginfo[:,1]),2.,1.e-12)
+  test_values(title + "symmetry",ginfo[:,0],-ginfo[::-1,0],1.e-12)
+
+#
+# An n-point rule integrates polynomials of degree 2n-1 exactly; here
+# sin(lat)**k over the sphere, as a weighted sum over the latitudes.
+#
+ginfo = Ngl.gaus(8)
+mu    = numpy.sin(numpy.radians(ginfo[:,0]))
+for k in [0,2,6,15,30]:
+  exact = (1. - (-1.)**(k+1))/(k+1.)
+  test_value("gaus(8): integral of mu**%d" % k, \
+             numpy.sum(ginfo[:,1]*mu**k),exact,1.e-13)
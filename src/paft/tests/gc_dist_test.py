@@ -0,0 +1,82 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Reference great circle distance, azimuth and destination, written
+# out with the usual spherical trig formulas.
+#
+d2r = numpy.pi/180.
+
+def ref_dist(lat1,lon1,lat2,lon2):
+  lat1,lon1,lat2,lon2 = [d2r*numpy.asarray(a,dtype=numpy.float64) \
+                         for a in (lat1,lon1,lat2,lon2)]
+  h = numpy.sin(0.5*(lat2-lat1))**2 + \
+      numpy.cos(lat1)*numpy.cos(lat2)*numpy.sin(0.5*(lon2-lon1))**2
+  return 2.*numpy.arcsin(numpy.sqrt(numpy.minimum(h,1.)))/d2r
+
+def ref_azim(lat1,lon1,lat2,lon2):
+  lat1,lon1,lat2,lon2 = [d2r*numpy.asarray(a,dtype=numpy.float64) \
+                         for a in (lat1,lon1,lat2,lon2)]
+  az = numpy.arctan2(numpy.sin(lon2-lon1)*numpy.cos(lat2), \
+                     numpy.cos(lat1)*numpy.sin(lat2) - \
+                     numpy.sin(lat1)*numpy.cos(lat2)*numpy.cos(lon2-lon1))
+  return numpy.mod(az/d2r,360.)
+
+#
+# Scalars, including the quarter and half circles and two points that
+# are very close together.
+#
+test_value("gc_dist: quarter circle",Ngl.gc_dist(0.,0.,0.,90.),90.,1.e-10)
+test_value("gc_dist: pole",Ngl.gc_dist(0.,0.,90.,0.),90.,1.e-10)
+test_value("gc_dist: antipodes",Ngl.gc_dist(10.,20.,-10.,-160.),180.,1.e-10)
+test_value("gc_dist: nearby points",Ngl.gc_dist(40.,-105.,40.,-105.+1.e-7), \
+           ref_dist(40.,-105.,40.,-105.+1.e-7),1.e-14)
+
+#
+# Arrays are broadcast against each other, and give the same answers
+# as the scalar calls.
+#
+numpy.random.seed(10)
+lat1 = numpy.random.uniform(-90.,90.,(4,50))
+lon1 = numpy.random.uniform(-180.,180.,(4,50))
+lat2 = numpy.random.uniform(-90.,90.,50)
+lon2 = 30.
+
+dist = Ngl.gc_dist(lat1,lon1,lat2,lon2)
+test_value("gc_dist: broadcast shape",int(dist.shape == (4,50)),1)
+test_values("gc_dist: arrays",dist,ref_dist(lat1,lon1,lat2,lon2),1.e-9)
+test_value("gc_dist: array vs scalar", \
+           dist[2,7],Ngl.gc_dist(lat1[2,7],lon1[2,7],lat2[7],lon2),1.e-12)
+
+azim = Ngl.gc_azimuth(lat1,lon1,lat2,lon2)
+test_values("gc_azimuth: arrays",azim,ref_azim(lat1,lon1,lat2,lon2),1.e-8)
+test_value("gc_azimuth: due east",Ngl.gc_azimuth(0.,0.,0.,90.),90.,1.e-10)
+test_value("gc_azimuth: due north",Ngl.gc_azimuth(0.,0.,10.,0.),0.,1.e-10)
+
+#
+# Going the distance along the azimuth from the first point should
+# land on the second.
+#
+lat3,lon3 = Ngl.gc_destination(lat1,lon1,dist,azim)
+test_values("gc_destination: round trip", \
+            ref_dist(lat3,lon3,lat2,lon2),numpy.zeros((4,50)),1.e-8)
+lat3,lon3 = Ngl.gc_destination(0.,0.,90.,90.)
+test_value("gc_destination: quarter circle lat",lat3,0.,1.e-10)
+test_value("gc_destination: quarter circle lon",lon3,90.,1.e-10)
+
+#
+# The distance matrix holds the distance between every pair of points.
+#
+lat4 = numpy.random.uniform(-90.,90.,700)
+lon4 = numpy.random.uniform(-180.,180.,700)
+dmat = Ngl.gc_dist_matrix(lat1[0],lon1[0],lat4,lon4)
+test_value("gc_dist_matrix: shape",int(dmat.shape == (50,700)),1)
+test_values("gc_dist_matrix", dmat, \
+            ref_dist(lat1[0][:,numpy.newaxis],lon1[0][:,numpy.newaxis], \
+                     lat4[numpy.newaxis,:],lon4[numpy.newaxis,:]),1.e-9)
+
+#
+# One octant of the unit sphere.
+#
+test_value("gc_tarea: octant",Ngl.gc_tarea(0.,0.,0.,90.,90.,0.), \
+           numpy.pi/2.,1.e-6)
@@ -0,0 +1,68 @@
+import Ngl, numpy, os, tempfile
+from utils import *
+
+#
+# Two frames drawn on an image workstation come back from
+# Ngl.get_images in order, and the files they went through are gone.
+#
+def draw_frames(wks):
+  res = Ngl.Resources()
+  res.cnFillOn = True
+  y = Ngl.fspan(-1.,1.,20)[:,numpy.newaxis]
+  x = Ngl.fspan(-1.,1.,30)[numpy.newaxis,:]
+  Ngl.contour(wks,numpy.sin(3.*x)*numpy.cos(2.*y),res)
+  Ngl.contour(wks,numpy.cos(3.*x)*numpy.sin(2.*y),res)
+
+wres = Ngl.Resources()
+wres.nglImageInMemory = True
+wres.wkWidth          = 400
+wres.wkHeight         = 300
+wks = Ngl.open_wks("png","image_in_memory",wres)
+image_dir = Ngl._image_wks_dirs[wks]
+if os.path.isdir("/dev/shm") and os.access("/dev/shm",os.W_OK):
+  test_value("images: frames go to /dev/shm", \
+             int(image_dir.startswith("/dev/shm")),1)
+
+draw_frames(wks)
+pngs = Ngl.get_images(wks)
+test_value("images: number of frames",len(pngs),2)
+test_value("images: PNG bytes",int(pngs[0][:8] == b"\x89PNG\r\n\x1a\n"),1)
+test_value("images: files removed",len(os.listdir(image_dir)),0)
+test_value("images: nothing new",len(Ngl.get_images(wks)),0)
+
+draw_frames(wks)
+images = Ngl.get_images(wks,rgba=True)
+test_value("images: RGBA shape",int(images[0].shape == (300,400,4)),1)
+test_value("images: frames differ", \
+           int(numpy.any(images[0] != images[1])),1)
+
+Ngl.delete_wks(wks)
+test_value("images: directory removed",int(os.path.exists(image_dir)),0)
+
+#
+# Without a writable /dev/shm, the frames go to the system temporary
+# directory instead, and everything else works the same.
+#
+Ngl._image_shm_dir = "/nonexistent/shm"
+wks = Ngl.open_wks("png","image_in_memory",wres)
+image_dir = Ngl._image_wks_dirs[wks]
+test_value("images: no tmpfs, temporary directory", \
+           int(os.path.dirname(image_dir) == tempfile.gettempdir()),1)
+draw_frames(wks)
+images2 = Ngl.get_images(wks,rgba=True)
+test_value("images: no tmpfs, number of frames",len(images2),2)
+test_value("images: no tmpfs, same image", \
+           int(numpy.all(images2[0] == images[0])),1)
+Ngl.delete_wks(wks)
+test_value("images: no tmpfs, directory removed", \
+           int(os.path.exists(image_dir)),0)
+
+#
+# The name given to open_wks isn't used, so no file of that name is
+# left behind.
+#
+test_value("images: name unused", \
+           int(os.path.exists("image_in_memory.png") or \
+               os.path.exists("image_in_memory.000001.png")),0)
+
+Ngl.end()
@@ -0,0 +1,74 @@
+import os, tempfile, numpy
+
+#
+# Two colormap files of our own, in a directory of their own. Lazy
+# loading has to be asked for before Ngl is imported.
+#
+cmap_dir = tempfile.mkdtemp()
+colors1 = numpy.array([[255,0,0],[0,255,0],[0,0,255]])
+colors2 = numpy.array([[10,20,30],[40,50,60],[70,80,90],[100,110,120]])
+for name,colors in (("pyngl_test1",colors1),("pyngl_test2",colors2)):
+  fp = open(os.path.join(cmap_dir,name + ".rgb"),"w")
+  fp.write("ncolors=%d\n# r g b\n" % len(colors))
+  for c in colors:
+    fp.write("%d %d %d\n" % tuple(c))
+  fp.close()
+os.environ["PYNGL_COLORMAPS"]      = cmap_dir
+os.environ["PYNGL_LAZY_COLORMAPS"] = "1"
+
+import Ngl
+from utils import *
+
+#
+# A colormap named when the workstation is opened is loaded with it.
+#
+wres = Ngl.Resources()
+wres.wkColorMap = "pyngl_test1"
+wks = Ngl.open_wks("png","lazy_colormaps",wres)
+cmap = Ngl.retrieve_colormap(wks)
+test_values("lazy colormaps: open_wks",cmap[-3:],colors1/255.,1.e-6)
+
+#
+# NCARG_COLORMAPS now names a private directory, which is emptied
+# once its files are loaded.
+#
+private = os.environ["NCARG_COLORMAPS"]
+test_value("lazy colormaps: private directory", \
+           int(private != cmap_dir and os.path.isdir(private)),1)
+test_value("lazy colormaps: directory emptied",len(os.listdir(private)),0)
+
+#
+# A colormap first named after the workstation is open is loaded
+# then, without the environment changing again.
+#
+sres = Ngl.Resources()
+sres.wkColorMap = "pyngl_test2"
+Ngl.set_values(wks,sres)
+cmap = Ngl.retrieve_colormap(wks)
+test_values("lazy colormaps: set_values",cmap[-4:],colors2/255.,1.e-6)
+test_value("lazy colormaps: same directory", \
+           int(os.environ["NCARG_COLORMAPS"] == private),1)
+test_value("lazy colormaps: directory emptied again", \
+           len(os.listdir(private)),0)
+
+#
+# Built-in colormaps still work.
+#
+sres.wkColorMap = "default"
+Ngl.set_values(wks,sres)
+test_value("lazy colormaps: built-in",int(len(Ngl.retrieve_colormap(wks)) > 2),1)
+
+Ngl.delete_wks(wks)
+
+#
+# At exit the private directory goes, and NCARG_COLORMAPS is put back.
+#
+Ngl._remove_colormap_dir()
+test_value("lazy colormaps: directory removed",int(os.path.exists(private)),0)
+test_value("lazy colormaps: environment restored", \
+           int(os.environ.get("NCARG_COLORMAPS") == cmap_dir),1)
+
+for fname in os.listdir(cmap_dir):
+  os.remove(os.path.join(cmap_dir,fname))
+os.rmdir(cmap_dir)
+Ngl.end()
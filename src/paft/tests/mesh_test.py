@@ -0,0 +1,86 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Random points on the sphere, and two fields on them.
+#
+numpy.random.seed(29)
+npts = 500
+lat  = numpy.degrees(numpy.arcsin(numpy.random.uniform(-1.,1.,npts)))
+lon  = numpy.random.uniform(-180.,180.,npts)
+f1   = numpy.cos(numpy.radians(lat))*numpy.sin(2.*numpy.radians(lon))
+f2   = numpy.sin(numpy.radians(lat))
+
+m = Ngl.mesh(lon,lat)
+test_value("mesh: number of points",m.npts,npts)
+
+wks = Ngl.open_wks("png","mesh")
+
+res = Ngl.Resources()
+res.nglDraw   = False
+res.nglFrame  = False
+res.cnFillOn  = True
+res.cnLinesOn = False
+
+#
+# Only the data is new in each plot; the coordinates and triangles
+# come from the mesh, and both plots get the same triangles.
+#
+plot1 = Ngl.contour_map(wks,f1,res,mesh=m)
+plot2 = Ngl.contour_map(wks,f2,res,mesh=m)
+test_values("mesh: data",Ngl.get_float_array(plot1.sffield,"sfDataArray"), \
+            f1,1.e-6)
+test_values("mesh: x",Ngl.get_float_array(plot1.sffield,"sfXArray"), \
+            lon,1.e-4)
+test_values("mesh: y",Ngl.get_float_array(plot1.sffield,"sfYArray"), \
+            lat,1.e-4)
+nodes1 = Ngl.get_MDinteger_array(plot1.sffield,"sfElementNodes")
+nodes2 = Ngl.get_MDinteger_array(plot2.sffield,"sfElementNodes")
+test_value("mesh: triangles",int(nodes1.shape[1] == 3),1)
+test_values("mesh: shared triangles",nodes2,nodes1,0)
+test_value("mesh: first node index", \
+           Ngl.get_integer(plot1.sffield,"sfFirstNodeIndex"),0)
+
+#
+# Every point is a vertex of some triangle, and on the sphere there
+# are 2n-4 of them.
+#
+test_value("mesh: all points used", \
+           len(numpy.unique(numpy.ravel(nodes1))),npts)
+test_value("mesh: number of triangles",nodes1.shape[0],2*npts-4)
+
+#
+# The mesh plot picks the same levels as a plot that's given the
+# coordinates directly.
+#
+res2 = Ngl.Resources()
+res2.nglDraw   = False
+res2.nglFrame  = False
+res2.cnFillOn  = True
+res2.cnLinesOn = False
+res2.sfXArray  = lon
+res2.sfYArray  = lat
+plot3 = Ngl.contour_map(wks,f1,res2)
+test_values("mesh: levels",Ngl.get_float_array(plot1.contour,"cnLevels"), \
+            Ngl.get_float_array(plot3.contour,"cnLevels"),1.e-6)
+
+#
+# Triangles given by the caller are passed through as they are.
+#
+tri = nodes1[:100]
+m2  = Ngl.mesh(lon,lat,element_nodes=tri)
+plot4 = Ngl.contour(wks,f1,res,mesh=m2)
+test_values("mesh: given triangles", \
+            Ngl.get_MDinteger_array(plot4.sffield,"sfElementNodes"),tri,0)
+
+#
+# Data of the wrong length is refused.
+#
+test_value("mesh: wrong length", \
+           int(Ngl.contour(wks,f1[:-1],res,mesh=m) is None),1)
+
+m.destroy()
+m2.destroy()
+test_value("mesh: destroyed",m.id,-1)
+
+Ngl.end()
@@ -0,0 +1,107 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Random points in the unit square, with its corners so that the
+# square is the convex hull.
+#
+numpy.random.seed(46)
+npts = 400
+x = numpy.concatenate([[0.,1.,1.,0.],numpy.random.uniform(0.,1.,npts)])
+y = numpy.concatenate([[0.,0.,1.,1.],numpy.random.uniform(0.,1.,npts)])
+
+def field(x,y):
+  return numpy.sin(3.*x)*numpy.cos(2.*y) + x*y
+
+#
+# Well inside the hull the weights give the same values as natgrid.
+#
+xo = Ngl.fspan(0.2,0.8,25)
+yo = Ngl.fspan(0.2,0.8,31)
+interp = Ngl.natgrid_interpolator(x,y,xo,yo)
+
+z  = field(x,y)
+zo = interp.interpolate(z)
+test_value("natgrid_interpolator: shape",int(zo.shape == (25,31)),1)
+test_values("natgrid_interpolator vs natgrid",zo, \
+            Ngl.natgrid(x,y,z,xo,yo),1.e-6)
+
+#
+# Linear natural neighbor interpolation reproduces a plane exactly.
+#
+zp = 2. + 3.*x - 4.*y
+test_values("natgrid_interpolator: plane",interp.interpolate(zp), \
+            2. + 3.*xo[:,numpy.newaxis] - 4.*yo[numpy.newaxis,:],1.e-10)
+
+#
+# A stack of fields gives the same values as one field at a time.
+#
+zs  = numpy.array([z,zp,z*zp])
+zos = interp.interpolate(zs)
+test_value("natgrid_interpolator: stack shape", \
+           int(zos.shape == (3,25,31)),1)
+for i in range(3):
+  test_values("natgrid_interpolator: stack field %d" % i,zos[i], \
+              interp.interpolate(zs[i]),1.e-14)
+
+#
+# float32 fields give float32 grids.
+#
+zo32 = interp.interpolate(z.astype(numpy.float32))
+test_value("natgrid_interpolator: float32", \
+           int(zo32.dtype == numpy.float32),1)
+
+#
+# Outside the hull, unlike natgrid, the interpolator doesn't
+# extrapolate: those points get the "nul" value.
+#
+Ngl.nnsetp("nul",-999.)
+xo = numpy.array([-0.5,0.5,1.5])
+yo = numpy.array([0.5])
+zo = Ngl.natgrid_interpolator(x,y,xo,yo).interpolate(z)
+test_value("natgrid_interpolator: left of hull",zo[0,0],-999.)
+test_value("natgrid_interpolator: inside hull",zo[1,0], \
+           Ngl.natgrid(x,y,z,xo[1:2],yo)[0,0],1.e-6)
+test_value("natgrid_interpolator: right of hull",zo[2,0],-999.)
+
+interp = Ngl.natgrid_interpolator(x,y,xo,yo)
+test_value("natgrid_interpolator: points outside",interp.outside,2)
+Ngl.nnsetp("ext",0)
+interp = Ngl.natgrid_interpolator(x,y,xo,yo)
+test_value("natgrid_interpolator: points outside, ext off",interp.outside,2)
+test_value("natgrid_interpolator: outside, ext off", \
+           interp.interpolate(z)[0,0],-999.)
+Ngl.nnsetp("ext",1)
+
+#
+# Points on the hull, along its edges and at its corners, are
+# interpolated, not treated as outside. A plane is still reproduced
+# there, and the corners, which are input points, get their values.
+#
+xo = numpy.array([0.,0.3,1.])
+yo = numpy.array([0.,0.6,1.])
+interp = Ngl.natgrid_interpolator(x,y,xo,yo)
+test_value("natgrid_interpolator: hull points outside",interp.outside,0)
+test_values("natgrid_interpolator: plane on hull",interp.interpolate(zp), \
+            2. + 3.*xo[:,numpy.newaxis] - 4.*yo[numpy.newaxis,:],1.e-6)
+zo = interp.interpolate(z)
+test_values("natgrid_interpolator: hull corners", \
+            [zo[0,0],zo[2,0],zo[2,2],zo[0,2]],z[0:4],1.e-6)
+
+#
+# A point with the same coordinates as an earlier one is ignored,
+# whatever its value.
+#
+xd = numpy.concatenate([x,x[10:20]])
+yd = numpy.concatenate([y,y[10:20]])
+zd = numpy.concatenate([z,z[10:20]+5.])
+xo = Ngl.fspan(0.1,0.9,17)
+yo = Ngl.fspan(0.1,0.9,13)
+interp  = Ngl.natgrid_interpolator(x,y,xo,yo)
+interpd = Ngl.natgrid_interpolator(xd,yd,xo,yo)
+test_value("natgrid_interpolator: duplicates outside",interpd.outside,0)
+test_values("natgrid_interpolator: duplicates ignored", \
+            interpd.interpolate(zd),interp.interpolate(z),1.e-12)
+test_values("natgrid_interpolator: at a duplicated point", \
+            Ngl.natgrid_interpolator(xd,yd,x[10:11],y[10:11]). \
+            interpolate(zd),z[10:11].reshape(1,1),1.e-12)
@@ -0,0 +1,105 @@
+import Ngl, numpy
+from utils import *
+
+pos = Ngl._spc_res_pos
+
+#
+# The defaults for the plotting functions and for the primitives.
+#
+Ngl.set_nglRes_defaults(0)
+test_value("defaults: nglMaximize",Ngl.get_nglRes_i(pos["Maximize"]),1)
+test_value("defaults: nglFrame",Ngl.get_nglRes_i(pos["Frame"]),1)
+test_value("defaults: nglDraw",Ngl.get_nglRes_i(pos["Draw"]),1)
+test_value("defaults: nglSpreadColorStart", \
+           Ngl.get_nglRes_i(pos["SpreadColorStart"]),2)
+test_value("defaults: nglPaperWidth", \
+           Ngl.get_nglRes_f(pos["PaperWidth"]),8.5,1e-6)
+test_value("defaults: nglPanelInvsblTop", \
+           Ngl.get_nglRes_f(pos["PanelInvsblTop"]),-999.,1e-6)
+test_value("defaults: nglMaskLambertConformalOutlineOn", \
+           Ngl.get_nglRes_i(pos["MaskLambertConformalOutlineOn"]),1)
+
+Ngl.set_nglRes_defaults(1)
+test_value("primitive defaults: nglMaximize", \
+           Ngl.get_nglRes_i(pos["Maximize"]),0)
+test_value("primitive defaults: nglFrame",Ngl.get_nglRes_i(pos["Frame"]),0)
+test_value("primitive defaults: nglDraw",Ngl.get_nglRes_i(pos["Draw"]),1)
+
+#
+# Integer, float, string and boolean values, and values given by name,
+# all set in one call.
+#
+Ngl.set_nglRes_defaults(0)
+Ngl._set_spc_res_list({"Draw"             : False, \
+                       "SpreadColorEnd"   : 20, \
+                       "PanelXWhiteSpacePercent" : 5., \
+                       "PaperHeight"      : 9, \
+                       "YRefLine"         : 0.5, \
+                       "PaperOrientation" : "Landscape", \
+                       "XAxisType"        : "LogAxis", \
+                       "AppResFileName"   : "bulk.res", \
+                       "PanelLayoutOnly"  : True})
+test_value("bulk: nglDraw",Ngl.get_nglRes_i(pos["Draw"]),0)
+test_value("bulk: nglSpreadColorEnd", \
+           Ngl.get_nglRes_i(pos["SpreadColorEnd"]),20)
+test_value("bulk: nglPanelXWhiteSpacePercent", \
+           Ngl.get_nglRes_f(pos["PanelXWhiteSpacePercent"]),5.,1e-6)
+test_value("bulk: nglPaperHeight", \
+           Ngl.get_nglRes_f(pos["PaperHeight"]),9.,1e-6)
+test_value("bulk: nglYRefLine",Ngl.get_nglRes_f(pos["YRefLine"]),0.5,1e-6)
+test_value("bulk: nglPaperOrientation", \
+           Ngl.get_nglRes_i(pos["PaperOrientation"]),6)
+test_value("bulk: nglXAxisType",Ngl.get_nglRes_i(pos["XAxisType"]),2)
+test_value("bulk: nglAppResFileName", \
+           int(Ngl.get_nglRes_s(pos["AppResFileName"]) == "bulk.res"),1)
+test_value("bulk: nglPanelLayoutOnly", \
+           Ngl.get_nglRes_i(pos["PanelLayoutOnly"]),1)
+test_value("bulk: others unchanged",Ngl.get_nglRes_i(pos["Frame"]),1)
+
+#
+# Unknown names and unknown string values are skipped without
+# touching anything else.
+#
+Ngl._set_spc_res_list({"NoSuchResource" : 1, "YAxisType" : "bogus", \
+                       "SpreadColorStart" : 4})
+test_value("bulk: unknown value skipped", \
+           Ngl.get_nglRes_i(pos["YAxisType"]),0)
+test_value("bulk: rest still set", \
+           Ngl.get_nglRes_i(pos["SpreadColorStart"]),4)
+
+#
+# The defaults are copied back in full, so nothing from the last call
+# is left over.
+#
+Ngl.set_nglRes_defaults(0)
+test_value("reset: nglDraw",Ngl.get_nglRes_i(pos["Draw"]),1)
+test_value("reset: nglSpreadColorEnd", \
+           Ngl.get_nglRes_i(pos["SpreadColorEnd"]),-1)
+test_value("reset: nglPaperHeight", \
+           Ngl.get_nglRes_f(pos["PaperHeight"]),11.,1e-6)
+test_value("reset: nglXAxisType",Ngl.get_nglRes_i(pos["XAxisType"]),0)
+test_value("reset: nglPanelLayoutOnly", \
+           Ngl.get_nglRes_i(pos["PanelLayoutOnly"]),0)
+
+#
+# The plotting functions start from the defaults on every call.
+#
+y = Ngl.fspan(-1.,1.,20)[:,numpy.newaxis]
+x = Ngl.fspan(-1.,1.,30)[numpy.newaxis,:]
+data = numpy.sin(3.*x)*numpy.cos(2.*y)
+
+wks = Ngl.open_wks("png","nglres_bulk")
+res = Ngl.Resources()
+res.nglDraw     = False
+res.nglFrame    = False
+res.nglMaximize = False
+plot = Ngl.contour(wks,data,res)
+test_value("contour: nglDraw",Ngl.get_nglRes_i(pos["Draw"]),0)
+test_value("contour: nglMaximize",Ngl.get_nglRes_i(pos["Maximize"]),0)
+
+plot = Ngl.contour(wks,data,Ngl.Resources())
+test_value("contour again: nglDraw",Ngl.get_nglRes_i(pos["Draw"]),1)
+test_value("contour again: nglMaximize", \
+           Ngl.get_nglRes_i(pos["Maximize"]),1)
+
+Ngl.end()
@@ -0,0 +1,84 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Four contour plots of the same size, paneled 2 x 2.
+#
+ny = 30
+nx = 40
+y  = Ngl.fspan(-1.,1.,ny)[:,numpy.newaxis]
+x  = Ngl.fspan(-1.,1.,nx)[numpy.newaxis,:]
+
+wks = Ngl.open_wks("png","panel_layout")
+
+res = Ngl.Resources()
+res.nglDraw        = False
+res.nglFrame       = False
+res.cnFillOn       = True
+res.cnLinesOn      = False
+res.cnLineLabelsOn = False
+res.lbLabelBarOn   = False
+plots = [Ngl.contour(wks,numpy.sin((i+1)*x)*numpy.cos(2.*y),res) \
+         for i in range(4)]
+
+vpnames = ("vpXF","vpYF","vpWidthF","vpHeightF")
+def viewports(plots):
+  return numpy.array([[Ngl.get_float(p.base,n) for n in vpnames] \
+                      for p in plots])
+
+#
+# Layout only: the positions come back and the plots aren't moved.
+#
+before = viewports(plots)
+pres = Ngl.Resources()
+pres.nglPanelLayoutOnly = True
+pres.nglPanelLabelBar   = True
+layout = Ngl.panel(wks,plots,[2,2],pres)
+test_value("panel layout: shape",int(layout.shape == (5,4)),1)
+test_values("panel layout: plots untouched",viewports(plots),before,1.e-6)
+
+#
+# Plots in the same row share a Y position, plots in the same column
+# share an X position, and all are the same size.
+#
+test_value("panel layout: row 1",layout[0,1],layout[1,1],1.e-5)
+test_value("panel layout: row 2",layout[2,1],layout[3,1],1.e-5)
+test_value("panel layout: column 1",layout[0,0],layout[2,0],1.e-5)
+test_value("panel layout: column 2",layout[1,0],layout[3,0],1.e-5)
+test_value("panel layout: left to right",int(layout[1,0] > layout[0,0]),1)
+test_value("panel layout: top to bottom",int(layout[2,1] < layout[0,1]),1)
+test_values("panel layout: widths",layout[:4,2],layout[0,2]*numpy.ones(4), \
+            1.e-5)
+test_value("panel layout: in frame", \
+           int(numpy.all(layout[:,0] >= 0.) and \
+               numpy.all(layout[:,0] + layout[:,2] <= 1.) and \
+               numpy.all(layout[:,1] <= 1.) and \
+               numpy.all(layout[:,1] - layout[:,3] >= 0.)),1)
+
+#
+# The labelbar goes below the bottom row of plots.
+#
+test_value("panel layout: labelbar below plots", \
+           int(layout[4,1] < layout[2,1] - layout[2,3]),1)
+
+#
+# A missing plot gets -999. for its position, and the others keep
+# theirs.
+#
+layout2 = Ngl.panel(wks,[plots[0],plots[1],0,plots[3]],[2,2],pres)
+test_values("panel layout: missing plot",layout2[2], \
+            -999.*numpy.ones(4),1.e-6)
+test_values("panel layout: others kept",layout2[[0,1,3]], \
+            layout[[0,1,3]],1.e-5)
+
+#
+# Drawing the panel puts the plots where the layout said it would.
+# nglPanelSave keeps them there afterwards so they can be checked.
+#
+pres.nglPanelLayoutOnly = False
+pres.nglPanelSave       = True
+Ngl.panel(wks,plots,[2,2],pres)
+test_values("panel layout: matches drawn panel",viewports(plots), \
+            layout[:4],1.e-3)
+
+Ngl.end()
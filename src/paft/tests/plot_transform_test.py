@@ -0,0 +1,173 @@
+import Ngl, numpy
+from numpy import ma
+from utils import *
+
+wks = Ngl.open_wks("ps","plot_transform")
+
+#
+# Compares a PlotTransform with Ngl.datatondc and Ngl.ndctodata, which
+# go through the HLU transformation in float: the same points must be
+# out of range, and the others agree to float32 accuracy.
+#
+def check_hlu(title,trans,plot,x,y,delta):
+  xn,yn = trans.datatondc(x,y)
+  xh,yh = Ngl.datatondc(plot,x,y)
+  oor = numpy.logical_or(xn == trans.out_of_range,yn == trans.out_of_range)
+  test_value(title + ": datatondc out of range", \
+             int(numpy.array_equal(oor,ma.getmaskarray(xh))),1)
+  ok = numpy.logical_not(oor)
+  test_values(title + ": datatondc x",xn[ok],ma.getdata(xh)[ok],delta)
+  test_values(title + ": datatondc y",yn[ok],ma.getdata(yh)[ok],delta)
+
+  xd,yd = trans.ndctodata(xn[ok],yn[ok])
+  xh,yh = Ngl.ndctodata(plot,xn[ok],yn[ok])
+  test_values(title + ": ndctodata x",xd,ma.getdata(xh),delta*abs(x).max())
+  test_values(title + ": ndctodata y",yd,ma.getdata(yh),delta*abs(y).max())
+
+#
+# A linear XY plot is done in double precision, so the round trip is
+# exact to double precision, for arrays of any shape, with the
+# results in the caller's arrays if given.
+#
+x = Ngl.fspan(100.,399.,300)
+y = 500. + x*numpy.sin(0.0314159*x)
+res = Ngl.Resources()
+res.nglDraw  = False
+res.nglFrame = False
+xy = Ngl.xy(wks,x,y,res)
+trans = Ngl.plot_transform(xy)
+test_value("linear: done in NumPy",int(trans.linear is not None),1)
+check_hlu("linear",trans,xy,x,y,1.e-5)
+
+x2 = x.reshape(15,20)
+y2 = y.reshape(15,20)
+xn,yn = trans.datatondc(x2,y2)
+test_value("linear: shape",int(xn.shape == (15,20)),1)
+xd,yd = trans.ndctodata(xn,yn)
+test_values("linear: round trip x",xd,x2,1.e-9)
+test_values("linear: round trip y",yd,y2,1.e-9)
+
+xo = numpy.empty(300,numpy.float32)
+yo = numpy.empty(300,numpy.float32)
+r = trans.datatondc(x,y,xo,yo)
+test_value("linear: xout used",int(r[0] is xo and r[1] is yo),1)
+test_values("linear: xout",xo,xn.ravel().astype(numpy.float32),0.)
+
+xn32,yn32 = trans.datatondc(x.astype(numpy.float32),y.astype(numpy.float32))
+test_value("linear: float32",int(xn32.dtype == numpy.float32),1)
+
+#
+# Points outside the data limits, missing values, and NDC points
+# outside the viewport are all out_of_range, in both outputs.
+#
+xb = ma.masked_values([50.,200.,-999.,300.,450.,250.],-999.)
+yb = ma.masked_values([500.,-900.,500.,-999.,500.,500.],-999.)
+xn,yn = trans.datatondc(xb,yb)
+test_values("out of range: datatondc x", \
+            numpy.equal(xn,trans.out_of_range),[1,1,1,1,1,0])
+test_values("out of range: datatondc y", \
+            numpy.equal(yn,trans.out_of_range),[1,1,1,1,1,0])
+xd,yd = trans.ndctodata([-0.5,0.5,0.5],[0.5,1.5,0.5])
+test_values("out of range: ndctodata", \
+            numpy.equal(xd,trans.out_of_range),[1,1,0])
+xh,yh = Ngl.datatondc(xy,xb,yb)
+test_values("out of range: as Ngl.datatondc", \
+            numpy.equal(xn,trans.out_of_range),ma.getmaskarray(xh))
+
+#
+# Log axes: each decade takes the same space, and zero or negative
+# values are out of range.
+#
+xl = 10.**Ngl.fspan(-1.,3.,200)
+yl = 10.**(1. + numpy.sin(0.05*numpy.arange(200)))
+lres = Ngl.Resources()
+lres.nglDraw  = False
+lres.nglFrame = False
+lres.trXLog   = True
+lres.trYLog   = True
+xy_log = Ngl.xy(wks,xl,yl,lres)
+trans = Ngl.plot_transform(xy_log)
+test_value("log: done in NumPy",int(trans.linear is not None),1)
+check_hlu("log",trans,xy_log,xl,yl,1.e-5)
+xn,yn = trans.datatondc([1.,10.,100.],[10.,10.,10.])
+test_value("log: decades",xn[2]-xn[1],xn[1]-xn[0],1.e-9)
+xn,yn = trans.datatondc([0.,-1.,1.],[10.,10.,0.])
+test_values("log: not positive",numpy.equal(xn,trans.out_of_range),[1,1,1])
+xd,yd = trans.ndctodata(*trans.datatondc(xl,yl))
+test_values("log: round trip",xd,xl,1.e-9*xl.max())
+
+#
+# Reversed axes: the minimum of each axis is at the right and at the
+# top of the viewport.
+#
+rres = Ngl.Resources()
+rres.nglDraw    = False
+rres.nglFrame   = False
+rres.trXReverse = True
+rres.trYReverse = True
+xy_rev = Ngl.xy(wks,x,y,rres)
+trans = Ngl.plot_transform(xy_rev)
+test_value("reversed: done in NumPy",int(trans.linear is not None),1)
+check_hlu("reversed",trans,xy_rev,x,y,1.e-5)
+vpx,vpy,vpw = [Ngl.get_float(xy_rev,r) for r in ("vpXF","vpYF","vpWidthF")]
+xmin,ymin = [Ngl.get_float(xy_rev,r) for r in ("trXMinF","trYMinF")]
+xn,yn = trans.datatondc([xmin],[ymin])
+test_value("reversed: x minimum on the right",xn[0],vpx+vpw,1.e-6)
+test_value("reversed: y minimum at the top",yn[0],vpy,1.e-6)
+
+#
+# Irregularly spaced coordinates go through the HLU transformation.
+#
+xi = Ngl.fspan(0.,1.,30)**3
+yi = Ngl.fspan(0.,1.,20)**0.5
+data = numpy.sin(6.*xi[numpy.newaxis,:])*numpy.cos(4.*yi[:,numpy.newaxis])
+cres = Ngl.Resources()
+cres.nglDraw  = False
+cres.nglFrame = False
+cres.sfXArray = xi
+cres.sfYArray = yi
+cn = Ngl.contour(wks,data,cres)
+trans = Ngl.plot_transform(cn)
+test_value("irregular: done by the HLU",int(trans.linear is None),1)
+px,py = numpy.meshgrid(Ngl.fspan(-0.1,1.1,25),Ngl.fspan(-0.1,1.1,25))
+check_hlu("irregular",trans,cn,px.ravel(),py.ravel(),1.e-6)
+
+#
+# Curvilinear coordinates.
+#
+jj,ii = numpy.meshgrid(Ngl.fspan(0.,1.,20),Ngl.fspan(0.,1.,30),indexing="ij")
+lon2d = 10. + 20.*ii + 5.*jj
+lat2d = 30. + 15.*jj + 3.*numpy.sin(3.*ii)
+cres = Ngl.Resources()
+cres.nglDraw    = False
+cres.nglFrame   = False
+cres.sfXArray   = lon2d
+cres.sfYArray   = lat2d
+cres.trGridType = "Curvilinear"
+cn_c = Ngl.contour(wks,data,cres)
+trans = Ngl.plot_transform(cn_c)
+test_value("curvilinear: done by the HLU",int(trans.linear is None),1)
+px,py = numpy.meshgrid(Ngl.fspan(5.,40.,15),Ngl.fspan(25.,50.,15))
+check_hlu("curvilinear",trans,cn_c,px.ravel(),py.ravel(),1.e-6)
+
+#
+# A map, where points off the map are out of range.
+#
+mres = Ngl.Resources()
+mres.nglDraw  = False
+mres.nglFrame = False
+mres.mpLimitMode = "LatLon"
+mres.mpMinLatF   = 20.
+mres.mpMaxLatF   = 60.
+mres.mpMinLonF   = -10.
+mres.mpMaxLonF   = 50.
+mp = Ngl.map(wks,mres)
+trans = Ngl.plot_transform(mp)
+test_value("map: done by the HLU",int(trans.linear is None),1)
+plon = numpy.array([0.,20.,40.,100.,20.])
+plat = numpy.array([30.,40.,50.,40.,-50.])
+check_hlu("map",trans,mp,plon,plat,1.e-6)
+xn,yn = trans.datatondc(plon,plat)
+test_values("map: off the map",numpy.equal(xn,trans.out_of_range),[0,0,0,1,1])
+
+Ngl.end()
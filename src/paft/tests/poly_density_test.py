@@ -0,0 +1,70 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Half a million points, some of them missing and some outside the
+# axis range.
+#
+numpy.random.seed(32)
+npts = 500000
+x = numpy.random.standard_normal(npts)
+y = 0.5*x + numpy.random.standard_normal(npts)
+x[:1000] = -999.
+xmin,xmax,ymin,ymax = -3.,3.,-4.,4.
+nx,ny = 60,40
+
+wks = Ngl.open_wks("png","poly_density")
+
+res = Ngl.Resources()
+res.nglDraw  = False
+res.nglFrame = False
+res.trXMinF  = xmin
+res.trXMaxF  = xmax
+res.trYMinF  = ymin
+res.trYMaxF  = ymax
+plot = Ngl.xy(wks,[xmin,xmax],[ymin,ymax],res)
+
+#
+# The density plot's data is the 2D histogram of the points over the
+# axis range, with missing points left out.
+#
+pres = Ngl.Resources()
+pres.nglPolymarkerDensity     = True
+pres.nglPolymarkerDensityBins = [nx,ny]
+xm = numpy.ma.masked_values(x,-999.)
+dplot = Ngl.add_polymarker(wks,plot,xm,y,pres)
+test_value("poly density: contour plot",int(dplot.contour is not None),1)
+
+keep = x != -999.
+ref,ye,xe = numpy.histogram2d(y[keep],x[keep],bins=[ny,nx], \
+                              range=[[ymin,ymax],[xmin,xmax]])
+counts = Ngl.get_MDfloat_array(dplot.sffield,"sfDataArray")
+test_value("poly density: shape",int(counts.shape == (ny,nx)),1)
+test_values("poly density: counts",counts,ref,0.5)
+test_value("poly density: total",numpy.sum(counts),numpy.sum(ref),0.5)
+
+#
+# The bins are centered on the cells that cover the axis range.
+#
+test_values("poly density: x centers", \
+            Ngl.get_float_array(dplot.sffield,"sfXArray"), \
+            0.5*(xe[:-1]+xe[1:]),1.e-5)
+test_values("poly density: y centers", \
+            Ngl.get_float_array(dplot.sffield,"sfYArray"), \
+            0.5*(ye[:-1]+ye[1:]),1.e-5)
+
+#
+# The plot the markers were added to keeps its size and range.
+#
+test_value("poly density: x range kept",Ngl.get_float(plot.base,"trXMaxF"), \
+           xmax,1.e-6)
+
+#
+# Below nglPolymarkerDensityMinN points, ordinary markers are drawn.
+#
+pres.nglPolymarkerDensityMinN = npts+1
+mplot = Ngl.add_polymarker(wks,plot,x[:100],y[:100],pres)
+test_value("poly density: markers below MinN", \
+           int(mplot.contour is None),1)
+
+Ngl.end()
@@ -0,0 +1,67 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Draw the same raster-filled grid with and without nglRasterFastPath
+# and compare the images pixel by pixel. The fast path samples the
+# grid at the nearest point to each pixel, so a few pixels along the
+# cell edges may differ.
+#
+ny  = 90
+nx  = 180
+lat = Ngl.fspan(-89.,89.,ny)
+lon = Ngl.fspan(-179.,179.,nx)
+data = numpy.cos(numpy.radians(lat))[:,numpy.newaxis] * \
+       numpy.sin(3.*numpy.radians(lon))[numpy.newaxis,:]
+#
+# Put in a block of missing values, which should be left transparent.
+#
+data[30:45,60:90] = -999.
+
+wres = Ngl.Resources()
+wres.wkWidth  = 800
+wres.wkHeight = 800
+wks = Ngl.open_wks("png","raster_fast",wres)
+
+res = Ngl.Resources()
+res.cnFillOn        = True
+res.cnFillMode      = "RasterFill"
+res.cnLinesOn       = False
+res.cnLineLabelsOn  = False
+res.sfXArray        = lon
+res.sfYArray        = lat
+res.sfMissingValueV = -999.
+
+res.nglRasterFastPath = False
+Ngl.contour(wks,data,res)
+res.nglRasterFastPath = True
+Ngl.contour(wks,data,res)
+
+res.nglRasterFastPath = False
+Ngl.contour_map(wks,data,res)
+res.nglRasterFastPath = True
+Ngl.contour_map(wks,data,res)
+
+#
+# Unevenly spaced coordinates can't take the fast path, so the plot
+# is drawn the usual way and comes out the same.
+#
+res.sfYArray = numpy.sin(numpy.radians(lat))*89.
+res.nglRasterFastPath = False
+Ngl.contour(wks,data,res)
+res.nglRasterFastPath = True
+Ngl.contour(wks,data,res)
+
+Ngl.end()
+images = [read_png("raster_fast.%06d.png" % i) for i in range(1,7)]
+
+diff = numpy.any(images[0] != images[1],axis=2)
+test_value("raster fast path: contour pixels",numpy.mean(diff),0.,delta=0.01)
+
+diff = numpy.any(images[2] != images[3],axis=2)
+test_value("raster fast path: contour_map pixels",numpy.mean(diff),0., \
+           delta=0.01)
+
+
+diff = numpy.any(images[4] != images[5],axis=2)
+test_value("raster fast path: uneven grid falls back",numpy.mean(diff),0.)
@@ -0,0 +1,90 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Random points over the globe, plotted over a region of it.
+#
+numpy.random.seed(30)
+npts = 20000
+lat  = numpy.degrees(numpy.arcsin(numpy.random.uniform(-1.,1.,npts)))
+lon  = numpy.random.uniform(-180.,180.,npts)
+data = numpy.cos(numpy.radians(lat))*numpy.sin(3.*numpy.radians(lon))
+
+wks = Ngl.open_wks("png","region_cull")
+
+res = Ngl.Resources()
+res.nglDraw     = False
+res.nglFrame    = False
+res.cnFillOn    = True
+res.cnLinesOn   = False
+res.sfXArray    = lon
+res.sfYArray    = lat
+res.mpLimitMode = "LatLon"
+res.mpMinLatF   =   20.
+res.mpMaxLatF   =   50.
+res.mpMinLonF   = -130.
+res.mpMaxLonF   =  -60.
+
+def plotted(plot):
+  return Ngl.get_float_array(plot.sffield,"sfXArray"), \
+         Ngl.get_float_array(plot.sffield,"sfYArray"), \
+         Ngl.get_float_array(plot.sffield,"sfDataArray")
+
+#
+# Without culling every point is passed on.
+#
+plot = Ngl.contour_map(wks,data,res)
+test_value("region cull: off",len(plotted(plot)[0]),npts)
+
+#
+# With culling, exactly the points in the region widened by the halo
+# are passed on, with their own data values.
+#
+res.nglRegionCull      = True
+res.nglRegionCullHaloF = 2.
+plot = Ngl.contour_map(wks,data,res)
+x,y,z = plotted(plot)
+inside = (lat >= 18.) & (lat <= 52.) & (lon >= -132.) & (lon <= -58.)
+test_value("region cull: number of points",len(x),numpy.sum(inside))
+test_values("region cull: x",x,lon[inside],1.e-4)
+test_values("region cull: y",y,lat[inside],1.e-4)
+test_values("region cull: data",z,data[inside],1.e-6)
+
+#
+# A region across the dateline keeps the points on both sides of it.
+#
+res.mpMinLonF = 160.
+res.mpMaxLonF = 200.
+plot = Ngl.contour_map(wks,data,res)
+x,y,z = plotted(plot)
+dlon = numpy.mod(lon - 160.,360.)
+inside = (lat >= 18.) & (lat <= 52.) & ((dlon <= 42.) | (dlon >= 358.))
+test_value("region cull: dateline",len(x),numpy.sum(inside))
+test_value("region cull: both sides of dateline", \
+           int(numpy.any(x < -170.) and numpy.any(x > 170.)),1)
+
+#
+# A curvilinear grid is cut down to an index rectangle that still
+# covers the region.
+#
+ny = 181
+nx = 360
+glat,glon = numpy.meshgrid(numpy.linspace(-90.,90.,ny), \
+                           numpy.linspace(-179.5,179.5,nx),indexing="ij")
+glon = glon + 5.*numpy.sin(numpy.radians(glat))
+gdata = numpy.cos(numpy.radians(glat))*numpy.cos(numpy.radians(glon))
+
+res.sfXArray  = glon
+res.sfYArray  = glat
+res.mpMinLonF = -130.
+res.mpMaxLonF =  -60.
+plot = Ngl.contour_map(wks,gdata,res)
+cx = Ngl.get_MDfloat_array(plot.sffield,"sfXArray")
+cy = Ngl.get_MDfloat_array(plot.sffield,"sfYArray")
+test_value("region cull: curvilinear smaller", \
+           int(cx.shape[0] < ny and cx.shape[1] < nx),1)
+test_value("region cull: curvilinear covers region", \
+           int(cy.min() <= 18. and cy.max() >= 52. and \
+               cx.min() <= -132. and cx.max() >= -58.),1)
+
+Ngl.end()
@@ -0,0 +1,63 @@
+import Ngl, numpy, os
+from utils import *
+
+#
+# Render a few contour frames with two worker processes, and check
+# that each frame lands in its own file, in frame order.
+#
+def render(wks,index,data):
+  res = Ngl.Resources()
+  res.cnFillOn       = True
+  res.cnLinesOn      = False
+  res.cnLineLabelsOn = False
+  res.tiMainString   = "frame %d" % index
+  Ngl.contour(wks,data,res)
+
+ny = 30
+nx = 40
+y  = Ngl.fspan(-1.,1.,ny)[:,numpy.newaxis]
+x  = Ngl.fspan(-1.,1.,nx)[numpy.newaxis,:]
+frames = [numpy.sin(3.*x + 0.5*i)*numpy.cos(2.*y) for i in range(5)]
+
+#
+# One frame has missing values, which have to survive the trip
+# through shared memory.
+#
+frames[2] = numpy.ma.masked_where(frames[2] > 0.5,frames[2])
+
+files = Ngl.render_frames(render,frames,"render_frames",nworkers=2)
+
+test_value("render_frames: number of files",len(files),len(frames))
+expected = ["render_frames.%06d.png" % (i+1) for i in range(len(frames))]
+test_value("render_frames: file names",int(files == expected),1)
+ok = 1
+for f in files:
+  fp = open(f,"rb")
+  if fp.read(8) != b"\x89PNG\r\n\x1a\n":
+    ok = 0
+  fp.close()
+test_value("render_frames: PNG files",ok,1)
+
+#
+# No worker leaves a file of its own behind.
+#
+left = [f for f in os.listdir(".") if f.startswith("render_frames_w")]
+test_value("render_frames: worker files renamed",len(left),0)
+
+#
+# A render function that doesn't advance the frame is an error.
+#
+def no_frame(wks,index,data):
+  res = Ngl.Resources()
+  res.nglFrame = False
+  Ngl.contour(wks,data,res)
+
+try:
+  Ngl.render_frames(no_frame,frames[:1],"render_frames_bad",nworkers=2)
+  raised = 0
+except RuntimeError:
+  raised = 1
+test_value("render_frames: missing frame raises",raised,1)
+
+for f in files:
+  os.remove(f)
@@ -0,0 +1,105 @@
+import Ngl, numpy
+from utils import *
+
+y = Ngl.fspan(-1.,1.,20)[:,numpy.newaxis]
+x = Ngl.fspan(-1.,1.,30)[numpy.newaxis,:]
+data = numpy.sin(3.*x)*numpy.cos(2.*y)
+
+wks = Ngl.open_wks("png","resource_list")
+
+res = Ngl.Resources()
+res.nglDraw  = False
+res.nglFrame = False
+res.cnFillOn = True
+plot = Ngl.contour(wks,data,res)
+
+#
+# A ResourceList is a snapshot: its resources can be read back as
+# attributes, and later changes to the Resources object aren't seen.
+#
+vres = Ngl.Resources()
+vres.vpXF      = 0.2
+vres.vpWidthF  = 0.5
+vres.vpHeightF = 0.4
+rlist = Ngl.ResourceList(vres)
+vres.vpXF = 0.3
+test_value("ResourceList: attribute",rlist.vpXF,0.2)
+try:
+  rlist.vpYF
+  missing = 0
+except AttributeError:
+  missing = 1
+test_value("ResourceList: missing attribute",missing,1)
+
+#
+# Ngl.set_values converts the list once and applies the same HLU
+# resource list on every later call.
+#
+Ngl.set_values(plot.base,rlist)
+compiled = rlist._compiled
+test_value("ResourceList: compiled",int(compiled is not None),1)
+test_value("set_values: vpXF",Ngl.get_float(plot.base,"vpXF"),0.2,1e-6)
+test_value("set_values: vpWidthF", \
+           Ngl.get_float(plot.base,"vpWidthF"),0.5,1e-6)
+test_value("set_values: vpHeightF", \
+           Ngl.get_float(plot.base,"vpHeightF"),0.4,1e-6)
+
+Ngl.set_values(plot.base,vres)
+test_value("set_values: Resources",Ngl.get_float(plot.base,"vpXF"),0.3,1e-6)
+
+Ngl.set_values(plot.base,rlist)
+test_value("set_values: compiled list reused", \
+           int(rlist._compiled is compiled),1)
+test_value("set_values: vpXF again",Ngl.get_float(plot.base,"vpXF"),0.2,1e-6)
+
+#
+# The plotting functions accept a ResourceList in place of a
+# Resources object, and give the same plot.
+#
+cres = Ngl.Resources()
+cres.nglDraw  = False
+cres.nglFrame = False
+cres.cnFillOn = True
+cres.cnLevelSelectionMode = "ManualLevels"
+cres.cnMinLevelValF  = -0.8
+cres.cnMaxLevelValF  =  0.8
+cres.cnLevelSpacingF =  0.2
+plot1 = Ngl.contour(wks,data,cres)
+plot2 = Ngl.contour(wks,data,Ngl.ResourceList(cres))
+test_values("contour: levels", \
+            Ngl.get_float_array(plot2.contour,"cnLevels"), \
+            Ngl.get_float_array(plot1.contour,"cnLevels"))
+test_value("contour: cnFillOn", \
+           Ngl.get_integer(plot2.contour,"cnFillOn"),1)
+
+#
+# The same list can be used for more than one plot, since the
+# plotting functions work on a copy of it.
+#
+clist = Ngl.ResourceList(cres)
+plot3 = Ngl.contour(wks,data,clist)
+plot4 = Ngl.contour(wks,-data,clist)
+test_value("contour: list unchanged",len(clist._dict),len(cres.__dict__))
+test_values("contour: list reused", \
+            Ngl.get_float_array(plot4.contour,"cnLevels"), \
+            Ngl.get_float_array(plot3.contour,"cnLevels"))
+
+#
+# Anything other than a dictionary is refused when a resource list is
+# built.
+#
+try:
+  Ngl.compile_rlist_p(5)
+  raised = 0
+except TypeError:
+  raised = 1
+test_value("compile_rlist_p: non-dict",raised,1)
+
+try:
+  Ngl.NhlSetValues(plot.base,[1,2,3])
+  raised = 0
+except TypeError:
+  raised = 1
+test_value("rlist_from_object: non-dict",raised,1)
+
+Ngl.end()
@@ -0,0 +1,42 @@
+import Ngl, numpy
+from utils import *
+
+#
+# _skewt_thermo calls the same Fortran helpers as the scalar
+# functions, once per point, so the results must be identical.
+#
+mixrat = numpy.array([1.,2.,3.,5.,8.,12.,20.])
+theta  = numpy.array([-30.,0.,30.,60.,100.,150.])
+pseudo = numpy.array([-20.,0.,10.,20.,28.])
+p      = numpy.array([1050.,1000.,850.,700.,500.,400.,300.,240.])
+
+scalar = [Ngl._dtmrskewt,Ngl._dtdaskewt,Ngl._dsatlftskewt]
+names  = ["mixing ratio","dry adiabat","moist adiabat"]
+values = [mixrat,theta,pseudo]
+
+for which in range(3):
+  a  = numpy.repeat(values[which],len(p))
+  pp = numpy.tile(p,len(values[which]))
+  t  = Ngl._skewt_thermo(which,a,pp)
+  ref = numpy.array([scalar[which](a[i],pp[i]) for i in range(len(a))])
+  test_value("_skewt_thermo: %s length" % names[which],len(t),len(a))
+  test_values("_skewt_thermo: %s" % names[which],t,ref,0.)
+
+#
+# A scalar is broadcast against an array, either way round.
+#
+t = Ngl._skewt_thermo(0,mixrat,1000.)
+ref = numpy.array([Ngl._dtmrskewt(w,1000.) for w in mixrat])
+test_values("_skewt_thermo: scalar p",t,ref,0.)
+t = Ngl._skewt_thermo(2,20.,p)
+ref = numpy.array([Ngl._dsatlftskewt(20.,pp) for pp in p])
+test_values("_skewt_thermo: scalar a",t,ref,0.)
+
+#
+# Float32 and list input are converted to float64 first.
+#
+t = Ngl._skewt_thermo(1,list(theta),numpy.float32(850.))
+ref = numpy.array([Ngl._dtdaskewt(th,850.) for th in theta])
+test_values("_skewt_thermo: list and float32",t,ref,0.)
+
+test_value("_skewt_thermo: empty",len(Ngl._skewt_thermo(0,[],[])),0)
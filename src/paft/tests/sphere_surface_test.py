@@ -0,0 +1,51 @@
+import Ngl, numpy
+from utils import *
+
+#
+# A smooth field at points spread randomly over the sphere.
+#
+def field(lat,lon):
+  rlat = numpy.radians(lat)
+  rlon = numpy.radians(lon)
+  x = numpy.cos(rlat)*numpy.cos(rlon)
+  y = numpy.cos(rlat)*numpy.sin(rlon)
+  z = numpy.sin(rlat)
+  return x + 2.*y*y - z*z*z + x*y
+
+numpy.random.seed(47)
+npts = 500
+rlat = numpy.degrees(numpy.arcsin(numpy.random.uniform(-1.,1.,npts)))
+rlon = numpy.random.uniform(-180.,180.,npts)
+f    = field(rlat,rlon)
+
+plat = Ngl.fspan(-85.,85.,35)
+plon = Ngl.fspan(-180.,175.,72)
+exact = field(plat[:,numpy.newaxis],plon[numpy.newaxis,:])
+
+surf = Ngl.sphere_surface(rlat,rlon,f)
+fo   = surf.grid(plat,plon)
+test_value("sphere_surface: shape",int(fo.shape == (35,72)),1)
+
+#
+# The surface goes through the values at the points.
+#
+test_values("sphere_surface: input points",surf.points(rlat,rlon),f,1.e-10)
+
+#
+# For a smooth field on this many points the surface is close to the
+# field everywhere, and a constant field gives the constant.
+#
+test_value("sphere_surface: max error",numpy.max(numpy.abs(fo-exact)), \
+           0.,0.05)
+surf1 = Ngl.sphere_surface(rlat,rlon,numpy.zeros(npts)+2.5)
+test_values("sphere_surface: constant",surf1.grid(plat,plon), \
+            numpy.zeros((35,72))+2.5,1.e-10)
+
+#
+# Several fields at once give the same values as one at a time.
+#
+surf.set_values(numpy.array([f,3.*f+1.]))
+fo2 = surf.grid(plat,plon)
+test_value("sphere_surface: stack shape",int(fo2.shape == (2,35,72)),1)
+test_values("sphere_surface: stack field 0",fo2[0],fo,1.e-12)
+test_values("sphere_surface: stack field 1",fo2[1],3.*fo+1.,1.e-10)
@@ -0,0 +1,91 @@
+import Ngl, numpy, json, os
+from utils import *
+
+y = Ngl.fspan(-1.,1.,20)[:,numpy.newaxis]
+x = Ngl.fspan(-1.,1.,30)[numpy.newaxis,:]
+data = numpy.sin(3.*x)*numpy.cos(2.*y)
+
+wks = Ngl.open_wks("png","stats")
+
+res = Ngl.Resources()
+res.nglDraw  = False
+res.nglFrame = False
+res.cnFillOn = True
+
+#
+# Nothing is kept until statistics are turned on.
+#
+Ngl.enable_stats(False)
+plot = Ngl.contour(wks,data,res)
+test_value("stats off: empty",len(Ngl.get_stats()),0)
+
+#
+# Counts, bytes converted, and times for each stage. The data are
+# passed to contour_wrap as doubles.
+#
+Ngl.enable_stats()
+plot = Ngl.contour(wks,data,res)
+plot = Ngl.contour(wks,data,res)
+stats = Ngl.get_stats()
+test_value("stats: contour count",stats["contour"]["count"],2)
+test_value("stats: data count",stats["data"]["count"],2)
+test_value("stats: data bytes",stats["data"]["bytes"],2*8*data.size)
+test_value("stats: rlist seen",int(stats["rlist"]["count"] >= 2),1)
+test_value("stats: no draw",int("draw" in stats),0)
+test_value("stats: no frame",int("frame" in stats),0)
+test_value("stats: times", \
+           int(stats["contour"]["seconds"] >= 0. and \
+               stats["data"]["seconds"] >= 0.),1)
+
+#
+# Drawing and advancing the frame are stages of their own.
+#
+plot = Ngl.contour(wks,data,Ngl.Resources())
+stats = Ngl.get_stats(reset=True)
+test_value("stats: contour count after draw",stats["contour"]["count"],3)
+test_value("stats: draw count",stats["draw"]["count"],1)
+test_value("stats: frame count",stats["frame"]["count"],1)
+test_value("stats: reset",len(Ngl.get_stats()),0)
+
+#
+# Without trace=True, no trace events are kept.
+#
+plot = Ngl.contour(wks,data,res)
+Ngl.get_stats(trace_file="stats_notrace.json")
+fp = open("stats_notrace.json")
+trace = json.load(fp)
+fp.close()
+test_value("no trace: events",len(trace["traceEvents"]),0)
+os.remove("stats_notrace.json")
+
+#
+# With trace=True, each call is an event. The data object is created
+# before the contour plot, and the plot is drawn inside the contour
+# call.
+#
+Ngl.enable_stats(trace=True)
+plot = Ngl.contour(wks,data,Ngl.Resources())
+Ngl.get_stats(trace_file="stats_trace.json")
+fp = open("stats_trace.json")
+trace = json.load(fp)
+fp.close()
+os.remove("stats_trace.json")
+events = trace["traceEvents"]
+cn = [e for e in events if e["name"] == "contour"]
+sf = [e for e in events if e["name"] == "data"]
+dr = [e for e in events if e["name"] == "draw"]
+test_value("trace: contour events",len(cn),1)
+test_value("trace: data events",len(sf),1)
+test_value("trace: complete events", \
+           int(min([e["ph"] == "X" for e in events])),1)
+test_value("trace: pid",int(cn[0]["pid"] == os.getpid()),1)
+test_value("trace: draw events",len(dr),1)
+test_value("trace: data before contour", \
+           int(sf[0]["ts"] + sf[0]["dur"] <= cn[0]["ts"] + 1.e-3),1)
+test_value("trace: draw inside contour", \
+           int(dr[0]["ts"] + 1.e-3 >= cn[0]["ts"] and \
+               dr[0]["ts"] + dr[0]["dur"] <= \
+               cn[0]["ts"] + cn[0]["dur"] + 1.e-3),1)
+
+Ngl.enable_stats(False)
+Ngl.end()
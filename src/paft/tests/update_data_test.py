@@ -0,0 +1,85 @@
+import Ngl, numpy
+from utils import *
+
+#
+# Two frames of a field, for Ngl.update_contour_data and friends.
+#
+ny  = 40
+nx  = 60
+y   = Ngl.fspan(-1.,1.,ny)[:,numpy.newaxis]
+x   = Ngl.fspan(-1.,1.,nx)[numpy.newaxis,:]
+data1 = numpy.sin(3.*x)*numpy.cos(2.*y)
+data2 = 0.8*numpy.cos(2.*x)*numpy.sin(3.*y)
+
+wks = Ngl.open_wks("png","update_data")
+
+res = Ngl.Resources()
+res.cnFillOn       = True
+res.cnLinesOn      = False
+res.cnLineLabelsOn = False
+plot = Ngl.contour(wks,data1,res)
+levels = Ngl.get_float_array(plot.contour,"cnLevels")
+
+#
+# The new data replaces the old in the plot's scalar field, and the
+# levels stay the same.
+#
+Ngl.update_contour_data(wks,plot,data2)
+test_values("update_contour_data: data", \
+            Ngl.get_MDfloat_array(plot.sffield,"sfDataArray"),data2,1.e-6)
+test_values("update_contour_data: levels kept", \
+            Ngl.get_float_array(plot.contour,"cnLevels"),levels,1.e-6)
+
+#
+# With keep_levels=False the levels follow the data.
+#
+Ngl.update_contour_data(wks,plot,10.*data2,keep_levels=False)
+test_value("update_contour_data: new levels", \
+           int(numpy.max(Ngl.get_float_array(plot.contour,"cnLevels")) > \
+               2.*numpy.max(levels)),1)
+
+#
+# A contour overlaid on a map: the map is the base of the plot, and
+# updating the data leaves its viewport where it was.
+#
+lat = Ngl.fspan(-60.,60.,ny)
+lon = Ngl.fspan(-90.,90.,nx)
+mres = Ngl.Resources()
+mres.sfXArray  = lon
+mres.sfYArray  = lat
+mres.cnFillOn  = True
+mres.cnLinesOn = False
+mplot = Ngl.contour_map(wks,data1,mres)
+vp1 = [Ngl.get_float(mplot.map,name) \
+       for name in ("vpXF","vpYF","vpWidthF","vpHeightF")]
+Ngl.update_contour_data(wks,mplot,data2)
+vp2 = [Ngl.get_float(mplot.map,name) \
+       for name in ("vpXF","vpYF","vpWidthF","vpHeightF")]
+test_values("update_contour_data: map data", \
+            Ngl.get_MDfloat_array(mplot.sffield,"sfDataArray"),data2,1.e-6)
+test_values("update_contour_data: map viewport",numpy.array(vp2), \
+            numpy.array(vp1),1.e-6)
+
+#
+# Vector and streamline plots get both components replaced.
+#
+u1 = numpy.ones((ny,nx))
+v1 = numpy.zeros((ny,nx))
+u2 = -numpy.cos(numpy.pi*y)*numpy.ones((ny,nx))
+v2 = numpy.sin(numpy.pi*x)*numpy.ones((ny,nx))
+
+vplot = Ngl.vector(wks,u1,v1)
+Ngl.update_vector_data(wks,vplot,u2,v2)
+test_values("update_vector_data: u", \
+            Ngl.get_MDfloat_array(vplot.vffield,"vfUDataArray"),u2,1.e-6)
+test_values("update_vector_data: v", \
+            Ngl.get_MDfloat_array(vplot.vffield,"vfVDataArray"),v2,1.e-6)
+
+splot = Ngl.streamline(wks,u1,v1)
+Ngl.update_streamline_data(wks,splot,u2,v2)
+test_values("update_streamline_data: u", \
+            Ngl.get_MDfloat_array(splot.vffield,"vfUDataArray"),u2,1.e-6)
+test_values("update_streamline_data: v", \
+            Ngl.get_MDfloat_array(splot.vffield,"vfVDataArray"),v2,1.e-6)
+
+Ngl.end()
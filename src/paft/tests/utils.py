@@ -110,3 +110,84 @@ def test_values(title,values1,values2,delta=1e-8):
       else:
         print "min/max values22 =" + str(numpy.min(numpy.array(values22))) + \
                                "/" + str(numpy.max(numpy.array(values22)))
+
+#
+# Read an 8-bit, non-interlaced PNG file, such as the ones a "png"
+# workstation writes, into a uint8 array of shape (height, width, 4)
+# holding red, green, blue, and alpha. This lets tests compare the
+# images they draw without needing an imaging package.
+#
+def read_png(name):
+  import struct, zlib
+  fp = open(name,"rb")
+  data = fp.read()
+  fp.close()
+  if data[:8] != b"\x89PNG\r\n\x1a\n":
+    raise ValueError(name + " is not a PNG file")
+
+  pos  = 8
+  idat = []
+  while pos < len(data):
+    length,ctype = struct.unpack(">I4s",data[pos:pos+8])
+    chunk = data[pos+8:pos+8+length]
+    if ctype == b"IHDR":
+      width,height,depth,color,comp,filt,interlace = \
+        struct.unpack(">IIBBBBB",chunk)
+    elif ctype == b"IDAT":
+      idat.append(chunk)
+    elif ctype == b"IEND":
+      break
+    pos = pos + 12 + length
+
+  nchan = {0:1, 2:3, 4:2, 6:4}.get(color)
+  if depth != 8 or interlace != 0 or nchan is None:
+    raise ValueError(name + ": only 8-bit, non-interlaced PNG files are supported")
+
+  raw  = numpy.frombuffer(zlib.decompress(b"".join(idat)),dtype=numpy.uint8)
+  raw  = raw.reshape(height,1+width*nchan)
+  out  = numpy.zeros((height,width*nchan),dtype=numpy.uint8)
+  prev = numpy.zeros(width*nchan,dtype=numpy.int32)
+  for j in range(height):
+    ftype = raw[j,0]
+    line  = raw[j,1:].astype(numpy.int32)
+    if ftype == 0:
+      cur = line
+    elif ftype == 1:
+      cur = numpy.cumsum(line.reshape(width,nchan),axis=0).ravel() % 256
+    elif ftype == 2:
+      cur = (line + prev) % 256
+    else:
+      cur  = [0]*(width*nchan)
+      lst  = line.tolist()
+      up   = prev.tolist()
+      for i in range(width*nchan):
+        a = cur[i-nchan] if i >= nchan else 0
+        b = up[i]
+        if ftype == 3:
+          cur[i] = (lst[i] + (a + b)//2) % 256
+        else:
+          c = up[i-nchan] if i >= nchan else 0
+          p  = a + b - c
+          pa = abs(p - a)
+          pb = abs(p - b)
+          pc = abs(p - c)
+          if pa <= pb and pa <= pc:
+            pred = a
+          elif pb <= pc:
+            pred = b
+          else:
+            pred = c
+          cur[i] = (lst[i] + pred) % 256
+      cur = numpy.array(cur,dtype=numpy.int32)
+    out[j] = cur
+    prev = cur
+
+  out = out.reshape(height,width,nchan)
+  if nchan < 3:
+    gray = out[:,:,:1].repeat(3,axis=2)
+    alpha = out[:,:,1:] if nchan == 2 else None
+    out = gray if alpha is None else numpy.concatenate((gray,alpha),axis=2)
+  if out.shape[2] == 3:
+    opaque = numpy.zeros((height,width,1),dtype=numpy.uint8) + 255
+    out = numpy.concatenate((out,opaque),axis=2)
+  return out
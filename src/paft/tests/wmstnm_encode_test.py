@@ -0,0 +1,83 @@
+import Ngl, numpy
+from utils import *
+
+#
+# The wind group is the second five characters of the station string:
+# the cloud cover, then the direction in tens of degrees, then the
+# speed in knots.
+#
+def wind(imdat):
+  return imdat[5:10].decode()
+
+imdat = Ngl.wmstnm_encode(cover=4,wdir=[0.,90.,184.,355.,360.,270.], \
+                          wspd=[10.,10.,10.,10.,10.,0.])
+
+test_value("wmstnm_encode: number of stations",len(imdat),6)
+test_value("wmstnm_encode: string length", \
+           int(numpy.all(numpy.char.str_len(imdat) == 50)),1)
+test_value("wmstnm_encode: north as 0",int(wind(imdat[0]) == "43610"),1)
+test_value("wmstnm_encode: east",int(wind(imdat[1]) == "40910"),1)
+test_value("wmstnm_encode: south",int(wind(imdat[2]) == "41810"),1)
+test_value("wmstnm_encode: 355 rounds to north", \
+           int(wind(imdat[3]) == "43610"),1)
+test_value("wmstnm_encode: north as 360",int(wind(imdat[4]) == "43610"),1)
+test_value("wmstnm_encode: calm",int(wind(imdat[5]) == "40000"),1)
+
+#
+# The temperature and dew point groups carry a sign digit and tenths.
+#
+imdat = Ngl.wmstnm_encode(temp=-12.3,dewpt=4.5,pres=1013.2,slp=998.7)
+test_value("wmstnm_encode: temperature", \
+           int(imdat[0][10:15].decode() == "11123"),1)
+test_value("wmstnm_encode: dew point", \
+           int(imdat[0][15:20].decode() == "20045"),1)
+test_value("wmstnm_encode: station pressure", \
+           int(imdat[0][20:25].decode() == "30132"),1)
+test_value("wmstnm_encode: sea level pressure", \
+           int(imdat[0][25:30].decode() == "49987"),1)
+
+#
+# Over a map, the wind directions are corrected for the projection as
+# the stations are drawn. North stays 36, even where the projection
+# turns it a little either way, and a calm wind stays 00.
+#
+def drawn_dirs(wks,lat,lon,imdat):
+  gksid = Ngl.get_integer(wks,"wkGksWorkId")
+  drawn = Ngl.wmstnms_p(gksid,numpy.array(lat,dtype=numpy.float64), \
+                        numpy.array(lon,dtype=numpy.float64),len(imdat), \
+                        imdat.astype("S50").tobytes(),0.)
+  return [drawn[50*i+6:50*i+8].decode() for i in range(len(imdat))]
+
+wks = Ngl.open_wks("png","wmstnm_encode")
+Ngl.wmsetp("ezf",1)
+
+mres = Ngl.Resources()
+mres.nglFrame = False
+cemap = Ngl.map(wks,mres)
+imdat = Ngl.wmstnm_encode(wdir=[360.,90.,0.],wspd=[10.,10.,0.])
+dirs = drawn_dirs(wks,[0.,0.,0.],[0.,0.,0.],imdat)
+Ngl.frame(wks)
+test_value("wmstnm over map: north",int(dirs[0] == "36"),1)
+test_value("wmstnm over map: east",int(dirs[1] == "09"),1)
+test_value("wmstnm over map: calm",int(dirs[2] == "00"),1)
+
+#
+# On a polar stereographic map, north at 3 degrees either side of the
+# central meridian is turned to 357 or 3 degrees, both of which are
+# coded as 36.
+#
+mres.mpProjection = "Stereographic"
+mres.mpCenterLatF = 90.
+mres.mpCenterLonF = 0.
+mres.mpLimitMode  = "LatLon"
+mres.mpMinLatF    = 30.
+psmap = Ngl.map(wks,mres)
+imdat = Ngl.wmstnm_encode(wdir=[360.,360.,0.],wspd=[10.,10.,0.])
+dirs = drawn_dirs(wks,[60.,60.,60.],[3.,-3.,90.],imdat)
+Ngl.frame(wks)
+test_value("wmstnm over map: 357 is north",int(dirs[0] == "36"),1)
+test_value("wmstnm over map: 3 is north",int(dirs[1] == "36"),1)
+test_value("wmstnm over map: calm not turned",int(dirs[2] == "00"),1)
+
+Ngl.wmsetp("ezf",-1)
+Ngl.end()
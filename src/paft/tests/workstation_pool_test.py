@@ -0,0 +1,76 @@
+import Ngl, numpy, os
+from utils import *
+
+y = Ngl.fspan(-1.,1.,20)[:,numpy.newaxis]
+x = Ngl.fspan(-1.,1.,30)[numpy.newaxis,:]
+data = numpy.sin(3.*x)*numpy.cos(2.*y)
+
+pool = Ngl.WorkstationPool(size=1)
+
+#
+# One frame is written to wk_name.png.
+#
+wks = pool.acquire("pool_one")
+cmap0 = Ngl.retrieve_colormap(wks)
+res = Ngl.Resources()
+res.cnFillOn = True
+plot = Ngl.contour(wks,data,res)
+files = pool.release(wks,[plot])
+test_value("pool: one frame",int(files == ["pool_one.png"]),1)
+test_value("pool: file written",int(os.path.exists("pool_one.png")),1)
+
+#
+# The same workstation comes back for the next product, and several
+# frames are numbered. A colormap changed while drawing is put back
+# when the workstation is released.
+#
+wks2 = pool.acquire("pool_two")
+test_value("pool: workstation reused",wks2,wks)
+wres = Ngl.Resources()
+wres.wkColorMap = "rainbow"
+Ngl.set_values(wks2,wres)
+plot1 = Ngl.contour(wks2,data,res)
+plot2 = Ngl.contour(wks2,-data,res)
+files = pool.release(wks2,[plot1,plot2])
+test_value("pool: two frames", \
+           int(files == ["pool_two.000001.png","pool_two.000002.png"]),1)
+test_values("pool: colormap restored",Ngl.retrieve_colormap(wks),cmap0)
+
+#
+# Without a name, the product's output is thrown away.
+#
+wks3 = pool.acquire()
+Ngl.contour(wks3,data,res)
+test_value("pool: no name",len(pool.release(wks3)),0)
+
+#
+# Only "size" idle workstations are kept; the others are deleted
+# when they're released.
+#
+wks4 = pool.acquire("pool_a")
+wks5 = pool.acquire("pool_b")
+test_value("pool: new workstation when busy",int(wks5 != wks4),1)
+pool.release(wks4)
+pool.release(wks5)
+test_value("pool: idle kept",len(pool._idle),1)
+
+#
+# Closing with a workstation still acquired is refused and changes
+# nothing, unless forced.
+#
+wks6 = pool.acquire("pool_c")
+try:
+  pool.close()
+  raised = 0
+except RuntimeError:
+  raised = 1
+test_value("pool: close while busy raises",raised,1)
+test_value("pool: close while busy keeps pool", \
+           int(len(pool._busy) == 1 and len(pool._idle) == 0),1)
+pool.close(force=True)
+test_value("pool: forced close", \
+           int(len(pool._busy) == 0 and len(pool._idle) == 0),1)
+
+for f in ["pool_one.png","pool_two.000001.png","pool_two.000002.png"]:
+  os.remove(f)
+Ngl.end()